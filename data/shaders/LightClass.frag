@@ -0,0 +1,14 @@
+#version 120
+
+uniform sampler2D texture;
+
+// Draws a light sprite into the lights layer, writing its light class (passed in the vertex colour's alpha, see eLightClass) into the alpha channel.
+// drawn without blending, so transparent texels are discarded to leave whatever is underneath
+void main()
+{
+	vec4 pixel = texture2D(texture, vec2(gl_TexCoord[0].x, gl_TexCoord[0].y));
+	if(pixel.a < 0.5){
+		discard;
+	}
+	gl_FragColor = vec4(pixel.rgb * gl_Color.rgb, gl_Color.a);
+}
@@ -10,13 +10,19 @@ uniform sampler2D texture; // backgroundGameplay
 uniform sampler2D fgTilesTexture;
 uniform sampler2D fgGameplayTexture;
 uniform sampler2D hudTexture;
+uniform sampler2D lightsCoverage; // one texel per tile of the lights layer, white where anything was drawn into it
+uniform vec4 lightClassColors[4]; // indexed by light class (see eLightClass): rgb replaces the light colour by a
 
+// the lights layer's alpha holds each pixel's light class (as class / 255). pixels a light mask doesn't cover are unlit
+vec3 ClassifyLight(vec3 in_lightColor, float in_lightAlpha, bool in_maskCovered)
+{
+	int lightClass = in_maskCovered ? int(min(in_lightAlpha * 255.0 + 0.5, 3.0)) : 0;
+	vec4 classColor = lightClassColors[lightClass];
+	return mix(in_lightColor, classColor.rgb, classColor.a);
+}
 
 void main()
 {
-	vec4 fgLightMaskTexturePixel = texture2D(fgLightMaskTexture, vec2(gl_TexCoord[0].x, gl_TexCoord[0].y));
-	vec4 bkgLightMaskTexturePixel = texture2D(bkgLightMaskTexture, vec2(gl_TexCoord[0].x, gl_TexCoord[0].y));
-	vec4 lightsTexturePixel = texture2D(lightsTexture, vec2(gl_TexCoord[0].x, gl_TexCoord[0].y));
 	vec4 skyboxTexturePixel = texture2D(skyboxTexture, vec2(gl_TexCoord[0].x, gl_TexCoord[0].y));
 	vec4 parallaxTexturePixel = texture2D(parallaxTexture, vec2(gl_TexCoord[0].x, gl_TexCoord[0].y));
 	vec4 bkgTilesTexturePixel = texture2D(bkgTilesTexture, vec2(gl_TexCoord[0].x, gl_TexCoord[0].y));
@@ -25,48 +31,29 @@ void main()
 	vec4 fgGameplayTexturePixel = texture2D(fgGameplayTexture, vec2(gl_TexCoord[0].x, gl_TexCoord[0].y));
 	vec4 hudTexturePixel = texture2D(hudTexture, vec2(gl_TexCoord[0].x, gl_TexCoord[0].y));
 
-	bkgLightMaskTexturePixel = bkgLightMaskTexturePixel * vec4(1, 1, 1, (1.0 - fgTilesTexturePixel.a));
-	fgLightMaskTexturePixel = fgLightMaskTexturePixel * vec4(1, 1, 1, (1.0 - bkgTilesTexturePixel.a));
-
-	vec4 gameplayLightsTexturePixel = lightsTexturePixel;
-	if(gameplayLightsTexturePixel.rgb == vec3(139.0 / 255.0, 155.0 / 255.0, 180.0 / 255.0)){
-		// set "penumbra" color that gets multiplied down on edge of light:
-		gameplayLightsTexturePixel = vec4(139.0 / 255.0, 155.0 / 255.0, 180.0 / 255.0, 1.0);
-	}
-	if(gameplayLightsTexturePixel.rgb == vec3(0, 0, 0)){
-		// set "shadow" color that gets multiplied down on unlit areas:
-		gameplayLightsTexturePixel = vec4(83.0 / 255.0, 88.0 / 255.0, 141.0 / 255.0, 1.0);
-	}
-
-	vec4 fgLightsTexturePixel = lightsTexturePixel * fgLightMaskTexturePixel;
-	if(fgLightsTexturePixel.rgb == vec3(139.0 / 255.0, 155.0 / 255.0, 180.0 / 255.0)){
-		// set "penumbra" color that gets multiplied down on edge of light:
-		fgLightsTexturePixel = vec4(139.0 / 255.0, 155.0 / 255.0, 180.0 / 255.0, 1.0);
-	}
-	if(fgLightsTexturePixel.rgb == vec3(0, 0, 0)){
-		// set "shadow" color that gets multiplied down on unlit areas:
-		fgLightsTexturePixel = vec4(83.0 / 255.0, 88.0 / 255.0, 141.0 / 255.0, 1.0);
-	}
-
-	vec4 bkgLightsTexturePixel = lightsTexturePixel * bkgLightMaskTexturePixel;
-	if(bkgLightsTexturePixel.rgb == vec3(139.0 / 255.0, 155.0 / 255.0, 180.0 / 255.0)){
-		// set "penumbra" color that gets multiplied down on edge of light:
-		bkgLightsTexturePixel = vec4(139.0 / 255.0, 155.0 / 255.0, 180.0 / 255.0, 1.0);
-	}
-	if(bkgLightsTexturePixel.rgb == vec3(0, 0, 0)){
-		// set "shadow" color that gets multiplied down on unlit areas:
-		bkgLightsTexturePixel = vec4(83.0 / 255.0, 88.0 / 255.0, 141.0 / 255.0, 1.0);
+	// tiles nothing was drawn into on the lights layer are entirely unlit, so only sample the lights and light masks where it was drawn
+	vec3 gameplayLightsColor = lightClassColors[0].rgb;
+	vec3 fgLightsColor = gameplayLightsColor;
+	vec3 bkgLightsColor = gameplayLightsColor;
+	if(texture2D(lightsCoverage, vec2(gl_TexCoord[0].x, gl_TexCoord[0].y)).r > 0.5){
+		vec4 fgLightMaskTexturePixel = texture2D(fgLightMaskTexture, vec2(gl_TexCoord[0].x, gl_TexCoord[0].y));
+		vec4 bkgLightMaskTexturePixel = texture2D(bkgLightMaskTexture, vec2(gl_TexCoord[0].x, gl_TexCoord[0].y));
+		vec4 lightsTexturePixel = texture2D(lightsTexture, vec2(gl_TexCoord[0].x, gl_TexCoord[0].y));
+
+		gameplayLightsColor = ClassifyLight(lightsTexturePixel.rgb, lightsTexturePixel.a, true);
+		fgLightsColor = ClassifyLight(lightsTexturePixel.rgb * fgLightMaskTexturePixel.rgb, lightsTexturePixel.a, fgLightMaskTexturePixel.a > 0.0);
+		bkgLightsColor = ClassifyLight(lightsTexturePixel.rgb * bkgLightMaskTexturePixel.rgb, lightsTexturePixel.a, bkgLightMaskTexturePixel.a > 0.0);
 	}
 
 	//lightsTexturePixel.a = lightsTexturePixel.a * fgGameplayTexturePixel.a;
 
 	vec3 fragColor = skyboxTexturePixel.rgb;
 	fragColor = mix(fragColor.rgb, parallaxTexturePixel.rgb, parallaxTexturePixel.a);
-	fragColor = mix(fragColor.rgb, bkgTilesTexturePixel.rgb * bkgLightsTexturePixel.rgb, bkgTilesTexturePixel.a);
+	fragColor = mix(fragColor.rgb, bkgTilesTexturePixel.rgb * bkgLightsColor, bkgTilesTexturePixel.a);
 	fragColor = mix(fragColor.rgb, bkgTilesTexturePixel.rgb, fgTilesTexturePixel.a);
 	//fragColor = mix(fragColor.rgb, texturePixel.rgb, texturePixel.a);
-	fragColor = mix(fragColor.rgb, fgGameplayTexturePixel.rgb * gameplayLightsTexturePixel.rgb, fgGameplayTexturePixel.a);
-	fragColor = mix(fragColor.rgb, fgTilesTexturePixel.rgb * fgLightsTexturePixel.rgb, fgTilesTexturePixel.a);
+	fragColor = mix(fragColor.rgb, fgGameplayTexturePixel.rgb * gameplayLightsColor, fgGameplayTexturePixel.a);
+	fragColor = mix(fragColor.rgb, fgTilesTexturePixel.rgb * fgLightsColor, fgTilesTexturePixel.a);
 	fragColor = mix(fragColor.rgb, hudTexturePixel.rgb, hudTexturePixel.a);
 
 	gl_FragColor = vec4(fragColor, 1.0);
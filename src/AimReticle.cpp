@@ -11,7 +11,7 @@ AimReticle::AimReticle(std::shared_ptr<GameActor> in_target)
 void AimReticle::Initialize() {
 	GameActor::Initialize();
 	m_sprite = MakeSprite();
-	m_sprite->SetRenderLayer("hud");
+	m_sprite->SetRenderLayer(RL_Hud);
 	auto aimReticleMgr = GetWorld()->GetAimReticleManager();
 	aimReticleMgr->RegisterAimReticle(AsShared<AimReticle>());
 	auto target = m_target.lock();
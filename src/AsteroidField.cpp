@@ -20,7 +20,7 @@ void Asteroid::Initialize() {
 	m_sprite->SetPlayRate(0.0f);
 	m_sprite->SetComponentDrawOrder(m_drawOrder);
 	m_sprite->PlayAnim(m_animName, true, m_startFrame);
-	m_sprite->SetRenderLayer("parallax");
+	m_sprite->SetRenderLayer(RL_Parallax);
 }
 Task<> Asteroid::ManageActor() {
 	while(true) {
@@ -35,7 +35,6 @@ Task<> Bomb::ManageActor() {
 }
 void Bomb::TryDestroyTiles() {
 	auto collisionTiles = GetWorld()->GetCollisionTilesComp();
-	auto collisionLayer = collisionTiles->GetTileLayer();
 	auto worldTiles = GetWorld()->GetWorldTilesComp();
 	auto worldLayer = worldTiles->GetTileLayer();
 	auto bombGridPos = worldTiles->WorldPosToGridPos(GetWorldPos());
@@ -47,8 +46,8 @@ void Bomb::TryDestroyTiles() {
 
 		// Destroy relevant tiles
 		if(currentTileId == 54 || currentTileId == 279) { //< 54 and 279 are the breakable brick tiles
-			worldLayer->SetTile(offsetGridPos, 8); //< 8 is the first blank ID in the tileset (0 is a brick tile)
-			collisionLayer->SetTile(offsetGridPos, 0);
+			worldTiles->SetTile(offsetGridPos, 8); //< 8 is the first blank ID in the tileset (0 is a brick tile)
+			collisionTiles->SetTile(offsetGridPos, 0);
 			Transform destroyedTileTransform = { (offsetGridPos * gridSize) + Vec2i{gridSize / 2, gridSize / 2}, 0.0f, Vec2f::One };
 			Actor::Spawn<DestroyedTile>(GetWorld(), destroyedTileTransform, currentTileId);
 		}
@@ -52,6 +52,12 @@ void Character::CardinalUpdate(	Cardinals& in_blockCardinals, float sweepVal, Ve
 	collisionBox = collisionBox;
 	collisionBox.x += offset.x;
 	collisionBox.y += offset.y;
+
+	// Sweep all four directions at once (results are in the same Up/Down/Left/Right order as the cardinals)
+	auto probeResults = world->GetCollisionWorld()->ProbeCardinal(collisionBox, sweepVal, m_collisionMask);
+	const std::array<std::optional<Math::BoxSweepResults>, 4> cardinalSweepResults = { 
+		probeResults.m_up, probeResults.m_down, probeResults.m_left, probeResults.m_right 
+	};
 	for(auto& dir : in_blockCardinals.cardinals) {
 		displacement = cardinalDisplacements[cDispIdx];
 		// If a creature, check if its collision bounds are leaving the room bounds (if so, we'll bounce it back)
@@ -79,8 +85,7 @@ void Character::CardinalUpdate(	Cardinals& in_blockCardinals, float sweepVal, Ve
 			//DrawDebugBox(spawnerRoomCopy->bounds, sf::Color::Yellow);
 		}
 
-		// Do the sweep
-		auto colliderSweepResults = GetWorld()->GetCollisionWorld()->SweepBox(collisionBox, displacement);
+		const auto& colliderSweepResults = cardinalSweepResults[cDispIdx];
 		if(isLeavingRoom) {
 			dir = -1.0f;
 		}
@@ -118,11 +123,11 @@ Vec2f Character::Move(	const Vec2f& in_pos, bool in_teleport, float in_sweepVal,
 		currentDir.y = std::copysign(1.0f, newPos.y);
 	}
 
-	auto colliderSweepResults = GetWorld()->GetCollisionWorld()->SweepBox(collisionBox.TransformedBy(GetWorldTransform()), newPos);
+	auto colliderSweepResults = GetWorld()->GetCollisionWorld()->SweepBox(collisionBox.TransformedBy(GetWorldTransform()), newPos, m_collisionMask);
 	if(colliderSweepResults && !in_teleport) {
 		// If can go through breakable terrain and succeeds at doing so, don't block
 		if(in_breakStuff && TryDestroyTiles(in_pos, currentDir.Norm(), false)) {
-			colliderSweepResults = GetWorld()->GetCollisionWorld()->SweepBox(collisionBox.TransformedBy(GetWorldTransform()), newPos);
+			colliderSweepResults = GetWorld()->GetCollisionWorld()->SweepBox(collisionBox.TransformedBy(GetWorldTransform()), newPos, m_collisionMask);
 		}
 		// If blocked, revise target position accordingly and set Character to that new pos
 		if(colliderSweepResults) {
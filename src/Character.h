@@ -25,6 +25,10 @@ public:
 	Box2f GetCollisionBoxWorld() const { return m_worldCollisionBoxLocal.TransformedBy(GetWorldTransform()); };
 	const Cardinals& GetCardinals() const { return m_blockCardinals; }
 
+	// Collider categories (eCollisionLayer bits) that block this character's movement and cardinal probes
+	void SetCollisionMask(uint32_t in_mask) { m_collisionMask = in_mask; }
+	uint32_t GetCollisionMask() const { return m_collisionMask; }
+
 	// Updates a given Cardinals struct to reflect in which directions it's currently blocked, and at what distance
 	void CardinalUpdate(Cardinals& in_blockCardinals, float sweepVal = 0.01f, Vec2f offset = Vec2f::Zero, 
 						std::optional<Box2f> in_collisionBox = {}, std::shared_ptr<Creature> in_creature = {}) const;
@@ -36,4 +40,5 @@ protected:
 	Box2f m_worldCollisionBoxLocal = Box2f::FromBottomCenter(Vec2f{ 0.0f, -15.0f }, { 8.0f, 29.0f });
 	Box2f m_worldCollisionBoxLocalLedge = Box2f::FromBottomCenter(Vec2f{ 0.0f, -15.0f }, { 8.0f, 29.0f });
 	Cardinals m_blockCardinals;
+	uint32_t m_collisionMask = CL_World | CL_Enemy | CL_Pickup; //< World tiles, frozen creatures and pickup shells
 };
@@ -31,10 +31,12 @@
 Creature::Creature(std::shared_ptr<CreatureSpawner> in_spawner)
 	: m_spawner(in_spawner)
 {
+	SetActorType(eGameActorType::Creature);
 }
 Creature::Creature(std::shared_ptr<CreatureSpawner> in_spawner, bool in_bisMovingRight)
 	: m_spawner(in_spawner)
 {
+	SetActorType(eGameActorType::Creature);
 }
 void Creature::Initialize() {
 	Character::Initialize();
@@ -132,6 +134,7 @@ Task<> Creature::ManageActor() {
 					co_await Suspend();
 				}
 				auto collider = MakeCollider_Box(AsShared(), Transform::Identity, GetWorld()->GetCollisionWorld(), GetCollisionBoxLocal());
+				collider->SetCategory(CL_Enemy);
 				co_await WaitSeconds(m_freezeDuration).CancelIf([this] { return !m_bIsFrozen; }); //< 343 frames / 60 fps
 
 				// Flash to warn it's about to wake up
@@ -195,7 +198,7 @@ void Creature::SetupComponents() {
 	SetDamageInfo(1, DF_Enemy);
 	m_sprite = MakeSprite(Transform::Identity);
 	m_spriteLit = MakeSprite();
-	m_spriteLit->SetRenderLayer("lights");
+	m_spriteLit->SetRenderLayer(RL_Lights);
 	m_bUpdatesOffScreen = false;
 }
 void Creature::SetHitSensorBox(Vec2f in_dims) {
@@ -158,10 +158,10 @@ Task<> Blobber::ManageAI() {
 void Blobber::ExplodeAndDie() {
 	GetSpawner()->AwakenAll(); // Wake up the whole squad -- for REVENGE!
 	Actor::Spawn<ParticleSpawner>(GetWorld(), { GetWorldPos() },
-		g_debrisSpawnerSm1, std::nullopt, "Base");
+		&g_debrisSpawnerSm1, std::nullopt, "Base");
 	Actor::Spawn<ParticleSpawner>(GetWorld(), { GetWorldPos() },
-		g_emberSpawnerLg1, std::nullopt, "Base");
+		&g_emberSpawnerLg1, std::nullopt, "Base");
 	Actor::Spawn<ParticleSpawner>(GetWorld(), { GetWorldPos() },
-		g_emberSpawnerLg2, std::nullopt, "Base");
+		&g_emberSpawnerLg2, std::nullopt, "Base");
 	Creature::ExplodeAndDie();
 }
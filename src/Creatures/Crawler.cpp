@@ -42,19 +42,19 @@ void Crawler::Initialize() {
 void Crawler::ExplodeAndDie() {
 	if(ShouldChunksplode()) {
 		Actor::Spawn<ParticleSpawner>(GetWorld(), { GetWorldPos() },
-			g_debrisSpawnerLg1, std::nullopt, "Base");
+			&g_debrisSpawnerLg1, std::nullopt, "Base");
 		Actor::Spawn<ParticleSpawner>(GetWorld(), { GetWorldPos() },
-			g_emberSpawnerLg1, std::nullopt, "Base");
+			&g_emberSpawnerLg1, std::nullopt, "Base");
 		Actor::Spawn<ParticleSpawner>(GetWorld(), { GetWorldPos() },
-			g_emberSpawnerLg2, std::nullopt, "Base");
+			&g_emberSpawnerLg2, std::nullopt, "Base");
 	}
 	else {
 		Actor::Spawn<ParticleSpawner>(GetWorld(), { GetWorldPos() },
-			g_debrisSpawnerSm1, std::nullopt, "Base");
+			&g_debrisSpawnerSm1, std::nullopt, "Base");
 		Actor::Spawn<ParticleSpawner>(GetWorld(), { GetWorldPos() },
-			g_emberSpawnerLg1, std::nullopt, "Base");
+			&g_emberSpawnerLg1, std::nullopt, "Base");
 		Actor::Spawn<ParticleSpawner>(GetWorld(), { GetWorldPos() },
-			g_emberSpawnerLg2, std::nullopt, "Base");
+			&g_emberSpawnerLg2, std::nullopt, "Base");
 	}
 	Creature::ExplodeAndDie();
 }
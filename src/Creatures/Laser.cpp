@@ -4,6 +4,7 @@
 #include "ParticleSpawner.h"
 #include "Light.h"
 #include "Projectile.h"
+#include "ProjectileManager.h"
 #include "Engine/Components/SpriteComponent.h"
 #include "Engine/Components/ColliderComponent.h"
 #include "Algorithms.h"
@@ -157,7 +158,7 @@ Task<> Laser::ManageAI() {
 				targetDir = targetDir.RotateDeg(rotateIncrement);
 				m_sprite->SetWorldRot(targetDir.SignedAngleDeg());
 			}
-			auto bullet = Actor::Spawn<Projectile>(world, bulletTransform, g_creatureBulletDef, targetDir, m_bIsFacingRight ? 1 : -1);
+			auto bullet = world->GetProjectileManager()->SpawnPooled(bulletTransform, g_creatureBulletDef, targetDir, m_bIsFacingRight ? 1 : -1);
 			fireTimer = fireDelay;
 			DeferredDestroy();
 		}
@@ -192,19 +192,19 @@ Task<> Monopod::ManageAI() {
 void Monopod::ExplodeAndDie() {
 	if(ShouldChunksplode()) {
 		Actor::Spawn<ParticleSpawner>(GetWorld(), { GetWorldPos() },
-			g_debrisSpawnerLg1, std::nullopt, "Base");
+			&g_debrisSpawnerLg1, std::nullopt, "Base");
 		Actor::Spawn<ParticleSpawner>(GetWorld(), { GetWorldPos() },
-			g_emberSpawnerLg1, std::nullopt, "Base");
+			&g_emberSpawnerLg1, std::nullopt, "Base");
 		Actor::Spawn<ParticleSpawner>(GetWorld(), { GetWorldPos() },
-			g_emberSpawnerLg2, std::nullopt, "Base");
+			&g_emberSpawnerLg2, std::nullopt, "Base");
 	}
 	else {
 		Actor::Spawn<ParticleSpawner>(GetWorld(), { GetWorldPos() },
-			g_debrisSpawnerSm1, std::nullopt, "Base");
+			&g_debrisSpawnerSm1, std::nullopt, "Base");
 		Actor::Spawn<ParticleSpawner>(GetWorld(), { GetWorldPos() },
-			g_emberSpawnerLg1, std::nullopt, "Base");
+			&g_emberSpawnerLg1, std::nullopt, "Base");
 		Actor::Spawn<ParticleSpawner>(GetWorld(), { GetWorldPos() },
-			g_emberSpawnerLg2, std::nullopt, "Base");
+			&g_emberSpawnerLg2, std::nullopt, "Base");
 	}
 	Creature::ExplodeAndDie();
 }
\ No newline at end of file
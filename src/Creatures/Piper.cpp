@@ -86,13 +86,13 @@ void Piper::ExplodeAndDie() {
 	if(ShouldChunksplode()) {
 		auto icePaletteCheck = CheckFrozen() ? "Ice" : "Base";
 		Actor::Spawn<ParticleSpawner>(GetWorld(), { GetWorldPos() + Vec2f{ -4.0f, 4.0f } },
-			g_piperDeathExplosionDef0, Vec2f{ -1.72f, 3.0f }, icePaletteCheck);
+			&g_piperDeathExplosionDef0, Vec2f{ -1.72f, 3.0f }, icePaletteCheck);
 		Actor::Spawn<ParticleSpawner>(GetWorld(), { GetWorldPos() + Vec2f{ 4.0f, 4.0f } },
-			g_piperDeathExplosionDef1, Vec2f{ 1.72f, 3.0f }, icePaletteCheck);
+			&g_piperDeathExplosionDef1, Vec2f{ 1.72f, 3.0f }, icePaletteCheck);
 		Actor::Spawn<ParticleSpawner>(GetWorld(), { GetWorldPos() + Vec2f{ -4.0f, -4.0f } },
-			g_piperDeathExplosionDef2, Vec2f{ -1.72f, 1.75f }, icePaletteCheck);
+			&g_piperDeathExplosionDef2, Vec2f{ -1.72f, 1.75f }, icePaletteCheck);
 		Actor::Spawn<ParticleSpawner>(GetWorld(), { GetWorldPos() + Vec2f{ 4.0f, -4.0f } },
-			g_piperDeathExplosionDef3, Vec2f{ 1.72f, 1.75f }, icePaletteCheck);
+			&g_piperDeathExplosionDef3, Vec2f{ 1.72f, 1.75f }, icePaletteCheck);
 	}
 	Creature::ExplodeAndDie();
 }
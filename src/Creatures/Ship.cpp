@@ -63,14 +63,14 @@ void Ship::Initialize() {
 	m_blightSprite->PlayAnim("Util/Blank", true);
 	
 	m_jetSprite1 = MakeSprite(Transform::Identity);
-	m_jetSprite1->SetRenderLayer("hud");
+	m_jetSprite1->SetRenderLayer(RL_Hud);
 	m_jetSprite1->PlayAnim("JetFire/Idle", true);
 	m_jetSprite1->SetPlayRate(0.5f);
 	m_jetSprite1->SetWorldPos(GetWorldPos() + Vec2f{ -35.0f, -51.0f });
 	m_jetSprite1->SetComponentDrawOrder(1010);
 	
 	m_jetSprite2 = MakeSprite(Transform::Identity);
-	m_jetSprite2->SetRenderLayer("hud");
+	m_jetSprite2->SetRenderLayer(RL_Hud);
 	m_jetSprite2->PlayAnim("JetFire/Idle", true);
 	m_jetSprite2->SetPlayRate(0.5f);
 	m_jetSprite2->SetWorldPos(GetWorldPos() + Vec2f{ 35.0f, -51.0f });
@@ -184,6 +184,8 @@ void Ship::SetSolid(bool in_state) {
 										GetWorld()->GetCollisionWorld(), m_worldCollisionBoxLocalFrozen1);
 		m_collider2 = MakeCollider_Box(	AsShared(), Transform::Identity,
 										GetWorld()->GetCollisionWorld(), m_worldCollisionBoxLocalFrozen2);
+		m_collider->SetCategory(CL_Enemy);
+		m_collider2->SetCategory(CL_Enemy);
 	}
 	else {
 		m_collider = {};
@@ -202,13 +204,13 @@ void Ship::ExplodeAndDie() {
 	if(ShouldChunksplode()) {
 		auto icePaletteCheck = CheckFrozen() ? "Ice" : "Base";
 		Actor::Spawn<ParticleSpawner>(	GetWorld(), { GetWorldPos() + Vec2f{ -4.0f, 4.0f } }, 
-										g_dropperDeathExplosionDef0, Vec2f{ -1.72f, 3.0f }, icePaletteCheck);
+										&g_dropperDeathExplosionDef0, Vec2f{ -1.72f, 3.0f }, icePaletteCheck);
 		Actor::Spawn<ParticleSpawner>(	GetWorld(), { GetWorldPos() + Vec2f{ 4.0f, 4.0f } },  
-										g_dropperDeathExplosionDef1, Vec2f{ 1.72f, 3.0f }, icePaletteCheck);
+										&g_dropperDeathExplosionDef1, Vec2f{ 1.72f, 3.0f }, icePaletteCheck);
 		Actor::Spawn<ParticleSpawner>(	GetWorld(), { GetWorldPos() + Vec2f{ -4.0f, -4.0f } },
-										g_dropperDeathExplosionDef2, Vec2f{ -1.72f, 1.75f }, icePaletteCheck);
+										&g_dropperDeathExplosionDef2, Vec2f{ -1.72f, 1.75f }, icePaletteCheck);
 		Actor::Spawn<ParticleSpawner>(	GetWorld(), { GetWorldPos() + Vec2f{ 4.0f, -4.0f } }, 
-										g_dropperDeathExplosionDef3, Vec2f{ 1.72f, 1.75f }, icePaletteCheck);
+										&g_dropperDeathExplosionDef3, Vec2f{ 1.72f, 1.75f }, icePaletteCheck);
 	}
 	Creature::ExplodeAndDie();
 }
@@ -20,9 +20,7 @@ Task<> DestroyedTile::ManageActor() {
 	while(true) {
 		//DrawDebugPoint(GetWorldPos());
 		auto collisionTiles = GetWorld()->GetCollisionTilesComp();
-		auto collisionLayer = collisionTiles->GetTileLayer();
 		auto worldTiles = GetWorld()->GetWorldTilesComp();
-		auto worldLayer = worldTiles->GetTileLayer();
 		auto tileGridPos = worldTiles->WorldPosToGridPos(GetWorldPos());
 
 		// Dissolve brick tile art
@@ -36,8 +34,8 @@ Task<> DestroyedTile::ManageActor() {
 		co_await WaitSeconds(0.08333f);
 
 		// Set the visual and collision tiles back to initial id's
-		worldLayer->SetTile(tileGridPos, m_tileId);
-		collisionLayer->SetTile(tileGridPos, 237); // 237 is the blocking tile (red diagonal lines)
+		worldTiles->SetTile(tileGridPos, m_tileId);
+		collisionTiles->SetTile(tileGridPos, 237); // 237 is the blocking tile (red diagonal lines)
 		DeferredDestroy();
 	}
 }
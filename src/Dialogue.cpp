@@ -57,29 +57,29 @@ void DialogueSpeaker::Initialize() {
 	// Setup sprites
 	SetDrawLayer(4);
 	m_portrait = MakeSprite(Transform::Identity);
-	m_portrait->SetRenderLayer("hud");
+	m_portrait->SetRenderLayer(RL_Hud);
 	m_textBkg = MakeSprite(Transform::Identity);
-	m_textBkg->SetRenderLayer("hud");
+	m_textBkg->SetRenderLayer(RL_Hud);
 	m_portrait->SetColor(255, 255, 255, 0);
 	m_textBkg->SetColor(255, 255, 255, 0);
 	m_textBkg->SetRelativePos({ 170.0f, -12.0f });
 	m_textBkg->PlayAnim(m_def->m_dialogueBkgFilename, true);
 	m_advancePrompt = MakeSprite({ 265.0f, -31.0f });
-	m_advancePrompt->SetRenderLayer("hud");
+	m_advancePrompt->SetRenderLayer(RL_Hud);
 	m_advancePrompt->PlayAnim("FaceButtonPrompt/DiamondLeft", true);
 	m_advancePrompt->SetColor(255, 255, 255, 0);
 
 	// Setup text
 	m_textHeading = MakeText(Transform::Identity);
-	m_textHeading->SetRenderLayer("hud");
+	m_textHeading->SetRenderLayer(RL_Hud);
 	m_textHeading->SetFont("Pixica-Bold");
 	m_textHeading->SetFontSizePixels(16);
 	m_dialogueLine1 = MakeText({ 73.0f, -15.0f });
-	m_dialogueLine1->SetRenderLayer("hud");
+	m_dialogueLine1->SetRenderLayer(RL_Hud);
 	m_dialogueLine1->SetFont("cc.yal.6w4");
 	m_dialogueLine1->SetFontSizePixels(16);
 	m_dialogueLine2 = MakeText({ 73.0f, -25.0f });
-	m_dialogueLine2->SetRenderLayer("hud");
+	m_dialogueLine2->SetRenderLayer(RL_Hud);
 	m_dialogueLine2->SetFont("cc.yal.6w4");
 	m_dialogueLine2->SetFontSizePixels(16);
 	m_textHeading->SetColor(m_def->m_headingColor);
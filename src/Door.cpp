@@ -36,6 +36,7 @@ Door::Door(eDoorColor in_color, int32_t in_objId, bool in_bIsVertical)
 	, m_objId(in_objId)
 	, m_bIsVertical(in_bIsVertical)
 {
+	SetActorType(eGameActorType::Door);
 }
 void Door::Initialize() {
 	GameActor::Initialize();
@@ -61,11 +62,11 @@ void Door::Initialize() {
 	if(m_color == eDoorColor::Red) {
 		m_doorSpriteCenter->PlayAnim("DoorCenter/Red", false);
 	}
-	m_doorSpriteCenter->SetRenderLayer("fgTiles");
+	m_doorSpriteCenter->SetRenderLayer(RL_FgTiles);
 	//m_doorSpriteCenter->SetComponentDrawOrder(10);
 	m_doorSpriteCenterLit = MakeSprite(Transform::Identity);
 	m_doorSpriteCenterLit->PlayAnim("DoorCenter/BlueLit", false);
-	m_doorSpriteCenterLit->SetRenderLayer("fgLightMask");
+	m_doorSpriteCenterLit->SetRenderLayer(RL_FgLightMask);
 
 	// Set up blocking tiles
 	auto pos = GetWorldPos();
@@ -313,10 +314,9 @@ void Door::OnUnTouchPlayer(std::shared_ptr<Player> in_player) {
 void Door::SetDoorTileBlocking(bool in_bIsBlocking) {
 	auto tileIdx = in_bIsBlocking ? 2 : 0;
 	auto collisionTiles = GetWorld()->GetCollisionTilesComp();
-	auto collisionLayer = collisionTiles->GetTileLayer();
 	for(const auto& pos : m_tileLocations) {
 		auto gridPos = collisionTiles->WorldPosToGridPos(pos);
-		collisionLayer->SetTile(gridPos, tileIdx);
+		collisionTiles->SetTile(gridPos, tileIdx);
 	}
 }
 bool Door::DoorwayClear() {
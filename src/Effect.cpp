@@ -18,7 +18,7 @@ void Effect::Initialize() {
 
 	// Setup sprite
 	m_effectSprite = MakeSprite(Transform::Identity);
-	m_effectSprite->SetRenderLayer("hud");
+	m_effectSprite->SetRenderLayer(RL_Hud);
 
 	// Piggyback on ProjectileManager's functionality to handle object registration
 	auto projMgr = GetWorld()->GetProjectileManager();
@@ -0,0 +1,355 @@
+#pragma once
+
+#include <vector>
+
+#include "Box.h"
+#include "MathCore.h"
+#include "TasksConfig.h"
+
+///////////////////////////////////////////////////////
+// AABBTree:
+// a dynamic bounding volume hierarchy (closely follows Box2D's b2DynamicTree)
+// Each proxy is stored with a "fat" box (its tight box grown by a margin), so small movements don't require re-inserting it.
+// Queries report every proxy whose fat box overlaps the query box -- callers still need to do their own exact tests.
+template<typename T>
+class AABBTree
+{
+public:
+	static constexpr int32_t NullNode = -1;
+
+	AABBTree(float in_fatMargin = 4.0f) : m_fatMargin(in_fatMargin) {}
+
+	// Creates a leaf for in_box and returns its proxy id
+	int32_t CreateProxy(Box2f in_box, T in_userData) {
+		const int32_t proxyId = AllocateNode();
+		m_nodes[proxyId].box = Fatten(in_box);
+		m_nodes[proxyId].userData = std::move(in_userData);
+		m_nodes[proxyId].height = 0;
+		InsertLeaf(proxyId);
+		++m_proxyCount;
+		return proxyId;
+	}
+
+	void DestroyProxy(int32_t in_proxyId) {
+		SQUID_RUNTIME_CHECK(IsValidProxy(in_proxyId), "AABBTree::DestroyProxy() called with invalid proxy id");
+		RemoveLeaf(in_proxyId);
+		FreeNode(in_proxyId);
+		--m_proxyCount;
+	}
+
+	// Updates a proxy's box -- only re-inserts it (and returns true) if in_box has left the proxy's fat box.
+	// in_displacement is how far the box moved since the last update: the new fat box is stretched in that direction,
+	// so something moving at a steady speed stays inside it for several updates instead of being re-inserted every time
+	bool MoveProxy(int32_t in_proxyId, Box2f in_box, Vec2f in_displacement = Vec2f::Zero) {
+		SQUID_RUNTIME_CHECK(IsValidProxy(in_proxyId), "AABBTree::MoveProxy() called with invalid proxy id");
+		const Box2f box = Normalized(in_box);
+		const Box2f fatBox = Fatten(box, in_displacement);
+		const Box2f& treeBox = m_nodes[in_proxyId].box;
+		if(Contains(treeBox, box)) {
+			// still inside, but re-insert anyway if the tree box has become much bigger than needed (eg after a sudden stop)
+			const Vec2f hugeMargin{ 4.0f * m_fatMargin, 4.0f * m_fatMargin };
+			const Box2f hugeBox = Box2f::FromCorners(fatBox.GetMin() - hugeMargin, fatBox.GetMax() + hugeMargin);
+			if(Contains(hugeBox, treeBox)) {
+				return false;
+			}
+		}
+		RemoveLeaf(in_proxyId);
+		m_nodes[in_proxyId].box = fatBox;
+		InsertLeaf(in_proxyId);
+		++m_reinsertCount;
+		return true;
+	}
+
+	const T& GetUserData(int32_t in_proxyId) const { return m_nodes[in_proxyId].userData; }
+	T& GetUserData(int32_t in_proxyId) { return m_nodes[in_proxyId].userData; }
+	Box2f GetFatBox(int32_t in_proxyId) const { return m_nodes[in_proxyId].box; }
+	bool FatBoxOverlaps(int32_t in_proxyId, Box2f in_box) const { return Overlaps(m_nodes[in_proxyId].box, Normalized(in_box)); }
+	int32_t GetProxyCount() const { return m_proxyCount; }
+	int32_t GetReinsertCount() const { return m_reinsertCount; } //< Total MoveProxy() calls that had to re-insert (for profiling)
+	int32_t GetHeight() const { return m_root == NullNode ? 0 : m_nodes[m_root].height; }
+
+	// Calls in_func(proxyId) for every proxy whose fat box overlaps in_box -- in_func returns false to stop the query early
+	template<typename tFunc>
+	void Query(Box2f in_box, tFunc&& in_func) const {
+		if(m_root == NullNode) {
+			return;
+		}
+		in_box = Normalized(in_box);
+		int32_t stack[s_maxQueryStack];
+		int32_t stackSize = 0;
+		stack[stackSize++] = m_root;
+		while(stackSize > 0) {
+			const int32_t nodeId = stack[--stackSize];
+			const Node& node = m_nodes[nodeId];
+			if(!Overlaps(node.box, in_box)) {
+				continue;
+			}
+			if(node.IsLeaf()) {
+				if(!in_func(nodeId)) {
+					return;
+				}
+			}
+			else {
+				SQUID_RUNTIME_CHECK(stackSize + 2 <= s_maxQueryStack, "AABBTree query stack overflow");
+				stack[stackSize++] = node.child1;
+				stack[stackSize++] = node.child2;
+			}
+		}
+	}
+
+private:
+	struct Node
+	{
+		Box2f box = {};
+		T userData = {};
+		int32_t parent = NullNode; //< Doubles as the "next" link while the node is on the free list
+		int32_t child1 = NullNode;
+		int32_t child2 = NullNode;
+		int32_t height = -1; //< 0 for leaves, -1 for free nodes
+
+		bool IsLeaf() const { return child1 == NullNode; }
+	};
+	static constexpr int32_t s_maxQueryStack = 256;
+	static constexpr float s_displacementMultiplier = 4.0f; //< How many updates' worth of movement the fat box is stretched by
+
+	// Box helpers (boxes stored in the tree always have non-negative dims)
+	static Box2f Normalized(Box2f in_box) {
+		return Box2f::FromCorners(Math::Min(in_box.GetMin(), in_box.GetMax()), Math::Max(in_box.GetMin(), in_box.GetMax()));
+	}
+	static Box2f Union(Box2f in_a, Box2f in_b) {
+		return Box2f::FromCorners(Math::Min(in_a.GetMin(), in_b.GetMin()), Math::Max(in_a.GetMax(), in_b.GetMax()));
+	}
+	static float Perimeter(Box2f in_box) { return 2.0f * (in_box.w + in_box.h); }
+	static bool Contains(Box2f in_outer, Box2f in_inner) {
+		return in_outer.x <= in_inner.x && in_outer.y <= in_inner.y && in_outer.GetRight() >= in_inner.GetRight() && in_outer.GetTop() >= in_inner.GetTop();
+	}
+	static bool Overlaps(Box2f in_a, Box2f in_b) {
+		return in_a.x <= in_b.GetRight() && in_b.x <= in_a.GetRight() && in_a.y <= in_b.GetTop() && in_b.y <= in_a.GetTop();
+	}
+	Box2f Fatten(Box2f in_box, Vec2f in_displacement = Vec2f::Zero) const {
+		Box2f box = Normalized(in_box);
+		const Vec2f margin{ m_fatMargin, m_fatMargin };
+		const Vec2f predicted = in_displacement * s_displacementMultiplier;
+		return Box2f::FromCorners(
+			box.GetMin() - margin + Math::Min(predicted, Vec2f::Zero), 
+			box.GetMax() + margin + Math::Max(predicted, Vec2f::Zero));
+	}
+
+	bool IsValidProxy(int32_t in_proxyId) const {
+		return in_proxyId >= 0 && in_proxyId < (int32_t)m_nodes.size() && m_nodes[in_proxyId].height == 0;
+	}
+
+	// Node pool
+	int32_t AllocateNode() {
+		if(m_freeList == NullNode) {
+			m_nodes.push_back(Node{});
+			return (int32_t)m_nodes.size() - 1;
+		}
+		const int32_t nodeId = m_freeList;
+		m_freeList = m_nodes[nodeId].parent;
+		m_nodes[nodeId] = Node{};
+		return nodeId;
+	}
+	void FreeNode(int32_t in_nodeId) {
+		m_nodes[in_nodeId] = Node{};
+		m_nodes[in_nodeId].parent = m_freeList;
+		m_freeList = in_nodeId;
+	}
+
+	// Tree maintenance
+	void InsertLeaf(int32_t in_leaf) {
+		if(m_root == NullNode) {
+			m_root = in_leaf;
+			m_nodes[m_root].parent = NullNode;
+			return;
+		}
+
+		// Find the best sibling for this leaf (surface area heuristic, using perimeter in 2D)
+		const Box2f leafBox = m_nodes[in_leaf].box;
+		int32_t index = m_root;
+		while(!m_nodes[index].IsLeaf()) {
+			const Node& node = m_nodes[index];
+			const float area = Perimeter(node.box);
+			const float combinedArea = Perimeter(Union(node.box, leafBox));
+
+			// Cost of creating a new parent for this node and the new leaf, and the minimum cost of pushing the leaf further down
+			const float cost = 2.0f * combinedArea;
+			const float inheritanceCost = 2.0f * (combinedArea - area);
+			const auto DescendCost = [this, &leafBox, inheritanceCost](int32_t in_child) {
+				const Node& child = m_nodes[in_child];
+				const float unionArea = Perimeter(Union(leafBox, child.box));
+				return (child.IsLeaf() ? unionArea : unionArea - Perimeter(child.box)) + inheritanceCost;
+			};
+			const float cost1 = DescendCost(node.child1);
+			const float cost2 = DescendCost(node.child2);
+			if(cost < cost1 && cost < cost2) {
+				break;
+			}
+			index = (cost1 < cost2) ? node.child1 : node.child2;
+		}
+		const int32_t sibling = index;
+
+		// Create a new parent for the sibling and the leaf
+		const int32_t oldParent = m_nodes[sibling].parent;
+		const int32_t newParent = AllocateNode();
+		m_nodes[newParent].parent = oldParent;
+		m_nodes[newParent].box = Union(leafBox, m_nodes[sibling].box);
+		m_nodes[newParent].height = m_nodes[sibling].height + 1;
+		if(oldParent != NullNode) {
+			if(m_nodes[oldParent].child1 == sibling) {
+				m_nodes[oldParent].child1 = newParent;
+			}
+			else {
+				m_nodes[oldParent].child2 = newParent;
+			}
+		}
+		else {
+			m_root = newParent;
+		}
+		m_nodes[newParent].child1 = sibling;
+		m_nodes[newParent].child2 = in_leaf;
+		m_nodes[sibling].parent = newParent;
+		m_nodes[in_leaf].parent = newParent;
+
+		// Walk back up the tree fixing heights and boxes
+		RefitAncestors(m_nodes[in_leaf].parent);
+	}
+	void RemoveLeaf(int32_t in_leaf) {
+		if(in_leaf == m_root) {
+			m_root = NullNode;
+			return;
+		}
+		const int32_t parent = m_nodes[in_leaf].parent;
+		const int32_t grandParent = m_nodes[parent].parent;
+		const int32_t sibling = (m_nodes[parent].child1 == in_leaf) ? m_nodes[parent].child2 : m_nodes[parent].child1;
+		if(grandParent != NullNode) {
+			// Destroy the parent and connect the sibling to the grandparent
+			if(m_nodes[grandParent].child1 == parent) {
+				m_nodes[grandParent].child1 = sibling;
+			}
+			else {
+				m_nodes[grandParent].child2 = sibling;
+			}
+			m_nodes[sibling].parent = grandParent;
+			FreeNode(parent);
+			RefitAncestors(grandParent);
+		}
+		else {
+			m_root = sibling;
+			m_nodes[sibling].parent = NullNode;
+			FreeNode(parent);
+		}
+		m_nodes[in_leaf].parent = NullNode;
+	}
+	void RefitAncestors(int32_t in_index) {
+		while(in_index != NullNode) {
+			in_index = Balance(in_index);
+			Node& node = m_nodes[in_index];
+			node.height = 1 + Math::Max(m_nodes[node.child1].height, m_nodes[node.child2].height);
+			node.box = Union(m_nodes[node.child1].box, m_nodes[node.child2].box);
+			in_index = node.parent;
+		}
+	}
+
+	// Performs a left or right rotation if node A is imbalanced -- returns the new root index of this subtree
+	int32_t Balance(int32_t in_iA) {
+		Node& A = m_nodes[in_iA];
+		if(A.IsLeaf() || A.height < 2) {
+			return in_iA;
+		}
+		const int32_t iB = A.child1;
+		const int32_t iC = A.child2;
+		Node& B = m_nodes[iB];
+		Node& C = m_nodes[iC];
+		const int32_t balance = C.height - B.height;
+
+		// Rotate C up
+		if(balance > 1) {
+			const int32_t iF = C.child1;
+			const int32_t iG = C.child2;
+			Node& F = m_nodes[iF];
+			Node& G = m_nodes[iG];
+
+			// Swap A and C
+			C.child1 = in_iA;
+			C.parent = A.parent;
+			A.parent = iC;
+			ReplaceChild(C.parent, in_iA, iC);
+
+			// Rotate
+			if(F.height > G.height) {
+				C.child2 = iF;
+				A.child2 = iG;
+				G.parent = in_iA;
+				A.box = Union(B.box, G.box);
+				C.box = Union(A.box, F.box);
+				A.height = 1 + Math::Max(B.height, G.height);
+				C.height = 1 + Math::Max(A.height, F.height);
+			}
+			else {
+				C.child2 = iG;
+				A.child2 = iF;
+				F.parent = in_iA;
+				A.box = Union(B.box, F.box);
+				C.box = Union(A.box, G.box);
+				A.height = 1 + Math::Max(B.height, F.height);
+				C.height = 1 + Math::Max(A.height, G.height);
+			}
+			return iC;
+		}
+
+		// Rotate B up
+		if(balance < -1) {
+			const int32_t iD = B.child1;
+			const int32_t iE = B.child2;
+			Node& D = m_nodes[iD];
+			Node& E = m_nodes[iE];
+
+			// Swap A and B
+			B.child1 = in_iA;
+			B.parent = A.parent;
+			A.parent = iB;
+			ReplaceChild(B.parent, in_iA, iB);
+
+			// Rotate
+			if(D.height > E.height) {
+				B.child2 = iD;
+				A.child1 = iE;
+				E.parent = in_iA;
+				A.box = Union(C.box, E.box);
+				B.box = Union(A.box, D.box);
+				A.height = 1 + Math::Max(C.height, E.height);
+				B.height = 1 + Math::Max(A.height, D.height);
+			}
+			else {
+				B.child2 = iE;
+				A.child1 = iD;
+				D.parent = in_iA;
+				A.box = Union(C.box, D.box);
+				B.box = Union(A.box, E.box);
+				A.height = 1 + Math::Max(C.height, D.height);
+				B.height = 1 + Math::Max(A.height, E.height);
+			}
+			return iB;
+		}
+		return in_iA;
+	}
+	void ReplaceChild(int32_t in_parent, int32_t in_oldChild, int32_t in_newChild) {
+		if(in_parent == NullNode) {
+			m_root = in_newChild;
+		}
+		else if(m_nodes[in_parent].child1 == in_oldChild) {
+			m_nodes[in_parent].child1 = in_newChild;
+		}
+		else {
+			m_nodes[in_parent].child2 = in_newChild;
+		}
+	}
+
+	std::vector<Node> m_nodes;
+	int32_t m_root = NullNode;
+	int32_t m_freeList = NullNode;
+	int32_t m_proxyCount = 0;
+	int32_t m_reinsertCount = 0;
+	float m_fatMargin = 4.0f;
+};
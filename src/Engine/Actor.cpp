@@ -10,6 +10,7 @@
 #include "Engine/PhysicsSystem.h"
 #include "Engine/TileMap.h"
 #include "Engine/Polygon.h"
+#include "Engine/SortUtils.h"
 
 //--- Actor ---//
 Actor::Actor()
@@ -143,17 +144,42 @@ void Actor::Draw()
 {
 	if (m_bHidden) return;
 
-	// Sort draw components
-	auto drawCompList = m_drawComps;
-	std::stable_sort(drawCompList.begin(), drawCompList.end(), [](auto lhs, auto rhs) { return lhs->GetDrawOrder() < rhs->GetDrawOrder(); });
-	for(auto drawComp : drawCompList)
+	// Draw components are kept in draw order, so they only need re-sorting after a draw order change
+	if(m_bDrawCompOrderDirty)
 	{
+		InsertionSort(m_drawComps.begin(), m_drawComps.end(), [](const auto& lhs, const auto& rhs) {
+			return lhs->m_drawOrder != rhs->m_drawOrder ? lhs->m_drawOrder < rhs->m_drawOrder : lhs->m_drawSeq < rhs->m_drawSeq;
+		});
+		m_bDrawCompOrderDirty = false;
+	}
+	const size_t numDrawComps = m_drawComps.size(); // components made while drawing are drawn from the next frame on
+	for(size_t drawCompIdx = 0; drawCompIdx < numDrawComps; ++drawCompIdx)
+	{
+		auto drawComp = m_drawComps[drawCompIdx];
 		if(IsAlive(drawComp) && !drawComp->GetHidden())
 		{
 			drawComp->Draw();
 		}
 	}
 }
+void Actor::SetDrawLayerValue(int32_t in_drawLayer)
+{
+	if(m_drawLayer != in_drawLayer)
+	{
+		m_drawLayer = in_drawLayer;
+		GameBase::Get()->MarkDrawOrderDirty();
+	}
+}
+void Actor::AddDrawComponent(std::shared_ptr<DrawComponent> in_drawComp)
+{
+	// Appending keeps the list sorted unless a component with a higher draw order is already last (the new one has the highest seq)
+	in_drawComp->m_drawSeq = m_nextDrawCompSeq++;
+	if(!m_drawComps.empty() && m_drawComps.back()->m_drawOrder > in_drawComp->m_drawOrder)
+	{
+		m_bDrawCompOrderDirty = true;
+	}
+	m_drawComps.push_back(in_drawComp);
+}
 void Actor::AddActorDependency(std::shared_ptr<Actor> in_actor)
 {
 	m_actorDeps.push_back(in_actor);
@@ -192,40 +218,22 @@ std::shared_ptr<BodyComponent> Actor::MakeBody(bool in_destroyOldRoot)
 }
 std::shared_ptr<SpriteComponent> Actor::MakeSprite(const Transform& in_transform)
 {
-	auto sprite = SpawnWithInit<SpriteComponent>(in_transform, [this](auto in_comp) {
-		in_comp->SetActor(AsShared<Actor>());
-	});
-	sprite->SetAttachParent(m_rootSceneComp, false);
-	m_drawComps.push_back(sprite);
-	return sprite;
+	return MakeDrawComponent<SpriteComponent>(in_transform);
 }
 std::shared_ptr<ShapeComponent> Actor::MakeShape(const Polygon& in_polygon, const Transform& in_transform)
 {
-	auto shape = SpawnWithInit<ShapeComponent>(in_transform, [this](auto in_comp) {
-		in_comp->SetActor(AsShared<Actor>());
-	});
-	shape->SetAttachParent(m_rootSceneComp, false);
+	auto shape = MakeDrawComponent<ShapeComponent>(in_transform);
 	shape->SetPolygon(in_polygon);
-	m_drawComps.push_back(shape);
 	return shape;
 }
 std::shared_ptr<TilesComponent> Actor::MakeTiles(std::shared_ptr<TileLayer> in_tileLayer, const Transform& in_transform)
 {
-	auto tiles = SpawnWithInit<TilesComponent>(in_transform, [this](auto in_comp) {
-		in_comp->SetActor(AsShared<Actor>());
-	});
-	tiles->SetAttachParent(m_rootSceneComp, false);
+	auto tiles = MakeDrawComponent<TilesComponent>(in_transform);
 	tiles->SetTileLayer(in_tileLayer);
-	m_drawComps.push_back(tiles);
 	return tiles;
 }
 std::shared_ptr<TextComponent> Actor::MakeText(const Transform& in_transform)
 {
-	auto text = SpawnWithInit<TextComponent>(in_transform, [this](auto in_comp) {
-		in_comp->SetActor(AsShared<Actor>());
-	});
-	text->SetAttachParent(m_rootSceneComp, false);
-	m_drawComps.push_back(text);
-	return text;
+	return MakeDrawComponent<TextComponent>(in_transform);
 }
 
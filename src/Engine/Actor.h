@@ -78,7 +78,7 @@ public:
 
 	// Draw ordering
 	template <typename tDrawLayer>
-	void SetDrawLayer(tDrawLayer in_drawLayer) { m_drawLayer = (int32_t)in_drawLayer; }
+	void SetDrawLayer(tDrawLayer in_drawLayer) { SetDrawLayerValue((int32_t)in_drawLayer); }
 	template <typename tDrawLayer = int32_t>
 	tDrawLayer GetDrawLayer() const { return (tDrawLayer)m_drawLayer; }
 
@@ -86,33 +86,33 @@ public:
 	void SetHidden(bool in_bHidden) { m_bHidden = in_bHidden; }
 	bool GetHidden() const { return m_bHidden; }
 
-	// Spawn functions
+	// Spawn functions (arguments are forwarded to tActor's constructor, see Object::Make())
 	template <typename tActor, typename... Args>
-	static std::shared_ptr<tActor> Spawn(std::shared_ptr<Object> in_owner, const Transform& in_worldTransform, Args... args)
+	static std::shared_ptr<tActor> Spawn(const std::shared_ptr<Object>& in_owner, const Transform& in_worldTransform, Args&&... args)
 	{
-		auto actor = Object::MakeWithInit<tActor>(in_owner, [&in_worldTransform](auto actor) {
+		auto actor = Object::MakeWithInit<tActor>(in_owner, [&in_worldTransform](const std::shared_ptr<tActor>& actor) {
 			actor->SetWorldTransform(in_worldTransform);
 		}, std::forward<Args>(args)...);
 		return actor;
 	}
 	template <typename tActor, typename... Args>
-	std::shared_ptr<tActor> Spawn(const Transform& in_worldTransform, Args... args)
+	std::shared_ptr<tActor> Spawn(const Transform& in_worldTransform, Args&&... args)
 	{
 		return Actor::Spawn<tActor>(AsShared(), in_worldTransform, std::forward<Args>(args)...);
 	}
-	template <typename tActor, typename... Args>
-	static std::shared_ptr<tActor> SpawnWithInit(std::shared_ptr<Object> in_owner, const Transform& in_worldTransform, std::function<void(std::shared_ptr<tActor>)> in_initFunc, Args... args)
+	template <typename tActor, typename tInitFunc, typename... Args>
+	static std::shared_ptr<tActor> SpawnWithInit(const std::shared_ptr<Object>& in_owner, const Transform& in_worldTransform, tInitFunc&& in_initFunc, Args&&... args)
 	{
-		auto actor = Object::MakeWithInit<tActor>(in_owner, [&in_worldTransform, &in_initFunc](auto actor) {
+		auto actor = Object::MakeWithInit<tActor>(in_owner, [&in_worldTransform, &in_initFunc](const std::shared_ptr<tActor>& actor) {
 			actor->SetWorldTransform(in_worldTransform);
 			in_initFunc(actor);
 		}, std::forward<Args>(args)...);
 		return actor;
 	}
-	template <typename tActor, typename... Args>
-	std::shared_ptr<tActor> SpawnWithInit(const Transform& in_worldTransform, std::function<void(std::shared_ptr<tActor>)> in_initFunc, Args... args)
+	template <typename tActor, typename tInitFunc, typename... Args>
+	std::shared_ptr<tActor> SpawnWithInit(const Transform& in_worldTransform, tInitFunc&& in_initFunc, Args&&... args)
 	{
-		return Actor::SpawnWithInit<tActor>(AsShared(), in_worldTransform, std::move(in_initFunc), std::forward<Args>(args)...);
+		return Actor::SpawnWithInit<tActor>(AsShared(), in_worldTransform, std::forward<tInitFunc>(in_initFunc), std::forward<Args>(args)...);
 	}
 
 	// Component factories
@@ -121,6 +121,16 @@ public:
 	std::shared_ptr<ShapeComponent> MakeShape(const Polygon& in_polygon, const Transform& in_transform = Transform::Identity);
 	std::shared_ptr<TilesComponent> MakeTiles(std::shared_ptr<TileLayer> in_tileLayer, const Transform& in_transform = Transform::Identity);
 	std::shared_ptr<TextComponent> MakeText(const Transform& in_transform = Transform::Identity);
+	template <typename tDrawComp>
+	std::shared_ptr<tDrawComp> MakeDrawComponent(const Transform& in_transform = Transform::Identity) // any other draw component, made and drawn like the ones above
+	{
+		auto drawComp = SpawnWithInit<tDrawComp>(in_transform, [this](auto in_comp) {
+			in_comp->SetActor(AsShared<Actor>());
+		});
+		drawComp->SetAttachParent(m_rootSceneComp, false);
+		AddDrawComponent(drawComp);
+		return drawComp;
+	}
 
 protected:
 	TaskManager m_taskMgr;
@@ -128,9 +138,13 @@ protected:
 
 private:
 	friend class GameBase;
+	friend class DrawComponent;
 	std::vector<std::weak_ptr<Actor>>& GetActorDependencies() { return m_actorDeps; }
 	void UpdateWithId(uint32_t in_updateId);
 	void SetRootSceneComponent(std::shared_ptr<SceneComponent> in_rootSceneComp);
+	void SetDrawLayerValue(int32_t in_drawLayer);
+	void AddDrawComponent(std::shared_ptr<DrawComponent> in_drawComp);
+	void MarkDrawCompOrderDirty() { m_bDrawCompOrderDirty = true; }
 
 	// Time stream
 	eTimeStream m_timeStream = eTimeStream::Game;
@@ -144,5 +158,8 @@ private:
 	std::shared_ptr<SceneComponent> m_rootSceneComp;
 	bool m_bHidden = false;
 	int32_t m_drawLayer = 0;
-	std::vector<std::shared_ptr<DrawComponent>> m_drawComps;
+	uint32_t m_drawSeq = 0; // registration order, breaks ties between actors on the same draw layer
+	std::vector<std::shared_ptr<DrawComponent>> m_drawComps; // kept sorted by (draw order, m_drawSeq), re-sorted in Draw() when m_bDrawCompOrderDirty is set
+	uint32_t m_nextDrawCompSeq = 0;
+	bool m_bDrawCompOrderDirty = false;
 };
@@ -2,17 +2,27 @@
 #include "Engine/Components/ColliderComponent.h"
 
 
-
-std::optional<Math::BoxSweepResults> CollisionWorld::SweepBox(Box2f in_boxToSweep, Vec2f in_sweepVec) const
+static Box2f GetSweptBounds(Box2f in_box, Vec2f in_sweepVec)
 {
-	//ClearInvalidColliders();
+	Box2f sweptBounds = in_box;
+	sweptBounds.SetMin(in_box.GetMin() + Vec2f{ Math::Min(in_sweepVec.x, 0.0f), Math::Min(in_sweepVec.y, 0.0f) });
+	sweptBounds.SetMax(in_box.GetMax() + Vec2f{ Math::Max(in_sweepVec.x, 0.0f), Math::Max(in_sweepVec.y, 0.0f) });
+	return sweptBounds;
+}
 
+std::optional<Math::BoxSweepResults> CollisionWorld::SweepBox(Box2f in_boxToSweep, Vec2f in_sweepVec, uint32_t in_mask) const
+{
 	std::optional<Math::BoxSweepResults> firstHit{};
 
-	for (std::weak_ptr<ColliderComponent> weakColl : m_colliders)
+	// only visit colliders whose fat bounds overlap the whole swept region
+	m_colliderTree.Query(GetSweptBounds(in_boxToSweep, in_sweepVec), [this, &firstHit, in_boxToSweep, in_sweepVec, in_mask](int32_t in_proxyId)
 	{
-		if (auto coll = weakColl.lock())
+		const ColliderProxy& proxy = m_colliderTree.GetUserData(in_proxyId);
+		if (!(proxy.m_category & in_mask)) return true;
+
+		if (auto coll = proxy.m_collider.lock())
 		{
+			++m_colliderSweepCount;
 			std::optional<Math::BoxSweepResults> res = coll->SweepBoxAgainstThis(in_boxToSweep, in_sweepVec);
 
 			if (res && (!firstHit || res->m_dist < firstHit->m_dist))
@@ -20,38 +30,88 @@ std::optional<Math::BoxSweepResults> CollisionWorld::SweepBox(Box2f in_boxToSwee
 				firstHit = res;
 			}
 		}
-	}
+		return true;
+	});
 
 	return firstHit;
 }
 
-//void CollisionWorld::ClearInvalidColliders() mutable
-//{
-//	for (auto iter = m_colliders.begin(); iter != m_colliders.end(); ) 
-//	{
-//		if (iter) 
-//		{
-//			iter = m_colliders.erase(iter);
-//		} 
-//		else 
-//		{
-//			iter++;
-//		}
-//	}
-//}
+CollisionWorld::CardinalProbeResults CollisionWorld::ProbeCardinal(Box2f in_box, float in_dist, uint32_t in_mask) const
+{
+	CardinalProbeResults results;
+
+	const Vec2f sweepVecs[] = { { 0.0f, in_dist }, { 0.0f, -in_dist }, { -in_dist, 0.0f }, { in_dist, 0.0f } };
+	std::optional<Math::BoxSweepResults>* hits[] = { &results.m_up, &results.m_down, &results.m_left, &results.m_right };
+	Box2f sweptBounds[4];
+	for (int32_t dirIdx = 0; dirIdx < 4; dirIdx++)
+	{
+		sweptBounds[dirIdx] = GetSweptBounds(in_box, sweepVecs[dirIdx]);
+	}
+
+	// gather candidates once over the union of the four probes, then only sweep each candidate in the directions whose probe it overlaps
+	Box2f probeBounds = in_box;
+	probeBounds.SetMin(in_box.GetMin() - Vec2f{ std::abs(in_dist), std::abs(in_dist) });
+	probeBounds.SetMax(in_box.GetMax() + Vec2f{ std::abs(in_dist), std::abs(in_dist) });
+
+	m_colliderTree.Query(probeBounds, [this, &sweepVecs, &hits, &sweptBounds, in_box, in_mask](int32_t in_proxyId)
+	{
+		const ColliderProxy& proxy = m_colliderTree.GetUserData(in_proxyId);
+		if (!(proxy.m_category & in_mask)) return true;
+
+		if (auto coll = proxy.m_collider.lock())
+		{
+			for (int32_t dirIdx = 0; dirIdx < 4; dirIdx++)
+			{
+				if (!m_colliderTree.FatBoxOverlaps(in_proxyId, sweptBounds[dirIdx])) continue;
+
+				++m_colliderSweepCount;
+				std::optional<Math::BoxSweepResults> res = coll->SweepBoxAgainstThis(in_box, sweepVecs[dirIdx]);
+
+				std::optional<Math::BoxSweepResults>& firstHit = *hits[dirIdx];
+				if (res && (!firstHit || res->m_dist < firstHit->m_dist))
+				{
+					firstHit = res;
+				}
+			}
+		}
+		return true;
+	});
+
+	return results;
+}
 
 void CollisionWorld::AddCollider(ColliderComponent* in_coll)
 {
-	m_colliders.insert(in_coll->AsShared<ColliderComponent>());
+	if (in_coll->m_proxyId != decltype(m_colliderTree)::NullNode) return;
+
+	in_coll->m_lastBoundingBoxWorld = in_coll->GetBoundingBoxWorld();
+	in_coll->m_proxyId = m_colliderTree.CreateProxy(in_coll->m_lastBoundingBoxWorld, { in_coll->AsShared<ColliderComponent>(), in_coll->GetCategory() });
 }
 
 void CollisionWorld::RemoveCollider(ColliderComponent* in_coll)
 {
-	m_colliders.erase(in_coll->AsShared<ColliderComponent>());
+	if (in_coll->m_proxyId == decltype(m_colliderTree)::NullNode) return;
+
+	m_colliderTree.DestroyProxy(in_coll->m_proxyId);
+	in_coll->m_proxyId = decltype(m_colliderTree)::NullNode;
 }
 
 void CollisionWorld::OnColliderBoundingBoxChanged(ColliderComponent* in_coll)
 {
-	RemoveCollider(in_coll);
-	AddCollider(in_coll);
+	// colliders that aren't registered yet (or were already removed) have nothing to update
+	if (in_coll->m_proxyId == decltype(m_colliderTree)::NullNode) return;
+
+	// the fat box is stretched along the collider's movement since its last update, so steadily moving colliders rarely need re-indexing
+	const Box2f bounds = in_coll->GetBoundingBoxWorld();
+	const Vec2f displacement = bounds.GetCenter() - in_coll->m_lastBoundingBoxWorld.GetCenter();
+	in_coll->m_lastBoundingBoxWorld = bounds;
+
+	m_colliderTree.MoveProxy(in_coll->m_proxyId, bounds, displacement);
+}
+
+void CollisionWorld::OnColliderCategoryChanged(ColliderComponent* in_coll)
+{
+	if (in_coll->m_proxyId == decltype(m_colliderTree)::NullNode) return;
+
+	m_colliderTree.GetUserData(in_coll->m_proxyId).m_category = in_coll->GetCategory();
 }
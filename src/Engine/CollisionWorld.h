@@ -1,8 +1,9 @@
 #pragma once
 
 #include "Engine/MathGeometry.h"
+#include "Engine/AABBTree.h"
 
-#include <set>
+#include <memory>
 
 /*
 CollisionSystem: 
@@ -10,10 +11,13 @@ CollisionSystem:
 A simple wrapper around MathGeometry sweep/overlap functions that lets you sweep and query overlaps against multiple things at once.
 
 
+Colliders are stored in a dynamic AABB tree, so queries only visit colliders whose (fat) bounds overlap the query region.
+
+Each collider has a category, and queries take a mask -- colliders whose category isn't in the mask are skipped before any sweep math.
+
+
 TODO:
-- broadphase acceleration structure
 - shape queries (query colliders that overlap a shape)
-- support some sort of collision mask system
 - circle support
 */
 
@@ -25,19 +29,46 @@ class ColliderComponent;
 class CollisionWorld : public std::enable_shared_from_this<CollisionWorld>
 {
 public:	
+	static constexpr uint32_t AllCategories = 0xFFFFFFFF;
+
 	// queries
-	std::optional<Math::BoxSweepResults> SweepBox(Box2f in_boxToSweep, Vec2f in_sweepVec) const;
+	std::optional<Math::BoxSweepResults> SweepBox(Box2f in_boxToSweep, Vec2f in_sweepVec, uint32_t in_mask = AllCategories) const;
 
-	// in the future, colliders will need to call this whenever their bounding boxes change, in order to 
+	// sweeps in_box by in_dist up, down, left and right, gathering candidate colliders once for all four directions
+	// (results match four separate SweepBox calls)
+	struct CardinalProbeResults
+	{
+		std::optional<Math::BoxSweepResults> m_up;
+		std::optional<Math::BoxSweepResults> m_down;
+		std::optional<Math::BoxSweepResults> m_left;
+		std::optional<Math::BoxSweepResults> m_right;
+	};
+	CardinalProbeResults ProbeCardinal(Box2f in_box, float in_dist, uint32_t in_mask = AllCategories) const;
+
+	// colliders call this whenever their bounding boxes change, in order to keep the broadphase tree up to date
 	void OnColliderBoundingBoxChanged(ColliderComponent* in_coll);
 
+	// how many bounding box changes have had to re-index a collider (moves that stay inside the collider's fat box are free)
+	int32_t GetColliderReindexCount() const { return m_colliderTree.GetReinsertCount(); }
+
+	// how many collider sweeps queries have run (colliders rejected by the broadphase or the query mask aren't swept, so don't count)
+	int32_t GetColliderSweepCount() const { return m_colliderSweepCount; }
+
 private:
 	friend class ColliderComponent;
 
-	std::set<std::weak_ptr<ColliderComponent>, std::owner_less<std::weak_ptr<ColliderComponent>>> m_colliders;
+	// the category is cached next to the collider so masked-out proxies can be rejected without touching the collider itself
+	struct ColliderProxy
+	{
+		std::weak_ptr<ColliderComponent> m_collider;
+		uint32_t m_category = AllCategories;
+	};
+	AABBTree<ColliderProxy> m_colliderTree;
+	mutable int32_t m_colliderSweepCount = 0;
 
 	//void ClearInvalidColliders() mutable;
 	void AddCollider(ColliderComponent* in_coll);
 	void RemoveCollider(ColliderComponent* in_coll);
+	void OnColliderCategoryChanged(ColliderComponent* in_coll);
 };
 
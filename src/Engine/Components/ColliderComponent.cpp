@@ -21,19 +21,30 @@ void ColliderComponent::Destroy()
 	Super::Destroy();
 }
 
+void ColliderComponent::SetCategory(uint32_t in_category)
+{
+	m_category = in_category;
+
+	if (auto world = m_world.lock()) {
+		world->OnColliderCategoryChanged(this);
+	}
+}
+
 Box2f ColliderComponent_TilesComponent::GetBoundingBoxLocal() const
 {
 	return Box2f(m_tilesComp->GetTileLayer()->GetGridBoundingBox());
 }
 
+Box2f ColliderComponent_TilesComponent::GetBoundingBoxWorld() const
+{
+	return Box2f(m_tilesComp->GetTileLayer()->GetGridBoundingBox()).TransformedBy(m_tilesComp->GetGridToWorldTransform());
+}
+
 std::optional<Math::BoxSweepResults> ColliderComponent_TilesComponent::SweepBoxAgainstThis(Box2f in_boxToSweep, Vec2f in_sweepVec) const
 {
 
 	return Math::SweepBoxAgainstGrid(in_boxToSweep, in_sweepVec,
 		m_tilesComp->GetGridToWorldTransform(),
-		m_tilesComp->GetTileLayer()->GetGridBoundingBox(),
-		[this](Vec2i in_testPos) {
-			return m_tilesComp->GetTileLayer()->GetTile(in_testPos) > 0;
-		}
+		m_tilesComp->GetSolidCells()
 	);
 }
@@ -30,10 +30,14 @@ public:
 	virtual Box2f GetBoundingBoxLocal() const = 0;
 	virtual std::optional<Math::BoxSweepResults> SweepBoxAgainstThis(Box2f in_boxToSweep, Vec2f in_sweepVec) const = 0;
 
-	Box2f GetBoundingBoxWorld() const { return GetBoundingBoxLocal().TransformedBy(GetWorldTransform()); }
+	virtual Box2f GetBoundingBoxWorld() const { return GetBoundingBoxLocal().TransformedBy(GetWorldTransform()); }
 
 	std::shared_ptr<CollisionWorld> GetWorld() const { return m_world.lock(); }
 
+	// queries only consider this collider if its category is in their mask (defaults to every category, so it's hit by all queries)
+	void SetCategory(uint32_t in_category);
+	uint32_t GetCategory() const { return m_category; }
+
 protected:
 	virtual void OnTransformChanged() override {
 		if (auto world = GetWorld()) {
@@ -42,7 +46,12 @@ protected:
 	}
 
 private:
+	friend class CollisionWorld;
+
 	std::weak_ptr<CollisionWorld> m_world;
+	int32_t m_proxyId = -1; //< Leaf id in the CollisionWorld's broadphase tree (-1 while not registered)
+	uint32_t m_category = CollisionWorld::AllCategories;
+	Box2f m_lastBoundingBoxWorld = {}; //< World bounds as of the last CollisionWorld update (used to estimate movement)
 };
 
 
@@ -97,6 +106,7 @@ public:
 
 
 	virtual Box2f GetBoundingBoxLocal() const override;
+	virtual Box2f GetBoundingBoxWorld() const override; //< The grid lives in the TilesComponent's space, not ours
 
 	virtual std::optional<Math::BoxSweepResults> SweepBoxAgainstThis(Box2f in_boxToSweep, Vec2f in_sweepVec) const override;
 
@@ -1,4 +1,5 @@
 #include "Engine/Components/DrawComponent.h"
+#include "Engine/Actor.h"
 #include "Engine/Game.h"
 #include "Engine/GameWindow.h"
 #include "Engine/LayerManager.h"
@@ -7,17 +8,40 @@
 void DrawComponent::Initialize()
 {
 	SceneComponent::Initialize();
-	SetRenderLayer("fgGameplay");
+	const RenderLayerId defaultLayerId = GetWindow()->GetLayerManager()->GetDefaultLayerId();
+	SQUID_RUNTIME_CHECK(defaultLayerId != InvalidRenderLayerId, "DrawComponent::Initialize() called before the default render layer was added");
+	SetRenderLayer(defaultLayerId);
+}
+
+void DrawComponent::SetComponentDrawOrder(int32_t in_drawOrder)
+{
+	if(m_drawOrder != in_drawOrder)
+	{
+		m_drawOrder = in_drawOrder;
+		if(auto actor = GetActor())
+		{
+			actor->MarkDrawCompOrderDirty();
+		}
+	}
+}
+
+void DrawComponent::SetRenderLayer(RenderLayerId in_layerId)
+{
+	m_renderLayerId = in_layerId;
+	m_targetRenderTexture = nullptr;
 }
 
 void DrawComponent::SetRenderLayer(const std::string& in_layerName)
 {
-	SetTargetRenderTexture(GetWindow()->GetLayerManager()->GetLayer(in_layerName)->GetRenderTexture());
+	RenderLayerId layerId = GetWindow()->GetLayerManager()->FindLayerId(in_layerName);
+	SQUID_RUNTIME_CHECK(layerId != InvalidRenderLayerId, "DrawComponent::SetRenderLayer() called with an unknown layer name");
+	SetRenderLayer(layerId);
 }
 
 void DrawComponent::SetTargetRenderTexture(std::shared_ptr<RenderTexture> in_targetRenderTexture)
 {
 	m_targetRenderTexture = in_targetRenderTexture;
+	m_renderLayerId = InvalidRenderLayerId;
 }
 
 std::shared_ptr<RenderTexture> DrawComponent::GetTargetRenderTexture() const
@@ -25,6 +49,9 @@ std::shared_ptr<RenderTexture> DrawComponent::GetTargetRenderTexture() const
 	if (m_targetRenderTexture)
 		return m_targetRenderTexture;
 
+	if (m_renderLayerId != InvalidRenderLayerId)
+		return GetWindow()->GetLayerManager()->GetLayer(m_renderLayerId)->GetRenderTexture();
+
 	return GameBase::Get()->GetWindow()->GetRenderTarget();
 }
 
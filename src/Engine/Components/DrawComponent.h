@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Engine/Components/SceneComponent.h"
+#include "Engine/LayerManager.h"
 
 class RenderTexture;
 
@@ -16,13 +17,16 @@ public:
 	virtual void Update() {}
 	virtual void Draw() {}
 
-	void SetComponentDrawOrder(int32_t in_drawOrder) { m_drawOrder = in_drawOrder; }
+	void SetComponentDrawOrder(int32_t in_drawOrder);
 	int32_t GetDrawOrder() const { return m_drawOrder; }
 
 	void SetHidden(bool in_bHidden) { m_bHidden = in_bHidden; }
 	bool GetHidden() const { return m_bHidden; }
 
-	void SetRenderLayer(const std::string& in_layerName);
+	// draw into a render layer (resolved every draw, so it follows the layer when its texture is recreated), or into a specific render texture
+	void SetRenderLayer(RenderLayerId in_layerId);
+	void SetRenderLayer(const std::string& in_layerName); // looks the id up by name
+	RenderLayerId GetRenderLayer() const { return m_renderLayerId; }
 	void SetTargetRenderTexture(std::shared_ptr<RenderTexture> in_targetRenderTexture);
 
 protected:
@@ -31,7 +35,10 @@ protected:
 	sf::RenderTexture* GetTargetSFMLRenderTexture() const;
 
 private:
+	friend class Actor;
 	int32_t m_drawOrder = 0;
+	uint32_t m_drawSeq = 0; // order the component was added to its actor, breaks ties between equal draw orders
 	bool m_bHidden = false;
+	RenderLayerId m_renderLayerId = InvalidRenderLayerId;
 	std::shared_ptr<RenderTexture> m_targetRenderTexture;
 };
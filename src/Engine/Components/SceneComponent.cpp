@@ -61,6 +61,9 @@ const SceneComponent::tAttachChildren& SceneComponent::GetAttachChildren() const
 }
 void SceneComponent::ClearTransformCache()
 {
+	// Clear our own world transform first, so attach children (and their OnTransformChanged) never see a stale parent transform
+	m_worldTransform.reset();
+
 	// Recursively clear the cache on all attach children (clearing any dead or with incorrect attach parent)
 	for(size_t idx = 0; idx < m_attachChildren.size(); ++idx)
 	{
@@ -82,8 +85,6 @@ void SceneComponent::ClearTransformCache()
 		}
 	}
 
-	// Clear our own world transform
-	m_worldTransform.reset();
 	OnTransformChanged();
 }
 void SceneComponent::SetRelativeTransform(const Transform& in_relativeTransform)
@@ -2,7 +2,7 @@
 #include "Engine/MathGeometry.h"
 
 bool SensorComponent::IsTouching(const std::shared_ptr<SensorComponent> in_otherComp) const {
-	if((m_mask & in_otherComp->m_category) && (in_otherComp->m_mask & m_category)) {
+	if(CanTouch(in_otherComp)) {
 		auto diff = GetWorldPos() - in_otherComp->GetWorldPos();
 		auto thisCompShapeType = GetShape().GetShapeType();
 		auto otherCompShapeType = in_otherComp->GetShape().GetShapeType();
@@ -38,6 +38,19 @@ bool SensorComponent::IsTouching(const std::shared_ptr<SensorComponent> in_other
 	}
 	return false;
 }
+bool SensorComponent::CanTouch(const std::shared_ptr<SensorComponent>& in_otherComp) const {
+	return (m_mask & in_otherComp->m_category) && (in_otherComp->m_mask & m_category);
+}
+Box2f SensorComponent::GetWorldBounds() const {
+	if(GetShape().IsCircle()) {
+		auto radius = GetShape().GetCircle().radius;
+		return Box2f::FromCenter(GetWorldPos(), Vec2f{ radius * 2.0f, radius * 2.0f });
+	}
+	if(GetShape().IsBox()) {
+		return Box2f::FromCenter(GetWorldPos(), GetShape().GetBox());
+	}
+	return Box2f::FromCenter(GetWorldPos(), Vec2f::Zero);
+}
 void SensorComponent::CallTouchCallback(bool in_bOnTouch, std::shared_ptr<SensorComponent> in_otherSensor) {
 	if(m_touchCallback) {
 			m_touchCallback(in_bOnTouch, in_otherSensor);
@@ -44,18 +44,36 @@ class SensorComponent : public SceneComponent
 {
 	using Callback = std::function<void(bool, std::shared_ptr<SensorComponent>)>;
 public:
-	void SetShape(const SensorShape& in_shape) { m_shape = in_shape; }
+	static constexpr bool s_bUseObjectArena = true; // made and destroyed with nearly every game actor
+
+	void SetShape(const SensorShape& in_shape) { 
+		m_shape = in_shape;
+		m_bBroadphaseWoken = true;
+	}
 	const SensorShape& GetShape() const { return m_shape; }
 	bool IsTouching(const std::shared_ptr<SensorComponent> in_otherComp) const;
+	bool CanTouch(const std::shared_ptr<SensorComponent>& in_otherComp) const; //< Category/mask test only (no shape math)
+	Box2f GetWorldBounds() const; //< Conservative world-space AABB of the sensor shape (used for broadphase)
 	void SetTouchCallback(Callback in_func) { m_touchCallback = in_func; }
 	void CallTouchCallback(bool in_bOnTouch, std::shared_ptr<SensorComponent> in_otherSensor);
 	void SetFiltering(uint32_t in_category, uint32_t in_mask) {
 		m_category = in_category;
 		m_mask = in_mask;
+		m_bBroadphaseWoken = true;
 	}
 	const Vec2u GetFiltering() { return Vec2u{ m_category, m_mask }; }
+	// Static sensors are never tested against other static sensors, only against moving ones 
+	// (SensorManager also treats sensors that haven't moved, or had their shape or filtering changed, for a while as static)
+	void SetStatic(bool in_bStatic) { m_bStatic = in_bStatic; }
+	bool IsStatic() const { return m_bStatic; }
 
 private:
+	friend class SensorManager;
+
+	bool m_bStatic = false;
+	Box2f m_lastBroadphaseBounds = {}; //< Broadphase bookkeeping for detecting sensors that have stopped moving
+	int32_t m_broadphaseFramesUnmoved = 0;
+	bool m_bBroadphaseWoken = false; //< Set by shape/filtering changes, which can start touches without the sensor moving
 	uint32_t m_category = 0;
 	uint32_t m_mask = 0;
 	SensorShape m_shape;
@@ -1,6 +1,7 @@
 #include "ShapeComponent.h"
 
 #include "Engine/GameWindow.h"
+#include "Engine/RenderTexture.h"
 
 #include <SFML/Graphics.hpp>
 
@@ -49,7 +50,7 @@ void ShapeComponent::Draw()
 	DrawComponent::Draw();
 
 	// Get world transform
-	auto sfmlRenderTarget = GetTargetSFMLRenderTexture();
+	auto renderTarget = GetTargetRenderTexture();
 	const auto& worldTransform = GetWorldTransform();
 
 	// Rebuild shape (if necessary)
@@ -71,14 +72,14 @@ void ShapeComponent::Draw()
 			verts[0].color = sf::Color::Black;
 			verts[1].color = sf::Color::Black;
 			verts[2].color = sf::Color::Black;
-			sfmlRenderTarget->draw(&verts[0], 3, sf::PrimitiveType::Triangles);
+			renderTarget->DrawSFML(&verts[0], 3, sf::PrimitiveType::Triangles, sf::RenderStates::Default);
 		}
 	}
 
 	// Draw shape
 	if(m_shape)
 	{
-		sfmlRenderTarget->draw(m_shape.value());
+		renderTarget->DrawSFML(m_shape.value(), sf::RenderStates::Default, m_shape->getPointCount() + 2);
 	}
 
 	// Draw outlines (as needed)
@@ -98,6 +99,6 @@ void ShapeComponent::Draw()
 				m_lines.push_back(sf::Vertex({ pos.x, pos.y }, sf::Color::White));
 			}
 		}
-		sfmlRenderTarget->draw(m_lines.data(), m_lines.size(), sf::LineStrip);
+		renderTarget->DrawSFML(m_lines.data(), m_lines.size(), sf::LineStrip, sf::RenderStates::Default);
 	}
 }
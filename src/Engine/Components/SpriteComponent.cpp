@@ -9,6 +9,8 @@
 #include "Engine/Shader.h"
 #include "Engine/Anim.h"
 #include "Engine/StringUtils.h"
+#include "Engine/RenderTexture.h"
+#include "Engine/SpriteBatch.h"
 #include <cmath>
 
 //--- SpriteComponent ---//
@@ -39,7 +41,10 @@ sf::Color SpriteComponent::GetColor() {
 void SpriteComponent::SetTexture(std::shared_ptr<Texture> in_texture)
 {
 	m_texture = in_texture;
-	m_sprite.setTexture(m_texture->GetSFMLTexture());
+	if(const sf::Texture* sfmlTexture = m_texture->GetSFMLTexture()) // headless textures are null, the sprite only needs its texture rect then
+	{
+		m_sprite.setTexture(*sfmlTexture);
+	}
 }
 void SpriteComponent::SetSubTexture(const Box2i& in_subTex)
 {
@@ -71,25 +76,55 @@ void SpriteComponent::SetFlipVert(bool in_flipV)
 {
 	m_flipV = in_flipV;
 }
-void SpriteComponent::Draw()
+void SpriteComponent::ApplyWorldTransform(sf::Transformable& out_transformable) const
 {
 	const auto& worldTransform = GetWorldTransform();
-	m_sprite.setPosition(std::round(worldTransform.pos.x), std::round(worldTransform.pos.y));
-	m_sprite.setRotation(worldTransform.rot);
-	m_sprite.setScale(m_flipH ? worldTransform.scale.x * -1.0f : worldTransform.scale.x, m_flipV ? worldTransform.scale.y : -worldTransform.scale.y);
-	std::shared_ptr<Shader> shader = m_paletteSet ? m_paletteSet->GetPaletteShader() : nullptr;
-	if(shader)
+	out_transformable.setPosition(std::round(worldTransform.pos.x), std::round(worldTransform.pos.y));
+	out_transformable.setRotation(worldTransform.rot);
+	out_transformable.setScale(m_flipH ? worldTransform.scale.x * -1.0f : worldTransform.scale.x, m_flipV ? worldTransform.scale.y : -worldTransform.scale.y);
+}
+Box2f SpriteComponent::GetWorldBounds() const
+{
+	sf::Transformable transformable;
+	transformable.setOrigin(m_sprite.getOrigin());
+	ApplyWorldTransform(transformable);
+	const sf::FloatRect rect = transformable.getTransform().transformRect(m_sprite.getLocalBounds());
+	return Box2f{ rect.left, rect.top, rect.width, rect.height };
+}
+void SpriteComponent::Draw()
+{
+	ApplyWorldTransform(m_sprite);
+
+	// Build the same quad sf::Sprite would draw, transformed on the CPU so sprites with different transforms can share a draw call
+	const sf::Transform& tm = m_sprite.getTransform();
+	const sf::IntRect& rect = m_sprite.getTextureRect();
+	const sf::FloatRect bounds = m_sprite.getLocalBounds();
+	const sf::Color color = m_sprite.getColor();
+	const float left = (float)rect.left;
+	const float right = left + (float)rect.width;
+	const float top = (float)rect.top;
+	const float bottom = top + (float)rect.height;
+	const sf::Vertex quad[4] = {
+		sf::Vertex(tm.transformPoint(0.0f, 0.0f), color, { left, top }),
+		sf::Vertex(tm.transformPoint(0.0f, bounds.height), color, { left, bottom }),
+		sf::Vertex(tm.transformPoint(bounds.width, 0.0f), color, { right, top }),
+		sf::Vertex(tm.transformPoint(bounds.width, bounds.height), color, { right, bottom }),
+	};
+
+	// Queue it on the target's sprite batch (flushed in runs sharing texture/palette/shader when the layer is done, or before anything else draws to it)
+	SpriteStates states;
+	states.m_texture = m_texture.get();
+	states.m_blendMode = m_blendMode;
+	if(std::shared_ptr<Shader> paletteShader = m_paletteSet ? m_paletteSet->GetPaletteShader() : nullptr)
 	{
-		auto& sfmlShader = shader->GetSFMLShader();
-		sfmlShader.setUniform("texture", m_texture->GetSFMLTexture());
-		auto paletteTexture = m_paletteSet->GetPaletteTexture(m_paletteIdx);
-		sfmlShader.setUniform("palette", paletteTexture->GetSFMLTexture());
-		GetTargetSFMLRenderTexture()->draw(m_sprite, &sfmlShader);
+		states.m_shader = paletteShader.get();
+		states.m_paletteTexture = m_paletteSet->GetPaletteTexture(m_paletteIdx).get();
 	}
 	else
 	{
-		GetTargetSFMLRenderTexture()->draw(m_sprite);
+		states.m_shader = m_shader.get();
 	}
+	GetTargetRenderTexture()->QueueSprite(quad, states);
 }
 TaskHandle<> SpriteComponent::PlayAnim(const std::string& in_animName, bool in_loop, int32_t in_startFrame)
 {
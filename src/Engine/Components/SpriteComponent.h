@@ -12,11 +12,14 @@ class Texture;
 class PaletteSet;
 class SpriteSheet;
 class Anim;
+class Shader;
 
 // Sprite Component
 class SpriteComponent : public DrawComponent
 {
 public:
+	static constexpr bool s_bUseObjectArena = true; // made and destroyed with nearly every actor
+
 	virtual void Update() override;
 	virtual void Destroy() override;
 	virtual void Draw() override;
@@ -29,11 +32,14 @@ public:
 	void SetColor(uint8_t in_red, uint8_t in_green, uint8_t in_blue, uint8_t in_alpha = 255);
 	void SetPalette(const std::string& in_palette);
 	void SetPaletteSet(std::shared_ptr<PaletteSet> in_paletteSet);
+	void SetShader(std::shared_ptr<Shader> in_shader) { m_shader = in_shader; } // used when there's no palette set (its "texture" uniform is bound to the sprite's texture)
+	void SetBlendMode(const sf::BlendMode& in_blendMode) { m_blendMode = in_blendMode; }
 	void SetOrigin(const Vec2f& in_origin);
 	void SetFlipHori(bool in_flipH);
 	bool GetFlipHori() const { return m_flipH; }
 	void SetFlipVert(bool in_flipV);
 	bool GetFlipVert() const { return m_flipV; }
+	Box2f GetWorldBounds() const; // bounds of the quad Draw() would draw this frame
 
 	// Playback
 	void SetPlayRate(float in_playRate) { m_playRate = in_playRate; }
@@ -44,10 +50,13 @@ public:
 
 protected:
 	void UpdatePaletteIdx();
+	void ApplyWorldTransform(sf::Transformable& out_transformable) const;
 
 	sf::Sprite m_sprite;
 	std::shared_ptr<Texture> m_texture;
 	std::shared_ptr<PaletteSet> m_paletteSet;
+	std::shared_ptr<Shader> m_shader;
+	sf::BlendMode m_blendMode = sf::BlendAlpha;
 	std::string m_palette;
 	int32_t m_paletteIdx = 0;
 	float m_playRate = 1.0f;
@@ -4,6 +4,7 @@
 #include "Engine/Font.h"
 
 #include "Engine/GameWindow.h"
+#include "Engine/RenderTexture.h"
 
 #include <SFML/Graphics.hpp>
 
@@ -61,7 +62,9 @@ void TextComponent::Draw()
 
 	if(m_needsRefresh)
 	{
-		if(m_font)
+		// laying out the text rasterizes its glyphs into the font's texture, which the null render backend skips (so headless text has empty bounds)
+		const bool bLayoutGlyphs = m_font && !GameWindow::IsHeadless();
+		if(bLayoutGlyphs)
 		{
 			m_text.setFont(m_font->GetSFMLFont());
 		}
@@ -71,9 +74,12 @@ void TextComponent::Draw()
 		m_text.setOutlineThickness(0);
 		m_text.setCharacterSize(m_pixelSize);
 		m_text.setLineSpacing(m_lineSpacingFactor);
-		m_font->SetSmooth(false);
-		const sf::Texture& texture = m_font->GetSFMLFont().getTexture(m_pixelSize);
-		const_cast<sf::Texture*>(&texture)->setSmooth(false);
+		if(bLayoutGlyphs)
+		{
+			m_font->SetSmooth(false);
+			const sf::Texture& texture = m_font->GetSFMLFont().getTexture(m_pixelSize);
+			const_cast<sf::Texture*>(&texture)->setSmooth(false);
+		}
 		m_needsRefresh = false;
 	}
 
@@ -90,7 +96,6 @@ void TextComponent::Draw()
 	// Draw text
 	if(m_textStr.size())
 	{
-		auto sfmlRenderTarget = GetTargetSFMLRenderTexture();
-		sfmlRenderTarget->draw(m_text);
+		GetTargetRenderTexture()->DrawSFML(m_text, sf::RenderStates::Default);
 	}
 }
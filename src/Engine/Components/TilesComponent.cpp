@@ -13,72 +13,92 @@ void TilesComponent::Draw()
 {
 	DrawComponent::Draw();
 
-	if(!m_tileLayer)
+	if(!m_tileLayer || m_tileLayer->GetLayerType() != eTileLayerType::Tile)
 	{
 		return;
 	}
 
-	// Create sprite
+	// Chunk vertices are baked in world space, so re-bake everything if the component has moved
 	const auto& worldTransform = GetWorldTransform();
-	sf::Sprite sprite;
-	sprite.setPosition(std::round(worldTransform.pos.x), std::round(worldTransform.pos.y));
-	sprite.setRotation(worldTransform.rot);
-	sprite.setScale(worldTransform.scale.x, -worldTransform.scale.y);
+	if(worldTransform.pos != m_chunkTransform.pos || worldTransform.rot != m_chunkTransform.rot || worldTransform.scale != m_chunkTransform.scale)
+	{
+		m_chunkTransform = worldTransform;
+		for(auto& chunk : m_chunks)
+		{
+			chunk.m_bDirty = true;
+		}
+	}
 
-	// Draw the tile layer
+	// Find the visible cells, clipped to the layer
 	const auto& gridDims = m_tileLayer->GetGridDims();
-	const auto& tileDims = m_tileLayer->GetTileDims();
-	sprite.setOrigin(0.0f, (float)tileDims.y);
+	auto worldView = GetTargetRenderTexture()->GetView();
+	auto upperLeft = WorldPosToGridPos(worldView.GetMin());
+	auto lowerRight = WorldPosToGridPos(worldView.GetMax());
+	MinMaxi colRange{ std::max(upperLeft.x, 0), std::min(lowerRight.x, gridDims.x - 1) };
+	MinMaxi rowRange{ std::max(upperLeft.y, -gridDims.y), std::min(lowerRight.y, -1) };
+	if(colRange.m_min > colRange.m_max || rowRange.m_min > rowRange.m_max)
+	{
+		return;
+	}
+
+	// Convert to chunk ranges (chunk rows count down from the top of the layer)
+	MinMaxi chunkColRange{ colRange.m_min / s_chunkSize, colRange.m_max / s_chunkSize };
+	MinMaxi chunkRowRange{ (-rowRange.m_max - 1) / s_chunkSize, (-rowRange.m_min - 1) / s_chunkSize };
+	for(auto chunkRow = chunkRowRange.m_min; chunkRow <= chunkRowRange.m_max; ++chunkRow)
+	{
+		for(auto chunkCol = chunkColRange.m_min; chunkCol <= chunkColRange.m_max; ++chunkCol)
+		{
+			auto chunkIdx = chunkRow * m_chunkDims.x + chunkCol;
+			if(m_chunks[chunkIdx].m_bDirty)
+			{
+				BakeChunk(chunkIdx);
+			}
+		}
+	}
 
-	if(m_tileLayer && m_tileLayer->GetLayerType() == eTileLayerType::Tile)
+	// Draw the visible chunks, one tileset at a time (same layering as drawing each tileset's tiles in turn)
+	auto renderTarget = GetTargetRenderTexture();
+	const auto& tileSets = m_tileLayer->GetTileSets();
+	for(size_t tilesetIdx = 0; tilesetIdx < tileSets.size(); ++tilesetIdx)
 	{
-		auto gridDims = m_tileLayer->GetGridDims();
-		auto worldView = GetTargetRenderTexture()->GetView();
-		auto upperLeft = WorldPosToGridPos(worldView.GetMin());
-		auto lowerRight = WorldPosToGridPos(worldView.GetMax());
-		MinMaxi colRange{ upperLeft.x, lowerRight.x };
-		MinMaxi rowRange{ upperLeft.y, lowerRight.y };
-		auto renderTarget = GetTargetSFMLRenderTexture();
-
-		// iterate through tilesets
-		size_t tilesetIdx = 0;
-		for(auto tileSet : m_tileLayer->GetTileSets())
+		const Texture* texture = tileSets[tilesetIdx]->GetTexture().get();
+		sf::RenderStates states(texture->GetSFMLTexture());
+		for(auto chunkRow = chunkRowRange.m_min; chunkRow <= chunkRowRange.m_max; ++chunkRow)
 		{
-			MinMaxi tileIdRange = m_tileLayer->GetTileIdRanges()[tilesetIdx];
-			sprite.setTexture(tileSet->GetTexture()->GetSFMLTexture());
-			const auto& tileBoxes = tileSet->GetTiles();
-			const auto& tiles = m_tileLayer->GetTiles();
-			for(auto row = rowRange.m_min; row <= rowRange.m_max; ++row)
+			for(auto chunkCol = chunkColRange.m_min; chunkCol <= chunkColRange.m_max; ++chunkCol)
 			{
-				for(auto col = colRange.m_min; col <= colRange.m_max; ++col)
+				const auto& verts = m_chunks[chunkRow * m_chunkDims.x + chunkCol].m_tileSetVerts[tilesetIdx];
+				if(verts.getVertexCount())
 				{
-					// Set tile sub-texture
-					Vec2i tileGridPos{ col, row };
-					auto tileIdx = m_tileLayer->GridPosToTileIdx(tileGridPos); // Index in the tiles array
-					auto tile = tiles[tileIdx]; // Which tile to draw
-					if(!tileIdRange.Contains_InclExcl(tile))
-					{
-						continue;
-					}
-					auto rect = Box2i(tileBoxes[(size_t)tile - (size_t)tileIdRange.m_min]);
-					sprite.setTextureRect({ rect.x, rect.y, rect.w, rect.h });
-
-					// Set tile position
-					Vec2f tilePos = { (float)(tileGridPos.x * tileDims.x), (float)(tileGridPos.y * tileDims.y) };
-					tilePos = worldTransform.TransformPoint(tilePos);
-					sprite.setPosition(tilePos.x, tilePos.y);
-
-					// Draw the tile
-					renderTarget->draw(sprite);
+					renderTarget->DrawSFML(&verts[0], verts.getVertexCount(), verts.getPrimitiveType(), states, { texture, nullptr });
 				}
 			}
-			++tilesetIdx;
 		}
 	}
 }
 void TilesComponent::SetTileLayer(std::shared_ptr<TileLayer> in_tileLayer)
 {
 	m_tileLayer = in_tileLayer;
+
+	// rebuild the solid cell cache
+	m_solidCells.Reset(m_tileLayer ? m_tileLayer->GetGridBoundingBox() : Box2i{ 0, 0, 0, 0 });
+	if(m_tileLayer)
+	{
+		const auto& tiles = m_tileLayer->GetTiles();
+		for(int32_t tileIdx = 0; tileIdx < (int32_t)tiles.size(); ++tileIdx)
+		{
+			if(tiles[tileIdx] > 0)
+			{
+				m_solidCells.Set(m_tileLayer->TileIdxToGridPos(tileIdx), true);
+			}
+		}
+	}
+	for(auto& [tileId, cells] : m_trackedTileCells)
+	{
+		BuildTileCells(tileId, cells);
+	}
+	ResetChunks();
+	++m_tileChangeCount;
 }
 
 std::shared_ptr<TileLayer> TilesComponent::GetTileLayer() const
@@ -86,6 +106,151 @@ std::shared_ptr<TileLayer> TilesComponent::GetTileLayer() const
 	return m_tileLayer;
 }
 
+void TilesComponent::SetTile(Vec2i in_gridPos, int32_t in_tile)
+{
+	if(!m_tileLayer) return;
+
+	m_tileLayer->SetTile(in_gridPos, in_tile);
+	m_solidCells.Set(in_gridPos, in_tile > 0);
+	for(auto& [tileId, cells] : m_trackedTileCells)
+	{
+		cells.Set(in_gridPos, in_tile == tileId);
+	}
+	if(m_tileLayer->IsValidGridCoord(in_gridPos))
+	{
+		m_chunks[GridPosToChunkIdx(in_gridPos)].m_bDirty = true;
+	}
+	++m_tileChangeCount;
+}
+
+const GridBitset& TilesComponent::GetSolidCells() const
+{
+	return m_solidCells;
+}
+
+void TilesComponent::TrackTileCells(int32_t in_tileId)
+{
+	for(const auto& [tileId, cells] : m_trackedTileCells)
+	{
+		if(tileId == in_tileId)
+		{
+			return;
+		}
+	}
+	m_trackedTileCells.push_back({ in_tileId, GridBitset{} });
+	BuildTileCells(in_tileId, m_trackedTileCells.back().second);
+}
+
+const GridBitset& TilesComponent::GetTileCells(int32_t in_tileId) const
+{
+	for(const auto& [tileId, cells] : m_trackedTileCells)
+	{
+		if(tileId == in_tileId)
+		{
+			return cells;
+		}
+	}
+	SQUID_RUNTIME_ERROR("TilesComponent::GetTileCells() called with a tile id that isn't tracked (see TrackTileCells())");
+	return m_solidCells;
+}
+
+void TilesComponent::BuildTileCells(int32_t in_tileId, GridBitset& out_cells) const
+{
+	out_cells.Reset(m_tileLayer ? m_tileLayer->GetGridBoundingBox() : Box2i{ 0, 0, 0, 0 });
+	if(!m_tileLayer)
+	{
+		return;
+	}
+	const auto& tiles = m_tileLayer->GetTiles();
+	for(int32_t tileIdx = 0; tileIdx < (int32_t)tiles.size(); ++tileIdx)
+	{
+		if(tiles[tileIdx] == in_tileId)
+		{
+			out_cells.Set(m_tileLayer->TileIdxToGridPos(tileIdx), true);
+		}
+	}
+}
+
+void TilesComponent::ResetChunks()
+{
+	m_chunks.clear();
+	m_chunkDims = Vec2i::Zero;
+	if(!m_tileLayer || m_tileLayer->GetLayerType() != eTileLayerType::Tile)
+	{
+		return;
+	}
+
+	// All chunks start dirty and get baked the first time they're visible
+	const auto& gridDims = m_tileLayer->GetGridDims();
+	m_chunkDims = { (gridDims.x + s_chunkSize - 1) / s_chunkSize, (gridDims.y + s_chunkSize - 1) / s_chunkSize };
+	m_chunks.resize((size_t)m_chunkDims.x * (size_t)m_chunkDims.y);
+}
+
+int32_t TilesComponent::GridPosToChunkIdx(Vec2i in_gridPos) const
+{
+	// same y-flip as TileLayer::GridPosToTileIdx(), so chunk row 0 holds the top rows of the layer
+	return ((-in_gridPos.y - 1) / s_chunkSize) * m_chunkDims.x + in_gridPos.x / s_chunkSize;
+}
+
+void TilesComponent::BakeChunk(int32_t in_chunkIdx)
+{
+	auto& chunk = m_chunks[in_chunkIdx];
+	chunk.m_bDirty = false;
+
+	// Set up a sprite the way each tile used to be drawn, and bake its transformed corners instead of drawing it
+	const auto& tileDims = m_tileLayer->GetTileDims();
+	sf::Sprite sprite;
+	sprite.setRotation(m_chunkTransform.rot);
+	sprite.setScale(m_chunkTransform.scale.x, -m_chunkTransform.scale.y);
+	sprite.setOrigin(0.0f, (float)tileDims.y);
+
+	// Cells covered by this chunk, as rows/cols of the tile array
+	const auto& gridDims = m_tileLayer->GetGridDims();
+	Vec2i chunkPos = { in_chunkIdx % m_chunkDims.x, in_chunkIdx / m_chunkDims.x };
+	MinMaxi colRange{ chunkPos.x * s_chunkSize, std::min((chunkPos.x + 1) * s_chunkSize, gridDims.x) };
+	MinMaxi rowRange{ chunkPos.y * s_chunkSize, std::min((chunkPos.y + 1) * s_chunkSize, gridDims.y) };
+
+	const auto& tileSets = m_tileLayer->GetTileSets();
+	const auto& tiles = m_tileLayer->GetTiles();
+	chunk.m_tileSetVerts.resize(tileSets.size(), sf::VertexArray(sf::Quads));
+	for(size_t tilesetIdx = 0; tilesetIdx < tileSets.size(); ++tilesetIdx)
+	{
+		auto& verts = chunk.m_tileSetVerts[tilesetIdx];
+		verts.clear();
+		MinMaxi tileIdRange = m_tileLayer->GetTileIdRanges()[tilesetIdx];
+		const auto& tileBoxes = tileSets[tilesetIdx]->GetTiles();
+		for(auto row = rowRange.m_min; row < rowRange.m_max; ++row)
+		{
+			for(auto col = colRange.m_min; col < colRange.m_max; ++col)
+			{
+				Vec2i tileGridPos{ col, -row - 1 };
+				auto tile = tiles[m_tileLayer->GridPosToTileIdx(tileGridPos)];
+				if(!tileIdRange.Contains_InclExcl(tile))
+				{
+					continue;
+				}
+				auto rect = Box2i(tileBoxes[(size_t)tile - (size_t)tileIdRange.m_min]);
+
+				// Set tile position
+				Vec2f tilePos = { (float)(tileGridPos.x * tileDims.x), (float)(tileGridPos.y * tileDims.y) };
+				tilePos = m_chunkTransform.TransformPoint(tilePos);
+				sprite.setPosition(tilePos.x, tilePos.y);
+
+				// Append the tile's quad (corners and texcoords match sf::Sprite's own vertices)
+				const sf::Transform& tm = sprite.getTransform();
+				float w = (float)rect.w;
+				float h = (float)rect.h;
+				float left = (float)rect.x;
+				float top = (float)rect.y;
+				verts.append(sf::Vertex(tm.transformPoint(0.0f, 0.0f), { left, top }));
+				verts.append(sf::Vertex(tm.transformPoint(w, 0.0f), { left + w, top }));
+				verts.append(sf::Vertex(tm.transformPoint(w, h), { left + w, top + h }));
+				verts.append(sf::Vertex(tm.transformPoint(0.0f, h), { left, top + h }));
+			}
+		}
+	}
+}
+
 Transform TilesComponent::GetGridToWorldTransform() const
 {
 	Transform tm = GetWorldTransform();
@@ -2,6 +2,9 @@
 
 #include "Engine/Components/DrawComponent.h"
 #include "Engine/Box.h"
+#include "Engine/GridBitset.h"
+
+#include <SFML/Graphics/VertexArray.hpp>
 
 class TileLayer;
 
@@ -9,15 +12,49 @@ class TileLayer;
 class TilesComponent : public DrawComponent
 {
 public:
+	// the layer is drawn from vertex arrays baked per chunk of s_chunkSize x s_chunkSize cells (one array per tileset)
+	// only chunks overlapping the view are drawn, and a chunk is only re-baked after one of its tiles changes through SetTile()
+	static constexpr int32_t s_chunkSize = 32;
+
 	virtual void Draw() override;
 
 	void SetTileLayer(std::shared_ptr<TileLayer> in_tileLayer);
 	std::shared_ptr<TileLayer> GetTileLayer() const;
 
+	// sets a tile on the layer and keeps the solid cell cache and draw chunks in sync (prefer this over TileLayer::SetTile)
+	void SetTile(Vec2i in_gridPos, int32_t in_tile);
+	const GridBitset& GetSolidCells() const; // one bit per cell with a tile (id > 0)
+
+	// also keep a bitset of the cells holding one specific tile id (kept in sync by SetTile, like the solid cells)
+	void TrackTileCells(int32_t in_tileId);
+	const GridBitset& GetTileCells(int32_t in_tileId) const;
+
+	// bumped whenever SetTile changes the layer (lets callers tell whether cached query results are stale)
+	uint32_t GetTileChangeCount() const { return m_tileChangeCount; }
+
 	Transform GetGridToWorldTransform() const;
 	Vec2i WorldPosToGridPos(Vec2f in_worldPos) const;
 	Box2f GridPosToWorldBox(Vec2i in_gridPos) const;
 
 protected:
 	std::shared_ptr<TileLayer> m_tileLayer;
+	GridBitset m_solidCells;
+	std::vector<std::pair<int32_t, GridBitset>> m_trackedTileCells;
+	uint32_t m_tileChangeCount = 0;
+
+	void BuildTileCells(int32_t in_tileId, GridBitset& out_cells) const;
+
+	// Draw chunks
+	struct TileChunk
+	{
+		std::vector<sf::VertexArray> m_tileSetVerts; // quads, indexed like TileLayer::GetTileSets()
+		bool m_bDirty = true;
+	};
+	std::vector<TileChunk> m_chunks; // row-major, starting from the top row of the layer (same order as TileLayer::GetTiles())
+	Vec2i m_chunkDims = Vec2i::Zero;
+	Transform m_chunkTransform; // world transform the chunk vertices were baked with
+
+	void ResetChunks();
+	int32_t GridPosToChunkIdx(Vec2i in_gridPos) const;
+	void BakeChunk(int32_t in_chunkIdx);
 };
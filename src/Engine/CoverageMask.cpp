@@ -0,0 +1,65 @@
+#include "CoverageMask.h"
+
+#include <algorithm>
+
+#include "MathCore.h"
+
+void CoverageMask::Reset(Vec2u in_pixelSize, int32_t in_tileSize)
+{
+	m_dims = { 0, 0 };
+	if(in_tileSize > 0 && in_pixelSize.x > 0 && in_pixelSize.y > 0)
+	{
+		m_dims.x = ((int32_t)in_pixelSize.x + in_tileSize - 1) / in_tileSize;
+		m_dims.y = ((int32_t)in_pixelSize.y + in_tileSize - 1) / in_tileSize;
+		m_tileExtents = { (float)in_pixelSize.x / m_dims.x, (float)in_pixelSize.y / m_dims.y };
+	}
+	m_tiles.assign(m_dims.x * m_dims.y, 0);
+	m_numCovered = 0;
+}
+
+void CoverageMask::Clear()
+{
+	if(m_numCovered)
+	{
+		std::fill(m_tiles.begin(), m_tiles.end(), (uint8_t)0);
+		m_numCovered = 0;
+	}
+}
+
+void CoverageMask::MarkAll()
+{
+	std::fill(m_tiles.begin(), m_tiles.end(), (uint8_t)1);
+	m_numCovered = (uint32_t)m_tiles.size();
+}
+
+void CoverageMask::MarkPixelBox(Vec2f in_minPixel, Vec2f in_maxPixel)
+{
+	if(m_numCovered == m_tiles.size())
+	{
+		return;
+	}
+
+	// Clip to the texture
+	const Vec2f pixelSize = Vec2f(m_dims) * m_tileExtents;
+	const Vec2f minPixel = Math::Max(in_minPixel, Vec2f::Zero);
+	const Vec2f maxPixel = Math::Min(in_maxPixel, pixelSize);
+	if(maxPixel.x <= minPixel.x || maxPixel.y <= minPixel.y)
+	{
+		return;
+	}
+
+	// Tile range touched by the box (a box ending exactly on a tile edge doesn't touch the next tile)
+	const int32_t minX = std::min(Math::FloorToInt(minPixel.x / m_tileExtents.x), m_dims.x - 1);
+	const int32_t minY = std::min(Math::FloorToInt(minPixel.y / m_tileExtents.y), m_dims.y - 1);
+	const int32_t maxX = std::min((int32_t)Math::Ceil(maxPixel.x / m_tileExtents.x) - 1, m_dims.x - 1);
+	const int32_t maxY = std::min((int32_t)Math::Ceil(maxPixel.y / m_tileExtents.y) - 1, m_dims.y - 1);
+	for(int32_t tileY = minY; tileY <= maxY; ++tileY)
+	{
+		for(int32_t tileX = minX; tileX <= maxX; ++tileX)
+		{
+			uint8_t& tile = m_tiles[tileY * m_dims.x + tileX];
+			m_numCovered += 1 - tile;
+			tile = 1;
+		}
+	}
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include "Vec2.h"
+
+///////////////////////////////////////////////////////
+// CoverageMask:
+// coarse record of which tiles of a render texture anything was drawn into. the tiles evenly divide the texture (so they can be slightly
+// smaller than the requested tile size), which lets a shader sample the mask with the same texture coordinates as the texture itself
+// pixel positions are y-up, with row 0 at the bottom of the texture (matching how our render textures are laid out in gl)
+class CoverageMask
+{
+public:
+	void Reset(Vec2u in_pixelSize, int32_t in_tileSize);
+	void Clear();
+	void MarkAll();
+	void MarkPixelBox(Vec2f in_minPixel, Vec2f in_maxPixel); // clipped to the texture, empty boxes mark nothing
+
+	Vec2i GetDims() const { return m_dims; }
+	bool IsCovered(int32_t in_tileX, int32_t in_tileY) const { return m_tiles[in_tileY * m_dims.x + in_tileX] != 0; }
+	uint32_t GetNumCovered() const { return m_numCovered; }
+	const std::vector<uint8_t>& GetTiles() const { return m_tiles; } // one byte per tile (0 or 1), row-major from the bottom row
+
+private:
+	Vec2i m_dims = { 0, 0 };
+	Vec2f m_tileExtents = { 0.0f, 0.0f }; // tile size in pixels, after dividing the texture evenly
+	std::vector<uint8_t> m_tiles;
+	uint32_t m_numCovered = 0;
+};
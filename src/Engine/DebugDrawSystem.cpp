@@ -59,7 +59,8 @@ DebugDrawSystem::DDrawText::DDrawText(Vec2f in_p0, const std::string& in_str, sf
 {
 	m_lifetime = in_lifetime;
 
-	if (!m_font)
+	// laying out the text rasterizes its glyphs into the font's texture, so headless debug text goes without a font (like TextComponent)
+	if (!m_font && !GameWindow::IsHeadless())
 	{
 		InitializeFont();
 	}
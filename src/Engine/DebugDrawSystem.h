@@ -99,8 +99,8 @@ private:
 			Setup(m_verts, in_color, in_TM, in_lifetime);
 		}
 
-		void Draw(sf::RenderTarget* in_window) const {
-			in_window->draw(&m_verts[0], m_verts.size(), sf::PrimitiveType::Lines);
+		void Draw(RenderTexture& in_target) const {
+			in_target.DrawSFML(&m_verts[0], m_verts.size(), sf::PrimitiveType::Lines, sf::RenderStates::Default);
 		}
 
 	private:
@@ -119,8 +119,8 @@ private:
 			Setup(m_verts, in_color, in_TM, in_lifetime);
 		}
 
-		void Draw(sf::RenderTarget* in_window) const {
-			in_window->draw(&m_verts[0], m_verts.size(), sf::PrimitiveType::LineStrip);
+		void Draw(RenderTexture& in_target) const {
+			in_target.DrawSFML(&m_verts[0], m_verts.size(), sf::PrimitiveType::LineStrip, sf::RenderStates::Default);
 		}
 
 	private:
@@ -138,8 +138,8 @@ private:
 			Setup(m_verts, in_color, in_TM, in_lifetime);
 		}
 
-		void Draw(sf::RenderTarget* in_window) const {
-			in_window->draw(&m_verts[0], m_verts.size(), sf::PrimitiveType::LineStrip);
+		void Draw(RenderTexture& in_target) const {
+			in_target.DrawSFML(&m_verts[0], m_verts.size(), sf::PrimitiveType::LineStrip, sf::RenderStates::Default);
 		}
 
 	private:
@@ -164,8 +164,8 @@ private:
 			Setup(m_verts, in_color, in_TM, in_lifetime);
 		}
 
-		void Draw(sf::RenderTarget* in_window) const {
-			in_window->draw(&m_verts[0], m_verts.size(), sf::PrimitiveType::LineStrip);
+		void Draw(RenderTexture& in_target) const {
+			in_target.DrawSFML(&m_verts[0], m_verts.size(), sf::PrimitiveType::LineStrip, sf::RenderStates::Default);
 		}
 
 	private:
@@ -176,8 +176,8 @@ private:
 	{
 		DDrawText(Vec2f in_p0, const std::string& in_str, sf::Color in_color, Transform in_TM, float in_lifetime);
 
-		void Draw(sf::RenderTarget* in_window) const {
-			in_window->draw(m_text);
+		void Draw(RenderTexture& in_target) const {
+			in_target.DrawSFML(m_text, sf::RenderStates::Default);
 		}
 
 
@@ -198,7 +198,6 @@ private:
 	{
 		// get the render target to draw to (we want to draw on top of all post processing)
 		std::shared_ptr<RenderTexture> renderTarget = GetWindow()->GetPostProcessRenderTarget();
-		sf::RenderTexture* sfmlRenderTarget = renderTarget->GetSFMLRenderTexture();
 
 		// this texture's view tm will be in view space - set it to world space for debug drawing
 		const Box2f prevView = renderTarget->GetView();
@@ -207,7 +206,7 @@ private:
 		// draw all and tick lifetimes
 		for (DrawableT& drawable : inout_drawables)
 		{
-			drawable.Draw(sfmlRenderTarget);
+			drawable.Draw(*renderTarget);
 			drawable.m_lifetime -= Time::DT();
 		}
 
@@ -6,6 +6,7 @@
 #include "GameWindow.h"
 #include "Engine/PhysicsSystem.h"
 #include "Engine/DebugDrawSystem.h"
+#include "Engine/SortUtils.h"
 
 #include <SFML/System.hpp>
 
@@ -50,15 +51,19 @@ void GameBase::Run()
 
 	SetTimeDilation(1.0f);
 
+	// Headless runs step a fixed 60hz as fast as they can, so every run simulates the same frames
+	const bool bHeadless = GameWindow::IsHeadless();
+	const float fixedDt = 1.0f / 60.0f;
+
 	// Main game loop
 	g_realTime = GetElapsedTime();
-	while(m_window->IsOpen())
+	while(m_window->IsOpen() && (m_maxFrames <= 0 || m_frameCount < m_maxFrames))
 	{
 		// Update time
 		auto newRealTime = GetElapsedTime();
 		g_realDt = newRealTime - g_realTime;
 		g_realTime = newRealTime;
-		g_audioDt = !ShouldPause ? g_realDt : 0.0f; // Audio + game delta-time is 0 when paused
+		g_audioDt = !ShouldPause ? (bHeadless ? fixedDt : g_realDt) : 0.0f; // Audio + game delta-time is 0 when paused
 		g_audioTime += g_audioDt;
 		float gameDt = std::min(g_audioDt, 2.0f / 60.0f); //< Clamp DT() to last no more than 2 frames (at 60hz)
 		g_gameDt = gameDt * m_timeDilation;
@@ -72,9 +77,10 @@ void GameBase::Run()
 
 		// Draw the frame
 		Draw();
+		++m_frameCount;
 
 		// Cap FPS
-		if(m_frameRateCap > 0)
+		if(m_frameRateCap > 0 && !bHeadless)
 		{
 			float frameDur = 1.0f / m_frameRateCap;
 			while(GetElapsedTime() - g_realTime < frameDur)
@@ -180,6 +186,14 @@ void GameBase::Update()
 	}
 	updateStage(eUpdateStage::PostPhysics);
 	updateStage(eUpdateStage::Final);
+
+	// Drop dead actors from the draw list too (both lists hold the same actors in different orders, so they only differ in size when some died)
+	if(m_drawActors.size() != m_actors.size())
+	{
+		m_drawActors.erase(std::remove_if(m_drawActors.begin(), m_drawActors.end(), [](const auto& in_actor) {
+			return !IsAlive(in_actor);
+		}), m_drawActors.end());
+	}
 	//m_debugDrawCallback();
 }
 void GameBase::Draw()
@@ -187,16 +201,24 @@ void GameBase::Draw()
 	// Clear frame buffer
 	m_window->Clear();
 
-	// Draw all actors
-	auto actorDrawList = m_actors;
-	std::stable_sort(actorDrawList.begin(), actorDrawList.end(), [](auto lhs, auto rhs) { return lhs->GetDrawLayer() < rhs->GetDrawLayer(); });
-	for(auto actor : actorDrawList)
+	// Draw all actors (the draw list is kept in draw layer order, so it only needs re-sorting after a draw layer change)
+	if(m_bDrawOrderDirty)
 	{
+		InsertionSort(m_drawActors.begin(), m_drawActors.end(), [](const auto& lhs, const auto& rhs) {
+			return lhs->m_drawLayer != rhs->m_drawLayer ? lhs->m_drawLayer < rhs->m_drawLayer : lhs->m_drawSeq < rhs->m_drawSeq;
+		});
+		m_bDrawOrderDirty = false;
+	}
+	const size_t numDrawActors = m_drawActors.size(); // actors spawned while drawing are drawn from the next frame on
+	for(size_t drawIdx = 0; drawIdx < numDrawActors; ++drawIdx)
+	{
+		auto actor = m_drawActors[drawIdx];
 		if(IsAlive(actor))
 		{
 			actor->Draw();
 		}
 	}
+	m_window->FlushSprites();
 
 	m_window->ApplyPostProcessing();
 
@@ -217,4 +239,12 @@ InputSystem* GameBase::GetInputSystem() const
 void GameBase::RegisterActor(std::shared_ptr<Actor> in_actor)
 {
 	m_actors.push_back(in_actor);
+
+	// Appending keeps the draw list sorted unless an actor on a higher draw layer is already last (the new actor has the highest seq)
+	in_actor->m_drawSeq = m_nextDrawSeq++;
+	if(!m_drawActors.empty() && m_drawActors.back()->m_drawLayer > in_actor->m_drawLayer)
+	{
+		m_bDrawOrderDirty = true;
+	}
+	m_drawActors.push_back(in_actor);
 }
\ No newline at end of file
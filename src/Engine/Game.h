@@ -31,6 +31,8 @@ public:
 
 	// Time + pause management
 	void SetFrameRateCap(int32_t in_frameRateCap);
+	void SetMaxFrames(int32_t in_maxFrames) { m_maxFrames = in_maxFrames; } // Run() returns after this many frames (0 = until the window closes)
+	int32_t GetFrameCount() const { return m_frameCount; }
 	void SetTimeDilation(float in_timeDilation);
 	float GetTimeDilation() const { return m_timeDilation; }
 	TokenList<> ShouldPause;
@@ -41,6 +43,7 @@ public:
 protected:
 	friend class Actor;
 	void RegisterActor(std::shared_ptr<Actor> in_actor);
+	void MarkDrawOrderDirty() { m_bDrawOrderDirty = true; }
 
 private:
 	std::function<void()> m_physicsCallback;
@@ -48,7 +51,12 @@ private:
 	std::shared_ptr<GameWindow> m_window;
 	std::shared_ptr<DebugDrawSystem> m_debugDrawSystem;
 	std::vector<std::shared_ptr<Actor>> m_actors;
+	std::vector<std::shared_ptr<Actor>> m_drawActors; // m_actors sorted by (draw layer, registration order), re-sorted in Draw() when m_bDrawOrderDirty is set
+	uint32_t m_nextDrawSeq = 0;
+	bool m_bDrawOrderDirty = false;
 	int32_t m_frameRateCap = 60;
+	int32_t m_maxFrames = 0;
+	int32_t m_frameCount = 0;
 	float m_timeDilation = 1.0;
 	uint32_t m_updateId = 0;
 };
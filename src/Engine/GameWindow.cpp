@@ -3,31 +3,60 @@
 #include <SFML/Graphics.hpp>
 #include "InputSystem.h"
 #include "RenderTexture.h"
+#include "RenderTargetPool.h"
 #include "Game.h"
 #include "LayerManager.h"
 #include "Engine/Editor/ImguiIntegration.h"
 
+static eRenderBackend s_renderBackend = eRenderBackend::SFML;
+
 GameWindow::GameWindow(const Vec2i& in_windowSize, const Vec2i& in_renderSize, const std::wstring& in_title)
 {
-	m_window = std::make_shared<sf::RenderWindow>(sf::VideoMode(in_windowSize.x, in_windowSize.y, 32), sf::String(in_title));
+	if(!IsHeadless())
+	{
+		m_window = std::make_shared<sf::RenderWindow>(sf::VideoMode(in_windowSize.x, in_windowSize.y, 32), sf::String(in_title));
+	}
+	m_headlessWindowSize = in_windowSize;
 	m_inputSys = std::make_shared<InputSystem>();
 	m_layerManager = std::make_shared<LayerManager>();
+	m_pixelSmoothTargets = std::make_unique<RenderTargetPool>();
 
 	SetRenderSize(in_renderSize);
 	RefreshWindowView(in_windowSize);
 	SetWorldView(Box2f::FromCenter({ 0.0f, 0.0f }, Vec2f(in_renderSize)));
 
-	m_imgui = std::make_shared<ImguiIntegration>(*this);
+	if(!IsHeadless())
+	{
+		m_imgui = std::make_shared<ImguiIntegration>(*this);
+	}
 }
 GameWindow::~GameWindow()
 {
 }
+void GameWindow::SetRenderBackend(eRenderBackend in_backend)
+{
+	SQUID_RUNTIME_CHECK(!GameBase::Get(), "Render backend must be selected before the game window is created");
+	s_renderBackend = in_backend;
+}
+eRenderBackend GameWindow::GetRenderBackend()
+{
+	return s_renderBackend;
+}
 void GameWindow::SetTitle(const std::wstring& in_title)
 {
-	m_window->setTitle(in_title);
+	if(m_window)
+	{
+		m_window->setTitle(in_title);
+	}
 }
 void GameWindow::Update()
 {
+	// No window events or input devices to poll when headless
+	if(!m_window)
+	{
+		return;
+	}
+
 	sf::Event e;
 	while(m_window->pollEvent(e))
 	{
@@ -61,12 +90,21 @@ void GameWindow::Clear()
 {
 	m_renderTexture->Clear(m_viewClearColor);
 	m_postProcessTexture->Clear(m_viewClearColor);
-	m_window->clear(m_windowClearColor);
+	if(m_window)
+	{
+		m_window->clear(m_windowClearColor);
+	}
 	m_layerManager->Clear();
 }
 bool GameWindow::IsOpen() const
 {
-	return m_window->isOpen();
+	return !m_window || m_window->isOpen();
+}
+
+void GameWindow::FlushSprites()
+{
+	m_renderTexture->FlushSprites();
+	m_layerManager->FlushSprites();
 }
 
 void GameWindow::ApplyPostProcessing()
@@ -100,34 +138,33 @@ void GameWindow::Swap()
 		const Vec2f intermediateScale = Math::Max(Vec2f::One, Math::Round(texScale * pixelAspectScale));
 		const Vec2f intermediateSize = Vec2f(postPostProcessTexture->GetSize()) * intermediateScale;
 
-		// allocate/resize intermediate texture as necessary
-		if (!m_pixelConserveAspectRenderTexture || m_pixelConserveAspectRenderTexture->GetSize() != intermediateSize)
-		{
-			m_pixelConserveAspectRenderTexture = std::make_shared<RenderTexture>(intermediateSize);
-		}
-		m_pixelConserveAspectRenderTexture->Clear(m_viewClearColor);
+		// grab an intermediate texture at least that big (only the intermediateSize part of it is drawn to the window)
+		const std::shared_ptr<RenderTexture> intermediateTexture = m_pixelSmoothTargets->Acquire(Vec2u(intermediateSize));
+		intermediateTexture->Clear(m_viewClearColor);
 
 		// set texture filtering
 		postPostProcessTexture->SetSmooth(false);
-		m_pixelConserveAspectRenderTexture->SetSmooth(true);
+		intermediateTexture->SetSmooth(true);
 
 		// draw render texture at integer scale into our intermediate texture
 		const Transform gameTexTM{ Vec2f::Zero, 0.0f, intermediateScale };
-		postPostProcessTexture->Draw(gameTexTM, m_pixelConserveAspectRenderTexture);
+		postPostProcessTexture->Draw(gameTexTM, intermediateTexture);
 
 		// draw intermediate texture onto window, scaled and texPositioned the rest of the way
 		const Transform finalTexTM{ baseGameTexTM.pos, 0.0f, texScale / intermediateScale };
-		m_pixelConserveAspectRenderTexture->Draw(finalTexTM);
+		intermediateTexture->Draw(finalTexTM);
 	}
 	else
 	{
 		postPostProcessTexture->Draw(GetWindowToRenderTextureTransform());
 	}
 
-	m_imgui->Draw(*this);
-
 	// draw the view texture to the window, then display the window
-	m_window->display();
+	if(m_window)
+	{
+		m_imgui->Draw(*this);
+		m_window->display();
+	}
 }
 
 Transform GameWindow::GetWindowToRenderTextureTransform() const
@@ -201,7 +238,7 @@ void GameWindow::SetScalingMode(eWindowScalingMode in_mode)
 	{
 		if (in_mode != eWindowScalingMode::PixelSmooth)
 		{
-			m_pixelConserveAspectRenderTexture = {};
+			m_pixelSmoothTargets->Clear();
 		}
 	}
 
@@ -212,11 +249,18 @@ void GameWindow::RefreshWindowView(Vec2f in_windowSize)
 {
 	// set the window to use pixel coordinates, with (0, 0) in the bottom left
 	sf::View view(sf::FloatRect(0.0f, in_windowSize.y, in_windowSize.x, -in_windowSize.y));
-	m_window->setView(view);
+	if(m_window)
+	{
+		m_window->setView(view);
+	}
 }
 
 Vec2u GameWindow::GetWindowSize() const
 {
+	if(!m_window)
+	{
+		return m_headlessWindowSize;
+	}
 	auto windowSize = m_window->getSize();
 	return { windowSize.x, windowSize.y };
 }
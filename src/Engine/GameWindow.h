@@ -13,6 +13,7 @@ namespace sf
 }
 class InputSystem;
 class RenderTexture;
+class RenderTargetPool;
 class Shader;
 class ImguiIntegration;
 class LayerManager;
@@ -28,6 +29,12 @@ enum class eWindowScalingMode
 	FillWindow,
 };
 
+enum class eRenderBackend
+{
+	SFML,
+	Null, // headless: no window, input or imgui, and draws are only counted in the render stats (see RenderTexture::GetRenderStats())
+};
+
 // Game Window
 class GameWindow
 {
@@ -35,8 +42,14 @@ public:
 	GameWindow(const Vec2i& in_windowSize, const Vec2i& in_renderSize, const std::wstring& in_title);
 	~GameWindow();
 
+	// Render backend (must be selected before the window is created)
+	static void SetRenderBackend(eRenderBackend in_backend);
+	static eRenderBackend GetRenderBackend();
+	static bool IsHeadless() { return GetRenderBackend() == eRenderBackend::Null; }
+
 	void Update();
 	void Clear();
+	void FlushSprites(); // draws the sprites still queued on the game render texture and every layer
 	void ApplyPostProcessing();
 	void Swap();
 
@@ -68,7 +81,7 @@ public:
 	std::shared_ptr<LayerManager> GetLayerManager() const { return m_layerManager; }
 	std::shared_ptr<RenderTexture> GetRenderTarget() const;
 	std::shared_ptr<RenderTexture> GetPostProcessRenderTarget() const;
-	sf::RenderWindow* GetSFMLWindow() const;
+	sf::RenderWindow* GetSFMLWindow() const; // null when headless
 	InputSystem* GetInputSystem() const;
 
 private:
@@ -80,7 +93,8 @@ private:
 	sf::Color m_windowClearColor = sf::Color(32, 32, 32);
 	sf::Color m_viewClearColor = sf::Color::Black;
 
-	std::shared_ptr<sf::RenderWindow> m_window;
+	std::shared_ptr<sf::RenderWindow> m_window; // null when headless
+	Vec2u m_headlessWindowSize;
 	std::shared_ptr<InputSystem> m_inputSys;
 
 	std::shared_ptr<LayerManager> m_layerManager;
@@ -90,9 +104,9 @@ private:
 	std::shared_ptr<RenderTexture> m_renderTexture;
 	// if post-processing shader is set, m_renderTexture is drawn into m_postProcessTexture using it. otherwise, it's just copied
 	std::shared_ptr<RenderTexture> m_postProcessTexture;
-	// if using PixelSmooth scaling mode, m_postProcessTexture is draw into m_pixelConserveAspectRenderTexture with pixel-perfect scaling as close to the final window size as possible, then m_pixelConserveAspectRenderTexture is bilinear scaled to the final window size
+	// if using PixelSmooth scaling mode, m_postProcessTexture is draw into an intermediate texture from m_pixelSmoothTargets with pixel-perfect scaling as close to the final window size as possible, then the intermediate texture is bilinear scaled to the final window size
 	// otherwise, m_postProcessTexture is rendered directly to the final window with scaling based on the selected scaling mode
-	std::shared_ptr<RenderTexture> m_pixelConserveAspectRenderTexture;
+	std::unique_ptr<RenderTargetPool> m_pixelSmoothTargets; // reused across sizes, so resizing the window doesn't reallocate the intermediate texture
 
 	std::shared_ptr<ImguiIntegration> m_imgui;
 };
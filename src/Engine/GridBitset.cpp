@@ -0,0 +1,73 @@
+#include "GridBitset.h"
+
+//--- GridBitset ---//
+void GridBitset::Reset(Box2i in_gridBox)
+{
+	m_gridBox = in_gridBox;
+	m_wordsPerRow = (Math::Max(m_gridBox.w, 0) + 63) / 64;
+	m_words.assign((size_t)m_wordsPerRow * (size_t)Math::Max(m_gridBox.h, 0), 0);
+}
+
+bool GridBitset::Test(Vec2i in_gridPos) const
+{
+	if(!m_gridBox.Contains_InclExcl(in_gridPos)) return false;
+
+	const int32_t localCol = in_gridPos.x - m_gridBox.x;
+	const int32_t localRow = in_gridPos.y - m_gridBox.y;
+	return (m_words[GetWordIdx(localCol, localRow)] >> (localCol & 63)) & 1;
+}
+
+void GridBitset::Set(Vec2i in_gridPos, bool in_bValue)
+{
+	if(!m_gridBox.Contains_InclExcl(in_gridPos)) return;
+
+	const int32_t localCol = in_gridPos.x - m_gridBox.x;
+	const int32_t localRow = in_gridPos.y - m_gridBox.y;
+	const uint64_t bit = uint64_t(1) << (localCol & 63);
+	uint64_t& word = m_words[GetWordIdx(localCol, localRow)];
+	word = in_bValue ? (word | bit) : (word & ~bit);
+}
+
+bool GridBitset::AnyInRow(int32_t in_row, int32_t in_colMin, int32_t in_colMax) const
+{
+	const int32_t localRow = in_row - m_gridBox.y;
+	if(localRow < 0 || localRow >= m_gridBox.h) return false;
+
+	const int32_t localMin = Math::Max(in_colMin - m_gridBox.x, 0);
+	const int32_t localMax = Math::Min(in_colMax - m_gridBox.x, m_gridBox.w - 1);
+	if(localMin > localMax) return false;
+
+	const size_t firstWord = GetWordIdx(localMin, localRow);
+	const size_t lastWord = GetWordIdx(localMax, localRow);
+	const uint64_t firstMask = ~uint64_t(0) << (localMin & 63);
+	const uint64_t lastMask = ~uint64_t(0) >> (63 - (localMax & 63));
+
+	if(firstWord == lastWord)
+	{
+		return (m_words[firstWord] & firstMask & lastMask) != 0;
+	}
+
+	if(m_words[firstWord] & firstMask) return true;
+	for(size_t wordIdx = firstWord + 1; wordIdx < lastWord; ++wordIdx)
+	{
+		if(m_words[wordIdx]) return true;
+	}
+	return (m_words[lastWord] & lastMask) != 0;
+}
+
+bool GridBitset::AnyInColumn(int32_t in_col, int32_t in_rowMin, int32_t in_rowMax) const
+{
+	const int32_t localCol = in_col - m_gridBox.x;
+	if(localCol < 0 || localCol >= m_gridBox.w) return false;
+
+	const int32_t localMin = Math::Max(in_rowMin - m_gridBox.y, 0);
+	const int32_t localMax = Math::Min(in_rowMax - m_gridBox.y, m_gridBox.h - 1);
+
+	// columns stride across rows, so this is one word test per row
+	const uint64_t bit = uint64_t(1) << (localCol & 63);
+	for(int32_t localRow = localMin; localRow <= localMax; ++localRow)
+	{
+		if(m_words[GetWordIdx(localCol, localRow)] & bit) return true;
+	}
+	return false;
+}
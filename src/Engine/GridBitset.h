@@ -0,0 +1,33 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include "Box.h"
+
+///////////////////////////////////////////////////////
+// GridBitset: 
+// one bit per grid cell, packed row-major into 64-bit words so a whole span of a row can be tested with a couple of mask ops.
+// used to cache which cells of a tile layer are solid, so collision queries don't have to chase the tile layer's tile ids
+class GridBitset
+{
+public:
+	// clears all bits and resizes to cover in_gridBox (cells outside the box always read as unset)
+	void Reset(Box2i in_gridBox);
+
+	Box2i GetGridBox() const { return m_gridBox; }
+
+	bool Test(Vec2i in_gridPos) const;
+	void Set(Vec2i in_gridPos, bool in_bValue);
+
+	// inclusive spans, clipped to the grid box
+	bool AnyInRow(int32_t in_row, int32_t in_colMin, int32_t in_colMax) const;
+	bool AnyInColumn(int32_t in_col, int32_t in_rowMin, int32_t in_rowMax) const;
+
+private:
+	size_t GetWordIdx(int32_t in_localCol, int32_t in_localRow) const { return (size_t)in_localRow * m_wordsPerRow + (size_t)(in_localCol >> 6); }
+
+	Box2i m_gridBox = { 0, 0, 0, 0 };
+	int32_t m_wordsPerRow = 0;
+	std::vector<uint64_t> m_words;
+};
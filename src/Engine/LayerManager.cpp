@@ -17,67 +17,191 @@ void RenderLayer::SetView(const Box2f& in_view, float in_angle /*= 0.0f*/)
 	m_renderTexture->SetView(in_view, in_angle);
 }
 
+uint32_t RenderLayer::GetSpriteDrawCallCount() const
+{
+	return m_renderTexture->GetSpriteDrawCallCount();
+}
+
+void RenderLayer::SetCoverageTileSize(int32_t in_tileSize)
+{
+	m_coverageTileSize = in_tileSize;
+	m_renderTexture->SetCoverageTileSize(in_tileSize);
+}
+
 void RenderLayer::Resize(Vec2u in_size)
 {
 	m_renderTexture = std::make_shared<RenderTexture>(in_size);
+	if (m_coverageTileSize > 0)
+	{
+		m_renderTexture->SetCoverageTileSize(m_coverageTileSize);
+	}
 }
 
 
 /////////////////////////////////////////////////////////////////////
-void LayerManager::AddLayer(const std::string& in_name)
+RenderLayerId LayerManager::AddLayer(const std::string& in_name)
 {
-	if (GetLayer(in_name))
+	if (FindLayerId(in_name) != InvalidRenderLayerId)
 	{
 		SQUID_RUNTIME_ERROR("Layer already exists");
+		return InvalidRenderLayerId;
+	}
+	if (m_layers.size() >= s_maxLayers)
+	{
+		SQUID_RUNTIME_ERROR("Too many render layers");
+		return InvalidRenderLayerId;
+	}
+
+	m_layers.reserve(s_maxLayers);
+	m_layers.emplace_back(m_renderSize);
+	m_layerNames.push_back(in_name);
+	m_layerUniformNames.push_back(GetLayerUniformName(in_name));
+	m_layerCoverageUniformNames.push_back(GetLayerCoverageUniformName(in_name));
+	m_bLayerUniformsDirty = true;
+	if (in_name == s_defaultLayerName)
+	{
+		m_defaultLayerId = (RenderLayerId)(m_layers.size() - 1);
+	}
+
+	if(!m_emptyTexture)
+	{
+		m_emptyTexture = std::make_shared<RenderTexture>(Vec2i{ 1, 1 });
+		m_emptyTexture->Clear(sf::Color::Transparent);
+	}
+	return (RenderLayerId)(m_layers.size() - 1);
+}
+
+RenderLayer* LayerManager::GetLayer(RenderLayerId in_layerId)
+{
+	return in_layerId < m_layers.size() ? &m_layers[in_layerId] : nullptr;
+}
+
+RenderLayerId LayerManager::FindLayerId(const std::string& in_name) const
+{
+	for (size_t layerIdx = 0; layerIdx < m_layerNames.size(); ++layerIdx)
+	{
+		if (m_layerNames[layerIdx] == in_name)
+		{
+			return (RenderLayerId)layerIdx;
+		}
 	}
+	return InvalidRenderLayerId;
+}
 
-	m_layers.emplace(in_name, m_renderSize);
+const std::string& LayerManager::GetLayerName(RenderLayerId in_layerId) const
+{
+	static const std::string s_invalidName;
+	return in_layerId < m_layerNames.size() ? m_layerNames[in_layerId] : s_invalidName;
 }
 
 RenderLayer* LayerManager::GetLayer(const std::string& in_name)
 {
-	auto found = m_layers.find(in_name);
-	if(found != m_layers.end())
+	return GetLayer(FindLayerId(in_name));
+}
+
+const std::string& LayerManager::GetLayerUniformName(RenderLayerId in_layerId) const
+{
+	static const std::string s_invalidName;
+	return in_layerId < m_layerUniformNames.size() ? m_layerUniformNames[in_layerId] : s_invalidName;
+}
+
+const std::string& LayerManager::GetLayerCoverageUniformName(RenderLayerId in_layerId) const
+{
+	static const std::string s_invalidName;
+	return in_layerId < m_layerCoverageUniformNames.size() ? m_layerCoverageUniformNames[in_layerId] : s_invalidName;
+}
+
+void LayerManager::BindShaderUniforms(std::shared_ptr<Shader> in_shader)
+{
+	if (m_bLayerUniformsDirty || m_layerUniformsShader.lock() != in_shader || m_layerUniformsShaderLoadCount != in_shader->GetLoadCount())
 	{
-		return &found->second;
+		RebuildLayerUniforms(in_shader);
+	}
+
+	for (auto& uniform : m_layerUniforms)
+	{
+		// layers that weren't drawn to this frame are fully transparent, so the shared empty texture samples the same without resolving the layer
+		// (headless, both textures are null, so there's never anything to bind)
+		const auto& renderTexture = m_layers[uniform.m_layerId].m_renderTexture;
+		const RenderTexture* boundRenderTexture = renderTexture->HasDrawnContent() ? renderTexture.get() : m_emptyTexture.get();
+		const sf::Texture* texture = boundRenderTexture->GetSFMLTexture();
+		uniform.m_boundRenderTexture = boundRenderTexture;
+		if (texture && uniform.m_boundTexture != texture)
+		{
+			in_shader->SetUniform(m_layerUniformNames[uniform.m_layerId], *texture);
+			uniform.m_boundTexture = texture;
+		}
+
+		// the coverage texture is re-uploaded in place when it changes, so it only needs binding once
+		const sf::Texture* coverageTexture = renderTexture->GetCoverageTexture();
+		if (coverageTexture && uniform.m_boundCoverageTexture != coverageTexture)
+		{
+			in_shader->SetUniform(m_layerCoverageUniformNames[uniform.m_layerId], *coverageTexture);
+			uniform.m_boundCoverageTexture = coverageTexture;
+		}
 	}
+}
 
-	return nullptr;
+const RenderTexture* LayerManager::GetBoundLayerTexture(RenderLayerId in_layerId) const
+{
+	return in_layerId < m_layerUniforms.size() ? m_layerUniforms[in_layerId].m_boundRenderTexture : nullptr; // the table is built in layer id order
 }
 
-void LayerManager::BindShaderUniforms(std::shared_ptr<Shader> in_shader) const
+void LayerManager::RebuildLayerUniforms(std::shared_ptr<Shader> in_shader)
 {
-	for (auto it = m_layers.begin(); it != m_layers.end(); it++)
+	m_layerUniforms.clear();
+	for (size_t layerIdx = 0; layerIdx < m_layers.size(); ++layerIdx)
 	{
-		in_shader->SetUniform(it->first + "Texture", it->second.m_renderTexture);
+		m_layerUniforms.push_back({ (RenderLayerId)layerIdx });
 	}
+	m_layerUniformsShader = in_shader;
+	m_layerUniformsShaderLoadCount = in_shader->GetLoadCount();
+	m_bLayerUniformsDirty = false;
 }
 
 void LayerManager::SetWorldView(const Box2f& in_view, float in_angle /*= 0.0f*/)
 {
-	for (auto it = m_layers.begin(); it != m_layers.end(); it++)
+	for (auto& layer : m_layers)
 	{
-		if (it->second.m_viewMode == eRenderLayerViewMode::World)
+		if (layer.m_viewMode == eRenderLayerViewMode::World)
 		{
-			it->second.SetView(in_view, in_angle);
+			layer.SetView(in_view, in_angle);
 		}
 	}
 }
 
 void LayerManager::Clear()
 {
-	for (auto it = m_layers.begin(); it != m_layers.end(); it++)
+	m_numLayersCleared = 0;
+	m_numLayersSkipped = 0;
+	for (auto& layer : m_layers)
+	{
+		if (layer.m_renderTexture->Clear(sf::Color::Transparent))
+		{
+			++m_numLayersCleared;
+		}
+		else
+		{
+			++m_numLayersSkipped;
+		}
+	}
+}
+
+void LayerManager::FlushSprites() const
+{
+	for (const auto& layer : m_layers)
 	{
-		it->second.m_renderTexture->Clear(sf::Color::Transparent);
+		layer.m_renderTexture->FlushSprites();
 	}
 }
 
 void LayerManager::SetRenderSize(Vec2u in_size)
 {
 	m_renderSize = in_size;
+	m_bLayerUniformsDirty = true;
 
-	for (auto it = m_layers.begin(); it != m_layers.end(); it++)
+	for (auto& layer : m_layers)
 	{
-		it->second.Resize(in_size);
+		layer.Resize(in_size);
 	}
 }
@@ -2,7 +2,8 @@
 
 #include <memory>
 #include <string>
-#include <map>
+#include <vector>
+#include <cstdint>
 
 #include "Vec2.h"
 #include "Box.h"
@@ -11,6 +12,15 @@
 class RenderTexture;
 class Shader;
 
+namespace sf
+{
+	class Texture;
+}
+
+// dense index of a registered render layer (see LayerManager::AddLayer())
+using RenderLayerId = uint8_t;
+static constexpr RenderLayerId InvalidRenderLayerId = 0xFF;
+
 enum class eRenderLayerViewMode
 {
 	World,
@@ -28,10 +38,16 @@ public:
 	std::shared_ptr<RenderTexture> GetRenderTexture() const { return m_renderTexture; }
 	void SetView(const Box2f& in_view, float in_angle = 0.0f);
 
+	uint32_t GetSpriteDrawCallCount() const; // sprite draw calls issued on this layer since it was last cleared
+
+	// tracks which tiles of the layer were drawn into (see RenderTexture::SetCoverageTileSize()), and binds them as "<layerName>Coverage"
+	void SetCoverageTileSize(int32_t in_tileSize);
+
 private:
 	friend class LayerManager;
 
 	std::shared_ptr<RenderTexture> m_renderTexture;
+	int32_t m_coverageTileSize = 0;
 	void Resize(Vec2u in_size);
 };
 
@@ -39,15 +55,62 @@ private:
 class LayerManager
 {
 public:
-	void AddLayer(const std::string& in_name);
+	// layer ids are handed out in registration order. resolve names to ids once (at load time), and use ids from then on
+	static constexpr size_t s_maxLayers = 32;
+	RenderLayerId AddLayer(const std::string& in_name);
+	RenderLayer* GetLayer(RenderLayerId in_layerId);
+	size_t GetNumLayers() const { return m_layers.size(); }
+
+	// the layer draw components start out on ("fgGameplay"), cached when it's added so spawning doesn't look it up by name
+	static constexpr const char* s_defaultLayerName = "fgGameplay";
+	RenderLayerId GetDefaultLayerId() const { return m_defaultLayerId; }
+
+	// name lookups (linear scan, for loading and tooling)
+	RenderLayerId FindLayerId(const std::string& in_name) const;
+	const std::string& GetLayerName(RenderLayerId in_layerId) const;
 	RenderLayer* GetLayer(const std::string& in_name);
 	
-	void BindShaderUniforms(std::shared_ptr<Shader> in_shader) const;
+	// binds each layer's texture to the "<layerName>Texture" uniform (and its coverage texture to "<layerName>Coverage", if tracked)
+	void BindShaderUniforms(std::shared_ptr<Shader> in_shader);
+	static std::string GetLayerUniformName(const std::string& in_layerName) { return in_layerName + "Texture"; }
+	static std::string GetLayerCoverageUniformName(const std::string& in_layerName) { return in_layerName + "Coverage"; }
+	const std::string& GetLayerUniformName(RenderLayerId in_layerId) const; // the above, built once when the layer is added
+	const std::string& GetLayerCoverageUniformName(RenderLayerId in_layerId) const;
 	void SetWorldView(const Box2f& in_view, float in_angle = 0.0f);
-	void Clear();
+	void Clear(); // only clears layers that were drawn to since their last clear
+	void FlushSprites() const;
 	void SetRenderSize(Vec2u in_size);
 
+	// stats for the last Clear()
+	uint32_t GetNumLayersCleared() const { return m_numLayersCleared; }
+	uint32_t GetNumLayersSkipped() const { return m_numLayersSkipped; }
+
+	// the render texture the layer's uniform sampled at the last BindShaderUniforms() (the layer's own, or the shared empty texture)
+	const RenderTexture* GetBoundLayerTexture(RenderLayerId in_layerId) const;
+
 private:
-	std::map<std::string, RenderLayer> m_layers;
+	std::vector<RenderLayer> m_layers; // indexed by RenderLayerId, capacity reserved up front so layer pointers stay valid
+	std::vector<std::string> m_layerNames;
+	std::vector<std::string> m_layerUniformNames; // "<layerName>Texture", by layer id
+	std::vector<std::string> m_layerCoverageUniformNames; // "<layerName>Coverage", by layer id
+	RenderLayerId m_defaultLayerId = InvalidRenderLayerId;
 	Vec2u m_renderSize = {0, 0};
+	std::shared_ptr<RenderTexture> m_emptyTexture; // 1x1 transparent texture, bound in place of layers that hold nothing but their clear
+	uint32_t m_numLayersCleared = 0;
+	uint32_t m_numLayersSkipped = 0;
+
+	// Uniform table for BindShaderUniforms(), so unchanged bindings are skipped (the uniform names are built once, when layers are added)
+	// rebuilt when layers are added or resized, or when binding to a different (or reloaded) shader
+	struct LayerUniform
+	{
+		RenderLayerId m_layerId = InvalidRenderLayerId;
+		const RenderTexture* m_boundRenderTexture = nullptr; // which render texture m_boundTexture came from (tracked headless too)
+		const sf::Texture* m_boundTexture = nullptr; // what the shader currently has bound to this uniform
+		const sf::Texture* m_boundCoverageTexture = nullptr;
+	};
+	void RebuildLayerUniforms(std::shared_ptr<Shader> in_shader);
+	std::vector<LayerUniform> m_layerUniforms;
+	std::weak_ptr<Shader> m_layerUniformsShader;
+	uint32_t m_layerUniformsShaderLoadCount = 0;
+	bool m_bLayerUniformsDirty = true;
 };
@@ -8,6 +8,7 @@
 #include "MinMax.h"
 #include "Box.h"
 #include "Transform.h"
+#include "GridBitset.h"
 #include "Engine/DebugDrawSystem.h"
 
 /*
@@ -292,6 +293,31 @@ namespace Math
 
 	std::optional<BoxSweepResults> SweepBoxAgainstGrid(Box2f in_box, Vec2f in_sweepVec, Transform in_gridToWorldTM, Box2i in_gridDimsBox, std::function<bool(Vec2i)> in_gridCellIsSolidFunc);
 
+	// templated overloads of the grid queries, which take the grid cell query as any callable so it can be inlined into the casting loop
+	// (the std::function versions above are thin wrappers around these -- implementations are at the bottom of this file)
+	template<typename tGridCellIsSolidFunc>
+	std::optional<RaycastResults> CastRayAgainstGrid(Ray in_ray, float in_maxDist, Transform in_gridToWorldTM, Box2i in_gridDimsBox, tGridCellIsSolidFunc&& in_gridCellIsSolidFunc);
+
+	template<typename tGridCellIsSolidFunc>
+	std::optional<BoxSweepResults> SweepBoxAgainstGrid(Box2f in_box, Vec2f in_sweepVec, Transform in_gridToWorldTM, Box2i in_gridDimsBox, tGridCellIsSolidFunc&& in_gridCellIsSolidFunc);
+
+	// sweeps against the set cells of a packed bitset (the grid dims come from the bitset), testing whole leading edges a word at a time
+	std::optional<BoxSweepResults> SweepBoxAgainstGrid(Box2f in_box, Vec2f in_sweepVec, Transform in_gridToWorldTM, const GridBitset& in_solidCells);
+
+	// batched version of the above for many small movers (eg projectiles) -- each query is a box (center + half extents) moving by m_delta
+	struct GridSweepQuery
+	{
+		Vec2f m_origin;
+		Vec2f m_delta;
+		Vec2f m_halfExtents;
+	};
+	struct GridSweepHit
+	{
+		float m_time; //< fraction of m_delta travelled before the hit [0, 1]
+		Vec2f m_normal;
+	};
+	void SweepBoxesAgainstGrid(const std::vector<GridSweepQuery>& in_queries, Transform in_gridToWorldTM, const GridBitset& in_solidCells, std::vector<std::optional<GridSweepHit>>& out_hits);
+
 
 
 	/////////////////////////////////////////////////////////////////////////////
@@ -336,3 +362,361 @@ namespace Math
 	//	return lineIntersection;
 	//}
 };
+
+
+/////////////////////////////////////////////////////////////////////////////
+// grid raycast/sweep template implementations
+
+namespace Math
+{
+	namespace Private
+	{
+		// casts a ray in grid space (grid cells are axis-aligned and 1x1 units in size)
+		// the GridIsSolidFuncVecT template argument is because normally users passing their own grid query functions will want floored Vec2i grid coordinates, but functions like SweepBoxAgainstGrid use this internally and need the exact Vec2f hit coords for their grid query functions
+		// the grid query function is a template parameter (rather than a std::function) so it can be inlined into the casting loop
+		template<typename GridIsSolidFuncVecT, typename tGridCellIsSolidFunc>
+		std::optional<Vec2f> CastRayGridSpace(Math::Ray in_ray, float in_maxDist, const Transform& in_gridToWorldTM, Box2i in_gridBoundsBox, const tGridCellIsSolidFunc& in_gridCellIsSolidFunc, Vec2f& out_hitNormal) {
+			constexpr bool bIsSolidFuncUsesFlooredGridPos = std::is_integral<GridIsSolidFuncVecT>::value;
+
+			const auto StepAlongX = [](Math::Ray in_ray) -> Vec2f {
+				if (in_ray.GetDir().x == 0.0f) return { BIG_NUMBER, BIG_NUMBER }; // return something far away so we won't use it
+
+				const float x = in_ray.m_p0.x;
+				const float y = in_ray.m_p0.y;
+
+				const float dx = in_ray.GetDir().x > 0 ? std::floor(x + 1) - x : std::ceil(x - 1) - x;
+				const float dy = dx * (in_ray.GetDir().y / in_ray.GetDir().x);
+
+				Vec2f ret = in_ray.m_p0 + Vec2f{dx, dy};
+				SQUID_RUNTIME_CHECK(ret.x == Math::Round(ret.x), "Float should always contain an integer here");
+				//ret.x = Math::Round(ret.x);
+				return ret;
+			};
+
+			const auto FloorToGridPos = [](Vec2f in_vec) {
+				return Vec2i{(int32_t)std::floor(in_vec.x), (int32_t)std::floor(in_vec.y)};
+			};
+
+			const Box2f gridBoundsBoxFloat{(float)in_gridBoundsBox.x, (float)in_gridBoundsBox.y, (float)in_gridBoundsBox.w, (float)in_gridBoundsBox.h};
+
+			//DrawDebugBox(gridBoundsBoxFloat.TransformedBy(in_gridToWorldTM), sf::Color::Green);
+
+			bool bWasEverInGrid = in_gridBoundsBox.Contains_InclExcl(FloorToGridPos(in_ray.m_p0));
+
+			// handle initial condition
+			if (!bWasEverInGrid)
+			{
+				// if we're starting completely outside the grid, start by cast against the overall grid bounds 
+				std::optional<Math::RaycastResults> hit = Math::CastRayAgainstBox(in_ray, gridBoundsBoxFloat);
+
+				// if our ray will never intersect the grid, return no hit
+				if (!hit || hit->m_dist > in_maxDist) return {};
+
+				// if our ray will eventually hit the grid, "fast forward" to right before it hits (start before the hit to avoid the edge case)
+				in_ray.m_p0 = hit->m_pos - in_ray.GetDir();
+
+				//DrawDebugPoint(in_gridToWorldTM.TransformPoint(in_ray.m_p0), sf::Color::Cyan);
+			}
+			else
+			{
+				// helper function for checking if in_val is almost integral (allowing for float error)
+				const auto IsOnGridline = [](float in_val) {
+					return std::abs(in_val - Math::Round(in_val)) <= 0.0f;// KINDA_SMALL_NUMBER;
+				};
+
+				bool bFoundHit = false;
+				Vec2f totalHitNormal = Vec2f::Zero;
+
+				// handle the case where the initial point is exactly on a gridline on one or both axes
+				// basically, along each axis, we want to check the 1 or 2 cells that we're currently in or moving into
+				for (int mainAxisIdx = 0; mainAxisIdx <= 1; mainAxisIdx++)
+				{
+					// mainAxisIdx is the axis we're sweeping along, and otherAxisIdx is the perpendicular one
+					const int otherAxisIdx = 1 - mainAxisIdx;
+					const float dirInAxis = Math::Sign(in_ray.GetDir()[mainAxisIdx]);
+
+					// if we're not moving in this axis, don't do any collision along it (to avoid getting stuck on corners)
+					if (dirInAxis == 0) continue;
+
+					// distance by which to adjust points that are exactly on gridlines 
+					const float adjustDist = 0.01f;
+
+					// p0 is the cell we're inside, or the one we're moving into if we're moving perp to a gridline
+					Vec2f p0 = in_ray.m_p0;
+					if (IsOnGridline(p0[mainAxisIdx]))
+					{
+						p0[mainAxisIdx] += dirInAxis * adjustDist;
+					}
+					// if we're moving along a gridline, p1 is the other cell we're potentially colliding with
+					Vec2f p1 = p0;
+					if (IsOnGridline(p0[otherAxisIdx]))
+					{
+						p0[otherAxisIdx] += adjustDist;
+						p1[otherAxisIdx] -= adjustDist;
+					}
+
+					if constexpr (bIsSolidFuncUsesFlooredGridPos)
+					{
+						// calculate grid-snapped positions
+						const Vec2i p0i = FloorToGridPos(p0);
+						const Vec2i p1i = FloorToGridPos(p1);
+
+						// if we're inside/hitting a wall on this axis, log the collision
+						if (in_gridCellIsSolidFunc(p0i) && (p1i == p0i || in_gridCellIsSolidFunc(p1i)))
+						{
+							Vec2f hitNormal = Vec2f::Zero;
+							hitNormal[mainAxisIdx] = -dirInAxis;
+
+							totalHitNormal += hitNormal;
+							bFoundHit = true;
+						}
+					}
+					else
+					{
+						// if we're inside/hitting a wall on this axis, log the collision
+						if (in_gridCellIsSolidFunc(p0) && (p1 == p0 || in_gridCellIsSolidFunc(p1)))
+						{
+							Vec2f hitNormal = Vec2f::Zero;
+							hitNormal[mainAxisIdx] = -dirInAxis;
+
+							totalHitNormal += hitNormal;
+							bFoundHit = true;
+						}
+					}
+				}
+
+				// if we found any collisions, return
+				if (bFoundHit)
+				{
+					out_hitNormal = totalHitNormal.Norm();
+					//DrawDebugLine(in_ray.m_p0, in_ray.m_p0 + out_hitNormal * 1.5f, sf::Color::White, in_gridToWorldTM);
+
+					return in_ray.m_p0;
+				}
+			}
+
+			// casting loop
+			while (true)
+			{
+				const Vec2f steppedX = StepAlongX(in_ray);
+				Vec2f steppedY = StepAlongX({ {in_ray.m_p0.y, in_ray.m_p0.x}, {in_ray.GetDir().y, in_ray.GetDir().x} });
+				steppedY = { steppedY.y, steppedY.x };
+
+				const bool bSteppingInX = steppedX.Dist(in_ray.m_p0) < steppedY.Dist(in_ray.m_p0);
+				const Vec2f stepped = bSteppingInX ? steppedX : steppedY;
+				const float stepDist = stepped.Dist(in_ray.m_p0);
+
+				// if this step would be beyond our max step distance, return no hit
+				if (stepDist > in_maxDist)
+				{
+					return {};
+				}
+
+				// convert to grid coordinates
+				// this is more than just flooring because our points are on cell boundaries, and when traveling in the negative direction. simply flooring will give us the next cell over
+				Vec2<GridIsSolidFuncVecT> steppedGridPos{ 
+					(GridIsSolidFuncVecT)(stepped.x) + (bSteppingInX && in_ray.GetDir().x < 0 ? -1 : 0), 
+					(GridIsSolidFuncVecT)(stepped.y) + (!bSteppingInX && in_ray.GetDir().y < 0 ? -1 : 0)
+				};
+
+				// when GridIsSolidFuncVecT is int32_t, the cast will truncate, so we have to calculate this floored version separately
+				Vec2<int32_t> flooredSteppedGridPos{ 
+					(int32_t)std::floor(stepped.x) + (bSteppingInX && in_ray.GetDir().x < 0 ? -1 : 0), 
+					(int32_t)std::floor(stepped.y) + (!bSteppingInX && in_ray.GetDir().y < 0 ? -1 : 0)
+				};
+
+				if constexpr (bIsSolidFuncUsesFlooredGridPos)
+				{
+					steppedGridPos = flooredSteppedGridPos;
+				}
+
+				// if stepped is inside the grid...
+				if (in_gridBoundsBox.Contains_InclExcl(flooredSteppedGridPos))
+				{
+					// debug draw
+					//DrawDebugLine(in_gridToWorldTM.TransformPoint(in_ray.m_p0), in_gridToWorldTM.TransformPoint(stepped));
+					//DrawDebugPoint(in_gridToWorldTM.TransformPoint(stepped), sf::Color::Magenta);
+					//const Box2f cellBox = Box2f::FromBottomLeft( steppedGridPos, {1.0f, 1.0f} ).TransformedBy(in_gridToWorldTM);
+					//DrawDebugLine(cellBox.GetCenter(), in_gridToWorldTM.TransformPoint(stepped), sf::Color::Magenta);
+
+					bWasEverInGrid = true;
+
+					// if this grid cell is occupied, return the hit
+					if (in_gridCellIsSolidFunc(steppedGridPos))
+					{
+						const Vec2f dir = in_ray.GetDir();
+						out_hitNormal = bSteppingInX ? Vec2f{ -Math::Sign(dir.x), 0.0f } : Vec2f{ 0.0f, -Math::Sign(dir.y) };
+						return stepped;
+					}
+				}
+				else
+				{
+					// if we're not in the grid, but we were before, return no hit (since convexity means we'll never enter it again)
+					if (bWasEverInGrid)
+					{
+						return {};
+					}
+				}
+
+				// move our ray origin forward to the stepped position before continuing
+				in_ray.m_p0 = stepped;
+				in_maxDist -= stepDist;
+			}
+		}
+
+		template<typename GridIsSolidFuncVecT, typename tGridCellIsSolidFunc>
+		std::optional<Math::RaycastResults> IntersectRayAndGrid(Math::Ray in_ray, float in_maxDist, const Transform& in_gridToWorldTM, Box2i in_gridDimsBox, const tGridCellIsSolidFunc& in_gridCellIsSolidFunc)
+		{
+			// rotated grids are 99% supported, but doesn't work with our float precision fixup hacks at the bottom of this function
+			SQUID_RUNTIME_CHECK(in_gridToWorldTM.rot == 0.0f, "sweeping box against rotated grid is not supported");
+
+			// transform ray and maxDist to grid coordinates
+			const Math::Ray ray_gridCoords( in_gridToWorldTM.InvTransformPoint(in_ray.m_p0), in_gridToWorldTM.InvTransformVector(in_ray.GetDir()) );
+			const float maxDist_gridCoords = in_gridToWorldTM.InvTransformVector(in_ray.GetDir() * in_maxDist).Len();
+
+
+			// do the raycast in grid space
+			Vec2f hitNormal_grid = Vec2f::Zero;
+			const std::optional<Vec2f> hitPos = CastRayGridSpace<GridIsSolidFuncVecT>(ray_gridCoords, maxDist_gridCoords, in_gridToWorldTM, in_gridDimsBox, in_gridCellIsSolidFunc, hitNormal_grid);
+			if (!hitPos) return {};
+
+
+			// transform normal back to world space 
+			const Vec2f hitNormal_world = in_gridToWorldTM.TransformVector(hitNormal_grid).Norm();
+
+			// HACK: transforming to/from grid space causes loss of precision. normally this is tiny enough to not be noticeable, but it's important to avoid drift when the collision is at distance 0 to avoid interpenetration
+			if (*hitPos == ray_gridCoords.m_p0)
+			{
+				return Math::RaycastResults(in_ray.m_p0, 0.0f, hitNormal_world);
+			}
+
+
+			// transform hit pos and dist back to world space
+			Vec2f hitPos_world = in_gridToWorldTM.TransformPoint(*hitPos);
+
+			//HACK: because of precision loss in the grid conversion, our collision might be slightly off, so do some fixup
+			{
+				// FIXME: this does not guarantee that the fixed up position is along the ray direction.
+				// We apply the clamp-to-edge constraint separately since it's generally more important.
+				// But this means that the hit distance is inconsistent with the hit position.
+				// The best fix for this is probably to make CastRayGridSpace work in world space and remove these hacks, rather than adding more.
+
+				// fix up hitpos_world to always be exactly along the ray direction
+				hitPos_world = in_ray.m_p0 + Math::Project(hitPos_world - in_ray.m_p0, in_ray.m_normDir);
+
+				// fix up hitpos to have the relevant axis/axes exactly on the world space grid line
+				// assumes 0 grid rotation
+				const auto IsOnGridline = [](float in_val) {
+					return std::abs(in_val - Math::Round(in_val)) <= 0.0f;
+				};
+
+				for (int i = 0; i <= 1; i++)
+				{
+					if (IsOnGridline((*hitPos)[i]) || hitNormal_grid[i] != 0.0f)
+					{
+						hitPos_world[i] = Math::RoundToMultiple(hitPos_world[i] - in_gridToWorldTM.pos[i], in_gridToWorldTM.scale[i]) + in_gridToWorldTM.pos[i];
+
+						SQUID_RUNTIME_CHECK(IsOnGridline(hitPos_world[i]), "hitPos should always be on a gridline");
+					}
+				}
+			}
+
+
+			const float hitDist_world = hitPos_world.Dist(in_ray.m_p0);
+
+			return Math::RaycastResults(hitPos_world, hitDist_world, hitNormal_world);
+		}
+
+		// sweeps a box against a grid, where in_spanIsSolidFunc(bool in_bIsRow, int32_t in_line, int32_t in_min, int32_t in_max) reports whether any cell in 
+		// an inclusive span of a row (or column) is solid -- this lets packed grids (eg GridBitset) test many leading edge cells at once
+		template<typename tSpanIsSolidFunc>
+		std::optional<BoxSweepResults> SweepBoxAgainstGridSpans(Box2f in_box, Vec2f in_sweepVec, Transform in_gridToWorldTM, Box2i in_gridDimsBox, const tSpanIsSolidFunc& in_spanIsSolidFunc)
+		{
+			// the general idea is to use IntersectRayAndGrid, but with the ray starting at the box corner most in the sweep direction and with a grid query function that checks all the cells on the leading box edges
+
+			// this check relies on the box and grid being aligned, so rotated grids aren't supported
+			SQUID_RUNTIME_CHECK(in_gridToWorldTM.rot == 0.0f, "sweeping box against rotated grid is not supported");
+
+
+			//DrawDebugBox(in_box, sf::Color::Magenta);
+
+
+			const Vec2f sweepDir = in_sweepVec.Norm();
+
+			const Vec2f leadingCorner{ 
+				sweepDir.x > 0 ? in_box.GetRight() : in_box.GetLeft(),
+				sweepDir.y > 0 ? in_box.GetTop() : in_box.GetBottom(),
+			};
+
+			// TODO check that the initial box isn't already in collision
+
+			const Box2f box_gridCoords = in_box.TransformedBy(in_gridToWorldTM.Inverse());
+
+			// the cells on each leading edge form a contiguous span, from the floored edge start to the floored edge end (just short of the far corner)
+			const auto GetEdgeSpan = [](float in_cornerComp, float in_dim, bool in_bCornerIsMax) -> MinMaxi {
+				const float offset = in_bCornerIsMax ? -in_dim : 0;
+				const float firstStep = Math::Min(0.0f, in_dim - KINDA_SMALL_NUMBER);
+				const float lastStep = Math::Min((float)(int)std::ceil(in_dim), in_dim - KINDA_SMALL_NUMBER);
+				return { (int32_t)std::floor(in_cornerComp + (firstStep + offset)), (int32_t)std::floor(in_cornerComp + (lastStep + offset)) };
+			};
+
+			const auto checkLeadingEdges = [sweepDir, box_gridCoords, &in_spanIsSolidFunc, &GetEdgeSpan](Vec2f in_cornerGridPos) -> bool {
+				bool bRet = false;
+
+				if (sweepDir.y != 0.0f)
+				{
+					const MinMaxi cols = GetEdgeSpan(in_cornerGridPos.x, box_gridCoords.GetDims().x, sweepDir.x > 0);
+					if (in_spanIsSolidFunc(true, (int32_t)std::floor(in_cornerGridPos.y), cols.m_min, cols.m_max)) bRet = true;
+				}
+
+				if (sweepDir.x != 0.0f)
+				{
+					const MinMaxi rows = GetEdgeSpan(in_cornerGridPos.y, box_gridCoords.GetDims().y, sweepDir.y > 0);
+					if (in_spanIsSolidFunc(false, (int32_t)std::floor(in_cornerGridPos.x), rows.m_min, rows.m_max)) bRet = true;
+				}
+
+				return bRet;
+			};
+
+			std::optional<RaycastResults> cornerHitRes = Private::IntersectRayAndGrid<float>(Ray(leadingCorner, sweepDir), in_sweepVec.Len(), in_gridToWorldTM, in_gridDimsBox, checkLeadingEdges);
+
+			if (!cornerHitRes) return {};
+
+			const Box2f endBox = Box2f::FromAnchorPos({
+				sweepDir.x > 0 ? 1.0f : 0.0f,
+				sweepDir.y > 0 ? 1.0f : 0.0f,
+			}, cornerHitRes->m_pos, in_box.GetDims());
+
+
+			//DrawDebugBox(endBox, sf::Color::Magenta);
+			//Polygon startPoly = in_box.ToPolygon();
+			//Polygon endPoly = endBox.ToPolygon();
+			//for (int i = 0; i < startPoly.GetVerts().size(); i++)
+			//{
+			//	DrawDebugLine(startPoly.GetVerts()[i], endPoly.GetVerts()[i], sf::Color::Magenta);
+			//}
+
+
+			return BoxSweepResults(endBox, cornerHitRes->m_dist, cornerHitRes->m_normal);
+		}
+	}
+
+	template<typename tGridCellIsSolidFunc>
+	std::optional<RaycastResults> CastRayAgainstGrid(Ray in_ray, float in_maxDist, Transform in_gridToWorldTM, Box2i in_gridDimsBox, tGridCellIsSolidFunc&& in_gridCellIsSolidFunc)
+	{
+		return Private::IntersectRayAndGrid<int32_t>(in_ray, in_maxDist, in_gridToWorldTM, in_gridDimsBox, in_gridCellIsSolidFunc);
+	}
+
+	template<typename tGridCellIsSolidFunc>
+	std::optional<BoxSweepResults> SweepBoxAgainstGrid(Box2f in_box, Vec2f in_sweepVec, Transform in_gridToWorldTM, Box2i in_gridDimsBox, tGridCellIsSolidFunc&& in_gridCellIsSolidFunc)
+	{
+		const auto spanIsSolid = [&in_gridCellIsSolidFunc](bool in_bIsRow, int32_t in_line, int32_t in_min, int32_t in_max) {
+			for (int32_t i = in_min; i <= in_max; i++)
+			{
+				if (in_gridCellIsSolidFunc(in_bIsRow ? Vec2i{ i, in_line } : Vec2i{ in_line, i })) return true;
+			}
+			return false;
+		};
+		return Private::SweepBoxAgainstGridSpans(in_box, in_sweepVec, in_gridToWorldTM, in_gridDimsBox, spanIsSolid);
+	}
+};
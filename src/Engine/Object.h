@@ -6,6 +6,7 @@
 #include <functional>
 
 #include "TasksConfig.h"
+#include "ObjectArena.h"
 
 enum class eObjectState
 {
@@ -35,36 +36,44 @@ public:
 		return obj;
 	}
 
+	// Factories forward their arguments straight to tObj's constructor. init functors are called inline with the new object (before
+	// Initialize()), so passing a capturing lambda doesn't allocate
 	template <typename tObj, typename... Args>
-	static std::shared_ptr<tObj> Make(const std::shared_ptr<Object>& in_owner, Args... args)
+	static std::shared_ptr<tObj> Make(const std::shared_ptr<Object>& in_owner, Args&&... args)
 	{
-		auto obj = std::make_shared<tObj>(std::forward<Args>(args)...);
+		auto obj = Allocate<tObj>(std::forward<Args>(args)...);
 		obj->SetOwner(in_owner);
 		obj->Initialize();
 		return obj;
 	}
 
 	template <typename tObj, typename... Args>
-	std::shared_ptr<tObj> MakeChild(Args... args)
+	std::shared_ptr<tObj> MakeChild(Args&&... args)
 	{
 		return Make<tObj>(AsShared(), std::forward<Args>(args)...);
 	}
 
-	template <typename tObj, typename... Args>
-	static std::shared_ptr<tObj> MakeWithInit(const std::shared_ptr<Object>& in_owner, std::function<void(std::shared_ptr<tObj>)> in_initFunc, Args... args)
+	template <typename tObj, typename tInitFunc, typename... Args>
+	static std::shared_ptr<tObj> MakeWithInit(const std::shared_ptr<Object>& in_owner, tInitFunc&& in_initFunc, Args&&... args)
 	{
-		auto obj = std::make_shared<tObj>(std::forward<Args>(args)...);
+		auto obj = Allocate<tObj>(std::forward<Args>(args)...);
 		obj->SetOwner(in_owner);
-		if(in_initFunc)
-			in_initFunc(obj);
+		in_initFunc(obj);
 		obj->Initialize();
 		return obj;
 	}
 
-	template <typename tObj, typename... Args>
-	std::shared_ptr<tObj> MakeChildWithInit(std::function<void(std::shared_ptr<tObj>)> in_initFunc, Args... args)
+	template <typename tObj, typename tInitFunc, typename... Args>
+	std::shared_ptr<tObj> MakeChildWithInit(tInitFunc&& in_initFunc, Args&&... args)
 	{
-		return Make<tObj>(AsShared(), std::move(in_initFunc), std::forward<Args>(args)...);
+		return MakeWithInit<tObj>(AsShared(), std::forward<tInitFunc>(in_initFunc), std::forward<Args>(args)...);
+	}
+
+	// Arena allocation stats for tObj (see UsesObjectArena)
+	template <typename tObj>
+	static const ObjectArenaStats& GetArenaStats()
+	{
+		return GetObjectArena<tObj>().GetStats();
 	}
 
 	template <typename T = Object>
@@ -81,6 +90,20 @@ protected:
 	}
 
 private:
+	// Classes that opt in (see UsesObjectArena) are allocated from their own ObjectArena, everything else with std::make_shared()
+	template <typename tObj, typename... Args>
+	static std::shared_ptr<tObj> Allocate(Args&&... args)
+	{
+		if constexpr(UsesObjectArena<tObj>::value)
+		{
+			return std::allocate_shared<tObj>(ObjectArenaAllocator<tObj, tObj>(), std::forward<Args>(args)...);
+		}
+		else
+		{
+			return std::make_shared<tObj>(std::forward<Args>(args)...);
+		}
+	}
+
 	int32_t AddChild(std::shared_ptr<Object> in_child);
 	void RemoveChild(int32_t in_childIdx);
 
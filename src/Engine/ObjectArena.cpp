@@ -0,0 +1,68 @@
+#include "ObjectArena.h"
+
+#include <new>
+
+namespace
+{
+	size_t RoundUpToBlockSize(size_t in_size)
+	{
+		// blocks double as free list nodes, and every block has to stay aligned for whatever's allocated in it
+		const size_t align = alignof(std::max_align_t);
+		const size_t size = in_size < sizeof(void*) ? sizeof(void*) : in_size;
+		return (size + align - 1) / align * align;
+	}
+}
+
+void* ObjectArena::Allocate(size_t in_size)
+{
+	++m_stats.m_numAllocations;
+	if(m_stats.m_blockSize == 0)
+	{
+		m_stats.m_blockSize = RoundUpToBlockSize(in_size);
+	}
+	if(RoundUpToBlockSize(in_size) != m_stats.m_blockSize)
+	{
+		++m_stats.m_numFallbacks;
+		return ::operator new(in_size);
+	}
+
+	if(!m_freeList)
+	{
+		AddChunk();
+	}
+	FreeBlock* block = m_freeList;
+	m_freeList = block->m_next;
+	++m_stats.m_numLive;
+	return block;
+}
+
+void ObjectArena::Free(void* in_block, size_t in_size)
+{
+	if(RoundUpToBlockSize(in_size) != m_stats.m_blockSize)
+	{
+		::operator delete(in_block);
+		return;
+	}
+	FreeBlock* block = static_cast<FreeBlock*>(in_block);
+	block->m_next = m_freeList;
+	m_freeList = block;
+	--m_stats.m_numLive;
+}
+
+void ObjectArena::AddChunk()
+{
+	// new[] aligns to at least alignof(std::max_align_t), and the block size is a multiple of it
+	const size_t blockSize = m_stats.m_blockSize;
+	m_chunks.push_back(std::make_unique<std::byte[]>(blockSize * s_blocksPerChunk));
+	std::byte* chunk = m_chunks.back().get();
+
+	// thread the new blocks onto the free list in address order, so consecutive allocations are contiguous
+	for(size_t blockIdx = s_blocksPerChunk; blockIdx > 0; --blockIdx)
+	{
+		FreeBlock* block = reinterpret_cast<FreeBlock*>(chunk + (blockIdx - 1) * blockSize);
+		block->m_next = m_freeList;
+		m_freeList = block;
+	}
+	++m_stats.m_numChunks;
+	m_stats.m_numBlocks += s_blocksPerChunk;
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+// Object Arena Stats
+struct ObjectArenaStats
+{
+	size_t m_blockSize = 0; // 0 until the first allocation
+	size_t m_numChunks = 0;
+	size_t m_numBlocks = 0; // capacity across all chunks
+	size_t m_numLive = 0; // blocks currently handed out
+	uint64_t m_numAllocations = 0; // total since startup
+	uint64_t m_numFallbacks = 0; // allocations that didn't fit the block size, and went to the regular heap instead
+};
+
+///////////////////////////////////////////////////////
+// ObjectArena:
+// hands out fixed-size blocks carved from large chunks, so objects allocated from the same arena sit next to each other in memory.
+// freed blocks go on a free list and are reused by the next allocation (chunks are never returned to the system). each arena-allocated
+// object type gets its own arena (see GetObjectArena())
+class ObjectArena
+{
+public:
+	static constexpr size_t s_blocksPerChunk = 64;
+
+	// the block size is set by the first allocation. an allocation of any other size falls back to the regular heap
+	void* Allocate(size_t in_size);
+	void Free(void* in_block, size_t in_size);
+
+	const ObjectArenaStats& GetStats() const { return m_stats; }
+
+private:
+	void AddChunk();
+
+	struct FreeBlock
+	{
+		FreeBlock* m_next;
+	};
+	FreeBlock* m_freeList = nullptr;
+	std::vector<std::unique_ptr<std::byte[]>> m_chunks;
+	ObjectArenaStats m_stats;
+};
+
+// arena for objects of type tObj. never destroyed, since shared pointers to arena objects can outlive static destruction
+template <typename tObj>
+ObjectArena& GetObjectArena()
+{
+	static ObjectArena* s_arena = new ObjectArena();
+	return *s_arena;
+}
+
+// allocator for std::allocate_shared() -- the shared pointer's control block and tObj are allocated together, as one block of tObj's arena
+template <typename T, typename tObj>
+class ObjectArenaAllocator
+{
+public:
+	using value_type = T;
+	template <typename U>
+	struct rebind
+	{
+		using other = ObjectArenaAllocator<U, tObj>;
+	};
+
+	ObjectArenaAllocator() = default;
+	template <typename U>
+	ObjectArenaAllocator(const ObjectArenaAllocator<U, tObj>&) {}
+
+	T* allocate(size_t in_count)
+	{
+		static_assert(alignof(T) <= alignof(std::max_align_t), "ObjectArena blocks are only aligned to alignof(std::max_align_t)");
+		return static_cast<T*>(GetObjectArena<tObj>().Allocate(sizeof(T) * in_count));
+	}
+	void deallocate(T* in_ptr, size_t in_count)
+	{
+		GetObjectArena<tObj>().Free(in_ptr, sizeof(T) * in_count);
+	}
+
+	template <typename U>
+	bool operator==(const ObjectArenaAllocator<U, tObj>&) const { return true; }
+	template <typename U>
+	bool operator!=(const ObjectArenaAllocator<U, tObj>&) const { return false; }
+};
+
+// classes opt in to arena allocation (see Object::Make()) with "static constexpr bool s_bUseObjectArena = true;". subclasses inherit
+// the setting, but each class still gets its own arena
+template <typename tObj, typename = void>
+struct UsesObjectArena : std::false_type
+{
+};
+template <typename tObj>
+struct UsesObjectArena<tObj, std::void_t<decltype(tObj::s_bUseObjectArena)>> : std::bool_constant<tObj::s_bUseObjectArena>
+{
+};
@@ -0,0 +1,91 @@
+#include "RenderTargetPool.h"
+
+#include "RenderTexture.h"
+#include "GameWindow.h"
+
+#include <SFML/Graphics/Texture.hpp>
+
+#include <algorithm>
+
+namespace
+{
+	// steps grow by (at least) a quarter, so at most ~25% of a target is wasted, while a window being dragged bigger passes through few classes
+	uint32_t RoundUpToSizeClass(uint32_t in_dim, uint32_t in_maxTextureSize)
+	{
+		const uint32_t step = RenderTargetPool::s_minSizeClass;
+		uint32_t sizeClass = step;
+		while(sizeClass < in_dim)
+		{
+			sizeClass = (sizeClass + sizeClass / 4 + step - 1) / step * step;
+		}
+		return std::max(std::min(sizeClass, in_maxTextureSize), in_dim);
+	}
+}
+
+Vec2u RenderTargetPool::GetSizeClass(Vec2u in_size, uint32_t in_maxTextureSize)
+{
+	return { RoundUpToSizeClass(in_size.x, in_maxTextureSize), RoundUpToSizeClass(in_size.y, in_maxTextureSize) };
+}
+
+uint32_t RenderTargetPool::GetMaxTextureSize()
+{
+	// querying it needs a GL context, which headless runs never create
+	if(GameWindow::IsHeadless())
+	{
+		return UINT32_MAX;
+	}
+	static const uint32_t s_maxTextureSize = sf::Texture::getMaximumSize();
+	return s_maxTextureSize;
+}
+
+std::shared_ptr<RenderTexture> RenderTargetPool::Acquire(Vec2u in_size)
+{
+	int32_t targetIdx = FindBestFit(m_sizeClasses, in_size);
+	if(targetIdx < 0)
+	{
+		if(m_targets.size() >= s_maxTargets)
+		{
+			const size_t evictIdx = std::min_element(m_lastAcquired.begin(), m_lastAcquired.end()) - m_lastAcquired.begin();
+			m_sizeClasses.erase(m_sizeClasses.begin() + evictIdx);
+			m_lastAcquired.erase(m_lastAcquired.begin() + evictIdx);
+			m_targets.erase(m_targets.begin() + evictIdx);
+			++m_numEvictions;
+		}
+
+		const Vec2u sizeClass = GetSizeClass(in_size, GetMaxTextureSize());
+		m_sizeClasses.push_back(sizeClass);
+		m_lastAcquired.push_back(0);
+		m_targets.push_back(std::make_shared<RenderTexture>(Vec2i(sizeClass)));
+		++m_numAllocations;
+		targetIdx = (int32_t)m_targets.size() - 1;
+	}
+
+	m_lastAcquired[targetIdx] = ++m_numAcquires;
+	const auto& target = m_targets[targetIdx];
+	target->SetContentSize(in_size);
+	return target;
+}
+
+void RenderTargetPool::Clear()
+{
+	m_sizeClasses.clear();
+	m_lastAcquired.clear();
+	m_targets.clear();
+}
+
+int32_t RenderTargetPool::FindBestFit(const std::vector<Vec2u>& in_sizeClasses, Vec2u in_size)
+{
+	int32_t bestIdx = -1;
+	uint64_t bestArea = UINT64_MAX;
+	for(size_t sizeClassIdx = 0; sizeClassIdx < in_sizeClasses.size(); ++sizeClassIdx)
+	{
+		const Vec2u sizeClass = in_sizeClasses[sizeClassIdx];
+		const uint64_t area = (uint64_t)sizeClass.x * sizeClass.y;
+		if(sizeClass.x >= in_size.x && sizeClass.y >= in_size.y && area < bestArea)
+		{
+			bestIdx = (int32_t)sizeClassIdx;
+			bestArea = area;
+		}
+	}
+	return bestIdx;
+}
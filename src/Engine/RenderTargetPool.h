@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+#include "Vec2.h"
+
+class RenderTexture;
+
+///////////////////////////////////////////////////////
+// RenderTargetPool:
+// pool of render textures for intermediate passes whose size follows the window. each target is allocated at a size class
+// (each dim rounded up to the next step of a x1.25 series of multiples of 64, clamped to the max texture size) and reused for any smaller
+// request, with only its content size (see RenderTexture::SetContentSize()) changed, so resizing the window doesn't reallocate a target
+// every time it changes size. holds at most s_maxTargets, releasing the least recently acquired one to make room for a new one
+// targets are handed out with content smaller than the texture, so they're only sampled that way through RenderTexture::Draw() (which keeps
+// smooth sampling inside the content)
+class RenderTargetPool
+{
+public:
+	static constexpr uint32_t s_minSizeClass = 64; // also the step size classes are multiples of
+	static constexpr size_t s_maxTargets = 4;
+	static Vec2u GetSizeClass(Vec2u in_size, uint32_t in_maxTextureSize = UINT32_MAX); // never smaller than in_size, even past the max
+	static uint32_t GetMaxTextureSize(); // sf::Texture::getMaximumSize(), or no limit when headless
+
+	// smallest pooled target that fits, or a new one at in_size's size class (evicting the least recently acquired target if the pool
+	// is full). its content size is set to in_size
+	std::shared_ptr<RenderTexture> Acquire(Vec2u in_size);
+	void Clear(); // releases every target
+
+	size_t GetNumTargets() const { return m_targets.size(); }
+	uint32_t GetNumAllocations() const { return m_numAllocations; }
+	uint32_t GetNumEvictions() const { return m_numEvictions; }
+
+	// index of the smallest (by area) of in_sizeClasses that fits in_size, or -1 if none do
+	static int32_t FindBestFit(const std::vector<Vec2u>& in_sizeClasses, Vec2u in_size);
+
+private:
+	std::vector<Vec2u> m_sizeClasses; // parallel to m_targets
+	std::vector<uint64_t> m_lastAcquired; // parallel to m_targets, the m_numAcquires at each target's last Acquire()
+	std::vector<std::shared_ptr<RenderTexture>> m_targets;
+	uint64_t m_numAcquires = 0;
+	uint32_t m_numAllocations = 0;
+	uint32_t m_numEvictions = 0;
+};
@@ -3,65 +3,142 @@
 #include <SFML/Graphics/RenderStates.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
-#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Vertex.hpp>
 #include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <cfloat>
+#include <algorithm>
 
 #include "Engine/GameWindow.h"
 #include "Engine/Shader.h"
+#include "Engine/SpriteBatch.h"
+#include "Engine/CoverageMask.h"
+
+namespace
+{
+	RenderStats s_renderStats;
+
+	// draws straight to the window track their state changes here, since there's no RenderTexture for it
+	DrawKeys s_windowLastDrawKeys;
+
+	void RecordDraw(size_t in_numVerts, const DrawKeys& in_keys, DrawKeys& inout_lastKeys)
+	{
+		++s_renderStats.m_drawCalls;
+		s_renderStats.m_vertices += in_numVerts;
+		if(in_keys.m_texture != inout_lastKeys.m_texture)
+		{
+			++s_renderStats.m_textureChanges;
+			inout_lastKeys.m_texture = in_keys.m_texture;
+		}
+		if(in_keys.m_shader != inout_lastKeys.m_shader)
+		{
+			++s_renderStats.m_shaderChanges;
+			inout_lastKeys.m_shader = in_keys.m_shader;
+		}
+	}
+}
 
 RenderTexture::RenderTexture(const Vec2i& in_textureSize)
 {
-	m_renderTexture = std::make_shared<sf::RenderTexture>();
+	m_size = in_textureSize;
+	m_contentSize = m_size;
+	m_sfmlView = std::make_unique<sf::View>();
+	m_spriteBatch = std::make_unique<SpriteBatch>();
 
-	sf::ContextSettings settings{};
-	m_renderTexture->create(in_textureSize.x, in_textureSize.y, settings);
+	if(!GameWindow::IsHeadless())
+	{
+		m_renderTexture = std::make_shared<sf::RenderTexture>();
+		sf::ContextSettings settings{};
+		m_renderTexture->create(in_textureSize.x, in_textureSize.y, settings);
+	}
 
 	SetView(Box2f::FromBottomLeft(Vec2f::Zero, in_textureSize));	
+
+	m_compositeQuad.resize(4);
+	SetContentSize(m_contentSize);
 }
 
 RenderTexture::~RenderTexture()
 {
 }
 
-void RenderTexture::Clear(sf::Color in_color)
+bool RenderTexture::Clear(sf::Color in_color)
 {
-	m_renderTexture->clear(in_color);
+	m_spriteBatch->Discard();
+	m_spriteBatch->ResetStats();
+	if(!m_bHasDrawnContent && m_clearColor == in_color.toInteger())
+	{
+		return false;
+	}
+
+	if(m_renderTexture)
+	{
+		if(m_contentSize == m_size)
+		{
+			m_renderTexture->clear(in_color);
+		}
+		else
+		{
+			ClearContent(in_color);
+		}
+	}
+	++s_renderStats.m_clears;
+	m_clearColor = in_color.toInteger();
+	if(m_coverageMask)
+	{
+		m_coverageMask->Clear();
+		m_bCoverageTextureDirty = true;
+	}
+	m_bHasDrawnContent = false;
+	m_bNeedsDisplay = true;
+	return true;
 }
 
 void RenderTexture::Draw(Transform in_transform, std::shared_ptr<RenderTexture> in_renderToTexture, std::shared_ptr<Shader> in_shader) const
 {
-	m_renderTexture->display();
+	const sf::Texture* texture = GetSFMLTexture(); // resolves any pending draws, with either backend
 
-	sf::Sprite sprite(m_renderTexture->getTexture());
-	sprite.setOrigin(0.0f, (float)m_renderTexture->getSize().y);
-	sprite.setPosition(in_transform.pos.x, in_transform.pos.y);
-	sprite.setRotation(in_transform.rot);
-	sprite.setScale(in_transform.scale.x, -in_transform.scale.y);
+	// same transform sf::Sprite would build (origin at the content's top-left, y flipped for the y-up view)
+	sf::Transform compositeTransform;
+	compositeTransform.translate(in_transform.pos.x, in_transform.pos.y);
+	compositeTransform.rotate(in_transform.rot);
+	compositeTransform.scale(in_transform.scale.x, -in_transform.scale.y);
+	compositeTransform.translate(0.0f, -(float)m_contentSize.y);
 
 	sf::RenderStates renderStates = sf::RenderStates::Default;
-	if (in_shader)
+	if (sf::Shader* sfmlShader = in_shader ? in_shader->GetSFMLShader() : nullptr)
 	{
 		// Gotta use sf::Shader::CurrentTexture rather than binding our own texture the normal way because otherwise we get "An internal OpenGL call failed in Texture.cpp(769)" error spam
 		// since we're technically drawing a sprite containing our own texture, this is probably more what we want anyway
-		in_shader->GetSFMLShader().setUniform("texture", sf::Shader::CurrentTexture);
-		renderStates = sf::RenderStates(&in_shader->GetSFMLShader());
+		sfmlShader->setUniform("texture", sf::Shader::CurrentTexture);
+		renderStates = sf::RenderStates(sfmlShader);
 	}
+	renderStates.texture = texture;
+	renderStates.transform = compositeTransform;
+	const DrawKeys drawKeys = { this, in_shader.get() };
 
 	if (in_renderToTexture)
 	{
-		in_renderToTexture->GetSFMLRenderTexture()->draw(sprite, renderStates);
+		in_renderToTexture->DrawSFML(m_compositeQuad.data(), m_compositeQuad.size(), sf::TriangleStrip, renderStates, drawKeys);
 	}
 	else
 	{
 		// NOTE: this is different from DrawComponents. 
 		// if no target RenderTexture is passed, this draws directly to the window, rather than to the default game render texture. 
 		// we need this to be able to draw our game view to the window. maybe it'd be better to make draw-to-window an explicit option though for consistency...
-		GetWindow()->GetSFMLWindow()->draw(sprite, renderStates);
+		RecordDraw(m_compositeQuad.size(), drawKeys, s_windowLastDrawKeys);
+		if(auto window = GetWindow()->GetSFMLWindow())
+		{
+			window->draw(m_compositeQuad.data(), m_compositeQuad.size(), sf::TriangleStrip, renderStates);
+		}
 	}
 }
 
 void RenderTexture::SetView(const Box2f& in_view, float in_angle)
 {
+	// queued sprites were positioned for the old view
+	FlushSprites();
 	m_view = in_view;
 
 	sf::FloatRect rect(in_view.x, in_view.y, in_view.w, in_view.h);
@@ -78,7 +155,11 @@ void RenderTexture::SetView(const Box2f& in_view, float in_angle)
 	// invert y to make the y axis point up. we also invert the y scale of sfml graphics primitives (sprite, text, etc) in their respective component Draw() methods 
 	view.setSize(view.getSize().x, -view.getSize().y);
 	view.setRotation(in_angle);
-	m_renderTexture->setView(view);
+	*m_sfmlView = view;
+	if(m_renderTexture)
+	{
+		m_renderTexture->setView(view);
+	}
 }
 
 Box2f RenderTexture::GetView() const
@@ -88,35 +169,264 @@ Box2f RenderTexture::GetView() const
 
 void RenderTexture::SetSmooth(bool in_smooth)
 {
-	m_renderTexture->setSmooth(in_smooth);
+	m_bSmooth = in_smooth;
+	if(m_renderTexture)
+	{
+		m_renderTexture->setSmooth(in_smooth);
+	}
+	UpdateCompositeQuad();
 }
 
 bool RenderTexture::GetSmooth() const
 {
-	return m_renderTexture->isSmooth();
+	return m_bSmooth;
 }
 
 Vec2u RenderTexture::GetSize() const
 {
-	auto size = m_renderTexture->getSize();
-	return { size.x, size.y };
+	return m_size;
+}
+
+void RenderTexture::SetContentSize(Vec2u in_size)
+{
+	const Vec2u oldContentSize = m_contentSize;
+	m_contentSize = { std::min(in_size.x, m_size.x), std::min(in_size.y, m_size.y) };
+	if(m_contentSize.x > oldContentSize.x || m_contentSize.y > oldContentSize.y)
+	{
+		m_bHasDrawnContent = true; // the texels the content grew into weren't cleared with it, so the next Clear() can't be skipped
+	}
+	UpdateCompositeQuad();
+}
+
+void RenderTexture::ClearContent(sf::Color in_color) const
+{
+	// sf::RenderTarget::clear() always clears the whole texture, so overwrite just the content (the bottom rows of the top-down texture)
+	// with an unblended quad, in texture pixels
+	const sf::View view = m_renderTexture->getView();
+	m_renderTexture->setView(sf::View(sf::FloatRect(0.0f, 0.0f, (float)m_size.x, (float)m_size.y)));
+	const float right = (float)m_contentSize.x;
+	const float top = (float)(m_size.y - m_contentSize.y);
+	const float bottom = (float)m_size.y;
+	const sf::Vertex quad[4] = {
+		sf::Vertex({ 0.0f, top }, in_color),
+		sf::Vertex({ 0.0f, bottom }, in_color),
+		sf::Vertex({ right, top }, in_color),
+		sf::Vertex({ right, bottom }, in_color),
+	};
+	m_renderTexture->draw(quad, 4, sf::TriangleStrip, sf::RenderStates(sf::BlendNone));
+	m_renderTexture->setView(view);
+}
+
+void RenderTexture::UpdateCompositeQuad()
+{
+	// the view is y-up, so content drawn from the view's bottom-left ends up in the bottom rows of the (top-down) texture
+	const float width = (float)m_contentSize.x;
+	const float height = (float)m_contentSize.y;
+	float texLeft = 0.0f;
+	float texTop = (float)(m_size.y - m_contentSize.y);
+	float texRight = width;
+	const float texBottom = (float)m_size.y;
+
+	// smooth sampling at the content's edge blends in the texel past it, which isn't content when the texture is bigger than its content (the
+	// texture's own edges are clamped, so they're left alone). insetting by half a texel keeps those samples on the last content texel
+	if(m_bSmooth)
+	{
+		if(m_contentSize.x < m_size.x)
+		{
+			texRight -= 0.5f;
+		}
+		if(m_contentSize.y < m_size.y)
+		{
+			texTop += 0.5f;
+		}
+	}
+
+	// same corners as sf::Sprite (top-left, bottom-left, top-right, bottom-right)
+	m_compositeQuad[0] = sf::Vertex({ 0.0f, 0.0f }, { texLeft, texTop });
+	m_compositeQuad[1] = sf::Vertex({ 0.0f, height }, { texLeft, texBottom });
+	m_compositeQuad[2] = sf::Vertex({ width, 0.0f }, { texRight, texTop });
+	m_compositeQuad[3] = sf::Vertex({ width, height }, { texRight, texBottom });
+}
+
+void RenderTexture::DrawSFML(const sf::Drawable& in_drawable, const sf::RenderStates& in_states, size_t in_numVerts, const DrawKeys& in_keys)
+{
+	FlushSprites();
+	MarkDrawn();
+	RecordDraw(in_numVerts, in_keys, m_lastDrawKeys);
+	if(m_renderTexture)
+	{
+		m_renderTexture->draw(in_drawable, in_states);
+	}
+}
+
+void RenderTexture::DrawSFML(const sf::Vertex* in_verts, size_t in_numVerts, sf::PrimitiveType in_type, const sf::RenderStates& in_states, const DrawKeys& in_keys)
+{
+	FlushSprites();
+	MarkDrawn();
+	SubmitDraw(in_verts, in_numVerts, in_type, in_states, in_keys);
+}
+
+void RenderTexture::SubmitDraw(const sf::Vertex* in_verts, size_t in_numVerts, sf::PrimitiveType in_type, const sf::RenderStates& in_states, const DrawKeys& in_keys) const
+{
+	RecordDraw(in_numVerts, in_keys, m_lastDrawKeys);
+	if(m_renderTexture)
+	{
+		m_renderTexture->draw(in_verts, in_numVerts, in_type, in_states);
+	}
 }
 
 sf::RenderTexture* RenderTexture::GetSFMLRenderTexture() const
 {
+	FlushSprites();
+	MarkDrawn();
 	return m_renderTexture.get();
 }
 
+const sf::Texture* RenderTexture::GetSFMLTexture() const
+{
+	DisplayIfNeeded();
+	return m_renderTexture ? &m_renderTexture->getTexture() : nullptr;
+}
+
+const RenderStats& RenderTexture::GetRenderStats()
+{
+	return s_renderStats;
+}
+
+void RenderTexture::ResetRenderStats()
+{
+	s_renderStats = {};
+}
+
+void RenderTexture::MarkDrawn() const
+{
+	m_bHasDrawnContent = true;
+	m_bNeedsDisplay = true;
+	if(m_coverageMask && m_coverageMask->GetNumCovered() != m_coverageMask->GetTiles().size())
+	{
+		m_coverageMask->MarkAll();
+		m_bCoverageTextureDirty = true;
+	}
+}
+
+void RenderTexture::DisplayIfNeeded() const
+{
+	FlushSprites();
+	if(m_bNeedsDisplay)
+	{
+		if(m_renderTexture)
+		{
+			m_renderTexture->display();
+		}
+		++s_renderStats.m_displays;
+		m_bNeedsDisplay = false;
+	}
+}
+
+void RenderTexture::QueueSprite(const sf::Vertex* in_quad, const SpriteStates& in_states)
+{
+	m_spriteBatch->QueueQuad(in_quad, in_states);
+	m_bHasDrawnContent = true;
+	m_bNeedsDisplay = true;
+
+	if(m_coverageMask)
+	{
+		// Mark the tiles under the quad's bounds, in gl texture pixels (y-up, see CoverageMask)
+		const sf::Transform& tm = m_sfmlView->getTransform();
+		Vec2f minPixel = { FLT_MAX, FLT_MAX };
+		Vec2f maxPixel = { -FLT_MAX, -FLT_MAX };
+		for(int32_t vertIdx = 0; vertIdx < 4; ++vertIdx)
+		{
+			const sf::Vector2f ndc = tm.transformPoint(in_quad[vertIdx].position);
+			const Vec2f pixel = { (ndc.x + 1.0f) * 0.5f * m_size.x, (ndc.y + 1.0f) * 0.5f * m_size.y };
+			minPixel = Math::Min(minPixel, pixel);
+			maxPixel = Math::Max(maxPixel, pixel);
+		}
+		m_coverageMask->MarkPixelBox(minPixel, maxPixel);
+		m_bCoverageTextureDirty = true;
+	}
+}
+
+void RenderTexture::SetCoverageTileSize(int32_t in_tileSize)
+{
+	if(in_tileSize <= 0)
+	{
+		m_coverageMask = {};
+		m_coverageTexture = {};
+		return;
+	}
+
+	// Nothing's known about what was drawn before tracking started
+	m_coverageMask = std::make_unique<CoverageMask>();
+	m_coverageMask->Reset(m_size, in_tileSize);
+	if(m_bHasDrawnContent)
+	{
+		m_coverageMask->MarkAll();
+	}
+	m_bCoverageTextureDirty = true;
+
+	if(m_renderTexture)
+	{
+		const Vec2i dims = m_coverageMask->GetDims();
+		m_coverageTexture = std::make_unique<sf::Texture>();
+		m_coverageTexture->create(dims.x, dims.y);
+	}
+}
+
+const sf::Texture* RenderTexture::GetCoverageTexture() const
+{
+	if(!m_coverageTexture)
+	{
+		return nullptr;
+	}
+
+	if(m_bCoverageTextureDirty)
+	{
+		const auto& tiles = m_coverageMask->GetTiles();
+		m_coveragePixels.resize(tiles.size() * 4);
+		for(size_t tileIdx = 0; tileIdx < tiles.size(); ++tileIdx)
+		{
+			const uint8_t value = tiles[tileIdx] ? 255 : 0;
+			m_coveragePixels[tileIdx * 4 + 0] = value;
+			m_coveragePixels[tileIdx * 4 + 1] = value;
+			m_coveragePixels[tileIdx * 4 + 2] = value;
+			m_coveragePixels[tileIdx * 4 + 3] = 255;
+		}
+		m_coverageTexture->update(m_coveragePixels.data());
+		m_bCoverageTextureDirty = false;
+	}
+	return m_coverageTexture.get();
+}
+
+void RenderTexture::FlushSprites() const
+{
+	if(!m_spriteBatch->IsEmpty())
+	{
+		m_spriteBatch->Flush(*this);
+	}
+}
+
+uint32_t RenderTexture::GetSpriteDrawCallCount() const
+{
+	return m_spriteBatch->GetDrawCallCount();
+}
+
+uint32_t RenderTexture::GetSpriteCount() const
+{
+	return m_spriteBatch->GetQuadCount();
+}
+
 // copied from sf::RenderTarget::MapPixelToCoords, but changed to use float coordinates the whole way
+// (our views always cover the whole texture, so the viewport is just the texture size)
 Vec2f RenderTexture::ViewToWorld(const Vec2f& in_windowPos) const
 {
-	sf::View view = m_renderTexture->getView();
+	const sf::View& view = *m_sfmlView;
 
 	// First, convert from viewport coordinates to homogeneous coordinates
 	Vec2f normalized;
-	sf::IntRect viewport = m_renderTexture->getViewport(view);
-	normalized.x = -1.f + 2.f * (in_windowPos.x - viewport.left) / viewport.width;
-	normalized.y = 1.f - 2.f * (in_windowPos.y - viewport.top) / viewport.height;
+	const Vec2f viewport = Vec2f(m_size);
+	normalized.x = -1.f + 2.f * in_windowPos.x / viewport.x;
+	normalized.y = 1.f - 2.f * in_windowPos.y / viewport.y;
 
 	// Then transform by the inverse of the view matrix
 	auto ret = view.getInverseTransform().transformPoint({ normalized.x, normalized.y });
@@ -126,16 +436,16 @@ Vec2f RenderTexture::ViewToWorld(const Vec2f& in_windowPos) const
 // copied from sf::RenderTarget::MapCoordsToPixel, but changed to use float coordinates the whole way
 Vec2f RenderTexture::WorldToView(const Vec2f& in_worldPos) const
 {
-	sf::View view = m_renderTexture->getView();
+	const sf::View& view = *m_sfmlView;
 
 	// First, transform the point by the view matrix
 	sf::Vector2f normalized = view.getTransform().transformPoint({ in_worldPos.x, in_worldPos.y });
 
 	// Then convert to viewport coordinates
 	Vec2f pixel;
-	sf::IntRect viewport = m_renderTexture->getViewport(view);
-	pixel.x = (normalized.x + 1.f) / 2.f * viewport.width + viewport.left;
-	pixel.y = (-normalized.y + 1.f) / 2.f * viewport.height + viewport.top;
+	const Vec2f viewport = Vec2f(m_size);
+	pixel.x = (normalized.x + 1.f) / 2.f * viewport.x;
+	pixel.y = (-normalized.y + 1.f) / 2.f * viewport.y;
 
 	return pixel;
-}
\ No newline at end of file
+}
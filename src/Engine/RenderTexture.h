@@ -1,28 +1,65 @@
 #pragma once
 
 #include <memory>
+#include <cstdint>
+#include <vector>
+
+#include <SFML/Graphics/PrimitiveType.hpp>
 
 // Forward declarations
 class Shader;
+class SpriteBatch;
+struct SpriteStates;
+class CoverageMask;
 
 namespace sf
 {
 	class RenderTexture;
 	class Color;
+	class Vertex;
+	class Texture;
+	class RenderStates;
+	class Drawable;
+	class View;
+	class Shader;
 }
 
 #include "Vec2.h"
 #include "Transform.h"
 #include "Box.h"
 
+// Draw Keys
+// which texture and shader a draw uses, identified by their engine objects (a Texture or RenderTexture, and a Shader) rather than their SFML ones,
+// so state changes are counted the same way headless, where every SFML texture and shader is null
+struct DrawKeys
+{
+	const void* m_texture = nullptr;
+	const void* m_shader = nullptr;
+};
+
+// Render Stats
+// counted for every draw submitted through a RenderTexture (including its draws to the window), whichever render backend is active
+struct RenderStats
+{
+	uint64_t m_drawCalls = 0;
+	uint64_t m_vertices = 0;
+	uint64_t m_textureChanges = 0; // draws that use a different texture than the previous draw to the same target
+	uint64_t m_shaderChanges = 0; // same, for shaders
+	uint64_t m_clears = 0; // render texture clears (skipped clears aren't counted)
+	uint64_t m_displays = 0; // render texture resolves
+};
+
 // Render Texture
+// with the null render backend (see GameWindow::IsHeadless()) there are no SFML textures behind this: draws are only counted in the render stats
 class RenderTexture
 {
 public:
 	RenderTexture(const Vec2i& in_textureDims);
 	~RenderTexture();
 
-	void Clear(sf::Color in_color);
+	// skipped (returns false) if nothing was drawn since the last clear to the same color, since the texture already holds just that color
+	// only clears the content (see SetContentSize()), the rest of the texture is never drawn
+	bool Clear(sf::Color in_color);
 	void Draw(Transform in_transform=Transform{}, std::shared_ptr<RenderTexture> in_renderToTexture=nullptr, std::shared_ptr<Shader> in_shader=nullptr) const;
 
 	void SetView(const Box2f& in_view, float in_angle = 0.0f);
@@ -33,12 +70,73 @@ public:
 
 	Vec2u GetSize() const;
 
+	// Content size: the bottom-left part of the texture Draw() draws (the whole texture by default). lets an oversized texture be reused
+	// for smaller content without reallocating (see RenderTargetPool). when smooth, the part drawn is inset by half a texel along the edges
+	// that border unused texels, so filtering doesn't blend them in
+	void SetContentSize(Vec2u in_size);
+	Vec2u GetContentSize() const { return m_contentSize; }
+
 	Vec2f ViewToWorld(const Vec2f& in_windowPos) const;
 	Vec2f WorldToView(const Vec2f& in_worldPos) const;
 
+	// Submitting draws (flushes any queued sprites first, so these land on top of them)
+	// sfml drawables don't expose their vertices, so pass in_numVerts if the count should show up in the render stats
+	// pass in_keys for draws with a texture or shader, so they're counted as state changes
+	void DrawSFML(const sf::Drawable& in_drawable, const sf::RenderStates& in_states, size_t in_numVerts = 0, const DrawKeys& in_keys = {});
+	void DrawSFML(const sf::Vertex* in_verts, size_t in_numVerts, sf::PrimitiveType in_type, const sf::RenderStates& in_states, const DrawKeys& in_keys = {});
+
+	// flushes any queued sprites first, so whatever the caller draws directly lands on top of them
+	// (counts as drawing to the texture, use GetSFMLTexture() to just sample it). null when headless, prefer DrawSFML()
 	sf::RenderTexture* GetSFMLRenderTexture() const;
+	// texture for sampling (e.g. as a shader uniform), with any pending draws resolved. null when headless
+	const sf::Texture* GetSFMLTexture() const;
+
+	// Render stats (totals since startup, or since the last ResetRenderStats())
+	static const RenderStats& GetRenderStats();
+	static void ResetRenderStats();
+
+	// false if nothing was drawn since the last Clear(), i.e. the texture holds only the clear color
+	bool HasDrawnContent() const { return m_bHasDrawnContent; }
+
+	// Sprite batching (see SpriteBatch)
+	void QueueSprite(const sf::Vertex* in_quad, const SpriteStates& in_states);
+	void FlushSprites() const;
+	uint32_t GetSpriteDrawCallCount() const; // sprite draw calls issued since the last Clear()
+	uint32_t GetSpriteCount() const; // sprites queued since the last Clear()
+
+	// Coverage tracking (see CoverageMask): which tiles anything was drawn into since the last Clear(). sprites mark the tiles their quad
+	// overlaps, any other draw marks the whole texture
+	void SetCoverageTileSize(int32_t in_tileSize); // 0 turns tracking off
+	const CoverageMask* GetCoverageMask() const { return m_coverageMask.get(); } // null if not tracked
+	const sf::Texture* GetCoverageTexture() const; // one texel per tile, white where covered (for shaders to skip uncovered tiles). null if not tracked, or headless
 
 private:
 	Box2f m_view;
-	std::shared_ptr<sf::RenderTexture> m_renderTexture;
+	std::shared_ptr<sf::RenderTexture> m_renderTexture; // null when headless
+	std::unique_ptr<sf::View> m_sfmlView; // kept CPU-side so view/world conversions don't need m_renderTexture
+	Vec2u m_size;
+	bool m_bSmooth = false;
+	Vec2u m_contentSize;
+	std::vector<sf::Vertex> m_compositeQuad; // what Draw() draws (a triangle strip), only its texture coords change with the content size and smoothing
+	void UpdateCompositeQuad();
+	void ClearContent(sf::Color in_color) const;
+	std::unique_ptr<SpriteBatch> m_spriteBatch; // flushed from const accessors too (flushing only changes when queued sprites reach the texture, not what ends up on it)
+
+	// Draw submission (no sprite flush, SpriteBatch draws through this)
+	friend class SpriteBatch;
+	void SubmitDraw(const sf::Vertex* in_verts, size_t in_numVerts, sf::PrimitiveType in_type, const sf::RenderStates& in_states, const DrawKeys& in_keys) const;
+	mutable DrawKeys m_lastDrawKeys; // for the render stats' state change counts
+
+	// Coverage tracking
+	std::unique_ptr<CoverageMask> m_coverageMask;
+	std::unique_ptr<sf::Texture> m_coverageTexture; // null when headless
+	mutable std::vector<uint8_t> m_coveragePixels; // rgba upload buffer
+	mutable bool m_bCoverageTextureDirty = true;
+
+	// Dirty tracking
+	void MarkDrawn() const; // marks the whole texture covered
+	void DisplayIfNeeded() const;
+	mutable bool m_bHasDrawnContent = true; // a new texture's contents are undefined until it's first cleared
+	mutable bool m_bNeedsDisplay = true;
+	uint32_t m_clearColor = 0; // sf::Color::toInteger() of the last clear
 };
@@ -2,22 +2,28 @@
 
 #include <iostream>
 #include <fstream>
+#include <vector>
 
 #include <SFML/Graphics/Glsl.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
 
 #include "TasksConfig.h"
 #include "RenderTexture.h"
+#include "GameWindow.h"
 
 Shader::Shader(const std::string& in_filename)
 {
 	m_filename = in_filename + ".frag";
+	if(!GameWindow::IsHeadless()) // creating one would create a GL context
+	{
+		m_shader = std::make_unique<sf::Shader>();
+	}
 	Reload();
 }
 
-sf::Shader& Shader::GetSFMLShader()
+sf::Shader* Shader::GetSFMLShader() const
 {
-	return m_shader;
+	return m_shader.get();
 }
 
 void Shader::Reload()
@@ -27,12 +33,18 @@ void Shader::Reload()
 	if(ifs)
 	{
 		ifs.close();
-		bool success = m_shader.loadFromFile(m_filename.c_str(), sf::Shader::Fragment);
+		if(!m_shader)
+		{
+			// nothing to compile for with the null render backend
+			return;
+		}
+		bool success = m_shader->loadFromFile(m_filename.c_str(), sf::Shader::Fragment);
 		if (!success)
 		{
 			std::cout << "failed to reload shader: " << m_filename << "\n";
 			return;
 		}
+		++m_loadCount;
 	}
 	else
 	{
@@ -43,28 +55,61 @@ void Shader::Reload()
 
 void Shader::SetUniform(const std::string& in_name, float in_val)
 {
-	m_shader.setUniform(in_name, in_val);
+	if (m_shader)
+	{
+		m_shader->setUniform(in_name, in_val);
+	}
 }
 
 void Shader::SetUniform(const std::string& in_name, Vec2f in_val)
 {
-	m_shader.setUniform(in_name, sf::Vector2f(in_val.x, in_val.y));
+	if (m_shader)
+	{
+		m_shader->setUniform(in_name, sf::Vector2f(in_val.x, in_val.y));
+	}
 }
 
 void Shader::SetUniform(const std::string& in_name, sf::Color in_val)
 {
-	m_shader.setUniform(in_name, sf::Glsl::Vec4(in_val));
+	if (m_shader)
+	{
+		m_shader->setUniform(in_name, sf::Glsl::Vec4(in_val));
+	}
 }
 
 void Shader::SetUniform(const std::string& in_name, std::shared_ptr<RenderTexture> in_val)
 {
-	m_shader.setUniform(in_name, in_val->GetSFMLRenderTexture()->getTexture());
+	SetUniform(in_name, in_val.get());
 }
 
 void Shader::SetUniform(const std::string& in_name, const RenderTexture* in_val)
 {
-	if (in_val)
+	if (m_shader && in_val)
+	{
+		m_shader->setUniform(in_name, *in_val->GetSFMLTexture());
+	}
+}
+
+void Shader::SetUniform(const std::string& in_name, const sf::Texture& in_val)
+{
+	if (m_shader)
+	{
+		m_shader->setUniform(in_name, in_val);
+	}
+}
+
+void Shader::SetUniformArray(const std::string& in_name, const sf::Color* in_vals, size_t in_count)
+{
+	if (!m_shader)
+	{
+		return;
+	}
+
+	std::vector<sf::Glsl::Vec4> vals;
+	vals.reserve(in_count);
+	for (size_t valIdx = 0; valIdx < in_count; ++valIdx)
 	{
-		m_shader.setUniform(in_name, in_val->GetSFMLRenderTexture()->getTexture());
+		vals.push_back(sf::Glsl::Vec4(in_vals[valIdx]));
 	}
+	m_shader->setUniformArray(in_name, vals.data(), vals.size());
 }
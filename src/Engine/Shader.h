@@ -14,20 +14,26 @@ namespace sf
 	class Color;
 }
 
+// Shader
+// with the null render backend (see GameWindow::IsHeadless()) nothing is compiled, there's no SFML shader behind this, and setting uniforms does nothing
 class Shader
 {
 public:
 	Shader(const std::string& in_filename);
-	sf::Shader& GetSFMLShader();
+	sf::Shader* GetSFMLShader() const; // null when headless
 	void Reload();
+	uint32_t GetLoadCount() const { return m_loadCount; } // bumped by every successful (re)load, which resets all uniforms
 
 	void SetUniform(const std::string& in_name, float in_val);
 	void SetUniform(const std::string& in_name, Vec2f in_val);
 	void SetUniform(const std::string& in_name, sf::Color in_val);
 	void SetUniform(const std::string& in_name, std::shared_ptr<RenderTexture> in_val);
 	void SetUniform(const std::string& in_name, const RenderTexture* in_val);
+	void SetUniform(const std::string& in_name, const sf::Texture& in_val);
+	void SetUniformArray(const std::string& in_name, const sf::Color* in_vals, size_t in_count); // vec4 array
 
 private:
 	std::string m_filename;
-	sf::Shader m_shader;
+	std::unique_ptr<sf::Shader> m_shader; // null when headless
+	uint32_t m_loadCount = 0;
 };
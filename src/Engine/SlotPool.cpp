@@ -0,0 +1,36 @@
+#include "SlotPool.h"
+
+#include "TasksConfig.h"
+
+//--- SlotPool ---//
+void SlotPool::Reset(int32_t in_capacity)
+{
+	m_generations.assign(in_capacity, 0);
+	m_bInUse.assign(in_capacity, 0);
+	m_freeSlots.clear();
+	m_freeSlots.reserve(in_capacity);
+	for(int32_t slot = in_capacity - 1; slot >= 0; --slot) // pushed in reverse, so slot 0 is handed out first
+	{
+		m_freeSlots.push_back(slot);
+	}
+}
+
+int32_t SlotPool::Acquire()
+{
+	if(m_freeSlots.empty())
+	{
+		return -1;
+	}
+	const int32_t slot = m_freeSlots.back();
+	m_freeSlots.pop_back();
+	m_bInUse[slot] = 1;
+	return slot;
+}
+
+void SlotPool::Release(int32_t in_slot)
+{
+	SQUID_RUNTIME_CHECK(IsInUse(in_slot), "Released a slot that wasn't in use");
+	m_bInUse[in_slot] = 0;
+	++m_generations[in_slot];
+	m_freeSlots.push_back(in_slot);
+}
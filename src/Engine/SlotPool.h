@@ -0,0 +1,30 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+///////////////////////////////////////////////////////
+// SlotPool:
+// bookkeeping for a fixed number of slots that are handed out and given back by index (the slots' contents live with the owner).
+// each slot has a generation that goes up every time the slot is released, so the generation read when a slot was acquired
+// identifies that one use of the slot, and goes stale once it ends
+class SlotPool
+{
+public:
+	void Reset(int32_t in_capacity); // frees every slot (generations start over)
+
+	int32_t Acquire(); // -1 if every slot is in use. the most recently released slot is reused first
+	void Release(int32_t in_slot);
+
+	bool IsInUse(int32_t in_slot) const { return m_bInUse[in_slot] != 0; }
+	uint32_t GetGeneration(int32_t in_slot) const { return m_generations[in_slot]; }
+	bool IsCurrent(int32_t in_slot, uint32_t in_generation) const { return IsInUse(in_slot) && m_generations[in_slot] == in_generation; }
+
+	int32_t GetCapacity() const { return (int32_t)m_generations.size(); }
+	int32_t GetNumFree() const { return (int32_t)m_freeSlots.size(); }
+
+private:
+	std::vector<uint32_t> m_generations;
+	std::vector<uint8_t> m_bInUse;
+	std::vector<int32_t> m_freeSlots; // used as a stack
+};
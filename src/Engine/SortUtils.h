@@ -0,0 +1,32 @@
+#pragma once
+
+#include <iterator>
+#include <utility>
+
+//--- InsertionSort Function ---//
+// stable, in-place, no allocations. cost grows with how far elements have to move, so use it to re-sort ranges that are already nearly sorted
+template <typename tIter, typename tLess>
+void InsertionSort(tIter in_begin, tIter in_end, tLess in_less)
+{
+	if(in_begin == in_end)
+	{
+		return;
+	}
+	for(auto it = std::next(in_begin); it != in_end; ++it)
+	{
+		if(!in_less(*it, *std::prev(it)))
+		{
+			continue;
+		}
+
+		// Shift larger elements up until the hole is where this one belongs
+		auto val = std::move(*it);
+		auto hole = it;
+		do
+		{
+			*hole = std::move(*std::prev(hole));
+			--hole;
+		} while(hole != in_begin && in_less(val, *std::prev(hole)));
+		*hole = std::move(val);
+	}
+}
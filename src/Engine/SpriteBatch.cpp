@@ -0,0 +1,77 @@
+#include "SpriteBatch.h"
+
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Shader.hpp>
+
+#include "Engine/RenderTexture.h"
+#include "Engine/Shader.h"
+#include "Engine/Texture.h"
+
+namespace
+{
+	bool SameStates(const SpriteStates& in_lhs, const SpriteStates& in_rhs)
+	{
+		return in_lhs.m_texture == in_rhs.m_texture && in_lhs.m_paletteTexture == in_rhs.m_paletteTexture && in_lhs.m_shader == in_rhs.m_shader &&
+			in_lhs.m_blendMode == in_rhs.m_blendMode;
+	}
+}
+
+void SpriteBatch::QueueQuad(const sf::Vertex* in_quad, const SpriteStates& in_states)
+{
+	// Start a new run unless this quad can join the last one
+	if(m_runs.empty() || !SameStates(m_runs.back().m_states, in_states))
+	{
+		m_runs.push_back({ in_states, m_verts.size(), 0 });
+	}
+
+	// Split the quad into two triangles (sprite vertices are laid out as a triangle strip)
+	m_verts.push_back(in_quad[0]);
+	m_verts.push_back(in_quad[1]);
+	m_verts.push_back(in_quad[2]);
+	m_verts.push_back(in_quad[2]);
+	m_verts.push_back(in_quad[1]);
+	m_verts.push_back(in_quad[3]);
+	m_runs.back().m_numVerts += 6;
+	++m_quadCount;
+}
+
+void SpriteBatch::Flush(const RenderTexture& in_target)
+{
+	for(const auto& run : m_runs)
+	{
+		sf::RenderStates states;
+		states.texture = run.m_states.m_texture ? run.m_states.m_texture->GetSFMLTexture() : nullptr;
+		states.blendMode = run.m_states.m_blendMode;
+		const sf::Texture* paletteTexture = run.m_states.m_paletteTexture ? run.m_states.m_paletteTexture->GetSFMLTexture() : nullptr;
+		if(sf::Shader* shader = run.m_states.m_shader ? run.m_states.m_shader->GetSFMLShader() : nullptr)
+		{
+			if(states.texture && paletteTexture)
+			{
+				// the shader is shared by every run using it, so its uniforms are only valid for this run's draw
+				shader->setUniform("texture", *states.texture);
+				shader->setUniform("palette", *paletteTexture);
+			}
+			else
+			{
+				// shaders without a palette just sample the run's own texture
+				shader->setUniform("texture", sf::Shader::CurrentTexture);
+			}
+			states.shader = shader;
+		}
+		in_target.SubmitDraw(&m_verts[run.m_firstVert], run.m_numVerts, sf::Triangles, states, { run.m_states.m_texture, run.m_states.m_shader });
+		++m_drawCallCount;
+	}
+	Discard();
+}
+
+void SpriteBatch::Discard()
+{
+	m_runs.clear();
+	m_verts.clear();
+}
+
+void SpriteBatch::ResetStats()
+{
+	m_drawCallCount = 0;
+	m_quadCount = 0;
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+#include <SFML/Graphics/BlendMode.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+class RenderTexture;
+class Texture;
+class Shader;
+
+// the engine objects a sprite is drawn with. runs are keyed on these rather than on their SFML objects, so sprites batch (and count
+// state changes) the same way headless, where every SFML texture and shader is null
+struct SpriteStates
+{
+	const Texture* m_texture = nullptr;
+	const Texture* m_paletteTexture = nullptr;
+	const Shader* m_shader = nullptr;
+	sf::BlendMode m_blendMode = sf::BlendAlpha;
+};
+
+///////////////////////////////////////////////////////
+// SpriteBatch:
+// collects textured quads for one render target in draw order. consecutive quads that share the same states (texture, palette texture, shader, blend mode)
+// form a run, and each run is drawn with a single draw call when the batch is flushed
+class SpriteBatch
+{
+public:
+	// in_quad is in sf::Sprite vertex order (top-left, bottom-left, top-right, bottom-right), already transformed into the target's world space
+	// if the states have a shader, its "texture" and "palette" uniforms are bound to the run's textures before the run is drawn
+	// (without a palette texture, "texture" is bound to sf::Shader::CurrentTexture)
+	void QueueQuad(const sf::Vertex* in_quad, const SpriteStates& in_states);
+	void Flush(const RenderTexture& in_target);
+	void Discard(); // drops any queued quads without drawing them
+
+	bool IsEmpty() const { return m_runs.empty(); }
+
+	// stats since the last ResetStats()
+	uint32_t GetDrawCallCount() const { return m_drawCallCount; }
+	uint32_t GetQuadCount() const { return m_quadCount; }
+	void ResetStats();
+
+private:
+	struct Run
+	{
+		SpriteStates m_states;
+		size_t m_firstVert = 0;
+		size_t m_numVerts = 0;
+	};
+	std::vector<Run> m_runs;
+	std::vector<sf::Vertex> m_verts; // triangles, 6 per quad
+
+	uint32_t m_drawCallCount = 0;
+	uint32_t m_quadCount = 0;
+};
@@ -2,6 +2,7 @@
 
 #include <fstream>
 #include "TasksConfig.h"
+#include "GameWindow.h"
 
 Texture::Texture(const std::string& in_filename)
 {
@@ -11,14 +12,18 @@ Texture::Texture(const std::string& in_filename)
 	if(ifs)
 	{
 		ifs.close();
-		m_texture.loadFromFile(in_filename.c_str());
+		if(!GameWindow::IsHeadless()) // nothing samples textures with the null render backend, and creating one would create a GL context
+		{
+			m_texture = std::make_unique<sf::Texture>();
+			m_texture->loadFromFile(in_filename.c_str());
+		}
 	}
 	else
 	{
 		SQUID_RUNTIME_ERROR("Could not load texture");
 	}
 }
-const sf::Texture& Texture::GetSFMLTexture()
+const sf::Texture* Texture::GetSFMLTexture() const
 {
-	return m_texture;
+	return m_texture.get();
 }
@@ -1,17 +1,20 @@
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include <SFML/Graphics/Texture.hpp>
 
+// Texture
+// with the null render backend (see GameWindow::IsHeadless()) nothing is loaded, and there's no SFML texture behind this
 class Texture
 {
 public:
 	Texture(const std::string& in_filename);
-	const sf::Texture& GetSFMLTexture();
+	const sf::Texture* GetSFMLTexture() const; // null when headless
 	const std::string& GetDebugFilename() const { return m_debugFilename; }
 
 private:
 	std::string m_debugFilename;
-	sf::Texture m_texture;
+	std::unique_ptr<sf::Texture> m_texture; // null when headless
 };
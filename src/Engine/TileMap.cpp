@@ -39,6 +39,13 @@ TileSet::TileSet(const std::string& in_filename)
 		m_texture = AssetCache<Texture>::Get()->LoadAsset(basePath + "/" + imageFn);
 	}
 }
+TileSet::TileSet(const std::string& in_name, std::shared_ptr<Texture> in_texture, Vec2i in_tileDims, const std::vector<Box2i>& in_tiles)
+	: m_name(in_name)
+	, m_texture(in_texture)
+	, m_tileDims(in_tileDims)
+	, m_tiles(in_tiles)
+{
+}
 const std::string& TileSet::GetName() const
 {
 	return m_name;
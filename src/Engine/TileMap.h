@@ -38,6 +38,7 @@ class TileSet
 {
 public:
 	TileSet(const std::string& in_filename);
+	TileSet(const std::string& in_name, std::shared_ptr<Texture> in_texture, Vec2i in_tileDims, const std::vector<Box2i>& in_tiles); // built in memory rather than loaded
 	const std::string& GetName() const;
 	const std::string& GetFilename() const;
 	std::shared_ptr<Texture> GetTexture() const;
@@ -86,7 +86,6 @@ DamageInfo GameActor::GetDamageInfo() const {
 }
 bool GameActor::TryDestroyTiles(const Vec2f& in_pos, const Vec2f& in_dir, bool in_bPenetratesWalls, int32_t in_aoe) {
 	auto collisionTiles = GetWorld()->GetCollisionTilesComp();
-	auto collisionLayer = collisionTiles->GetTileLayer();
 	auto worldTiles = GetWorld()->GetWorldTilesComp();
 	auto worldLayer = worldTiles->GetTileLayer();
 	auto actorGridPos = worldTiles->WorldPosToGridPos(in_pos);
@@ -118,8 +117,8 @@ bool GameActor::TryDestroyTiles(const Vec2f& in_pos, const Vec2f& in_dir, bool i
 
 		// If hitsite is on a destructible tile
 		if(currentTileId == 54 || currentTileId == 270) { //< The crumbly brick tiles
-			worldLayer->SetTile(offsetGridPos, 0); //< 0 is the first "blank" ID in the GO tileset
-			collisionLayer->SetTile(offsetGridPos, 0);
+			worldTiles->SetTile(offsetGridPos, 0); //< 0 is the first "blank" ID in the GO tileset
+			collisionTiles->SetTile(offsetGridPos, 0);
 			Transform destroyedTileTransform = { (offsetGridPos * gridSize) + Vec2i{gridSize / 2, gridSize / 2}, 0.0f, Vec2f::One };
 			Actor::Spawn<DestroyedTile>(GetWorld(), destroyedTileTransform, currentTileId);
 			result = true;
@@ -139,7 +138,7 @@ void GameActor::SetDamageInfo(int32_t in_payload, uint32_t in_dmgFlag) {
 	}
 }
 std::shared_ptr<TextComponent> GameActor::MakeAndConfigText(TextDef& in_def, std::wstring in_text, Vec2f in_posOffset,
-	bool in_hidden, int32_t in_drawOrder, std::string in_renderLayer){
+	bool in_hidden, int32_t in_drawOrder, eRenderLayer in_renderLayer){
 	// TODO: Get this working! Strange crashes.
 	std::shared_ptr<TextComponent> textComp = MakeText(Transform::Identity);
 	auto worldView = GetWindow()->GetWorldView();
@@ -2,6 +2,7 @@
 
 #include "Engine/Actor.h"
 #include "DamageInfo.h"
+#include "GameEnums.h"
 #include "Engine/Components/SensorComponent.h"
 
 struct SensorShape;
@@ -35,13 +36,18 @@ public:
 	void SetTargeted(bool in_setting) { m_bIsTargeted = in_setting; }
 	bool GetTargeted() const { return m_bIsTargeted; }
 
+	// Type tag, set by the constructors of the classes that have one (subclasses inherit their parent's tag). Lets hot paths like sensor
+	// callbacks tell what kind of actor they've got with a switch + static cast, instead of trying a dynamic cast per type
+	eGameActorType GetActorType() const { return m_actorType; }
+
 	// Destroys tiles within a shape (used for destroyable environment features)
 	bool TryDestroyTiles(const Vec2f& in_pos, const Vec2f& in_dir, bool in_bPenetratesWalls, int32_t in_aoe = 0);
 
 protected:
 	void SetDamageInfo(int32_t in_payload, uint32_t in_dmgFlag = 0);
+	void SetActorType(eGameActorType in_type) { m_actorType = in_type; }
 	std::shared_ptr<TextComponent> MakeAndConfigText(TextDef& in_def, std::wstring in_text = L"", Vec2f in_posOffset = Vec2f::Zero,
-		bool in_hidden = false, int32_t in_drawOrder = 10, std::string in_renderLayer = "hud");
+		bool in_hidden = false, int32_t in_drawOrder = 10, eRenderLayer in_renderLayer = RL_Hud);
 
 	bool m_bUpdatesOffScreen = true;
 
@@ -49,4 +55,5 @@ private:
 	std::shared_ptr<GameWorld> m_world;
 	DamageInfo m_damageInfo;
 	bool m_bIsTargeted = false;
+	eGameActorType m_actorType = eGameActorType::Other;
 };
@@ -4,6 +4,26 @@
 
 // Repository of all the enums used by the non-engine systems in this game
 
+enum class eGameActorType : uint8_t //< See GameActor::GetActorType()
+{
+	Other,
+	Player,
+	Creature,
+	Projectile,
+	Door,
+};
+enum eRenderLayer : uint8_t //< Render layer ids -- GameLoop registers its layers in this order, and ids are handed out in registration order
+{
+	RL_FgLightMask,
+	RL_BkgLightMask,
+	RL_Lights,
+	RL_Skybox,
+	RL_Parallax,
+	RL_BkgTiles,
+	RL_FgGameplay,
+	RL_FgTiles,
+	RL_Hud,
+};
 enum class eDrawLayer
 {
 	Background = 0,
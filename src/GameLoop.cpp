@@ -3,6 +3,7 @@
 #include "GameWorld.h"
 #include "Effect.h"
 #include "Light.h"
+#include "LightClass.h"
 #include "Player.h"
 #include "PlayerStatus.h"
 #include "Hud.h"
@@ -40,6 +41,17 @@
 
 bool GameLoop::s_bDisplayDebug = false;
 
+Task<> ManageLightClassTable(std::shared_ptr<Shader> in_shader) {
+	// Rebind the light class table whenever the shader is (re)loaded, since reloading resets its uniforms
+	uint32_t boundLoadCount = 0;
+	while(true) {
+		if(in_shader->GetLoadCount() != boundLoadCount) {
+			BindLightClassTable(in_shader);
+			boundLoadCount = in_shader->GetLoadCount();
+		}
+		co_await Suspend();
+	}
+}
 Task<> GameLoop::ManageActor() {
 	// Set up render window
 	GetWindow()->SetScalingMode(eWindowScalingMode::PixelSmooth);
@@ -47,24 +59,34 @@ Task<> GameLoop::ManageActor() {
 	GetWindow()->SetViewClearColor(sf::Color::Black);
 	GetWindow()->SetPixelAspectRatio(GetPixelAspectRatio());
 
-	// Setup render layers & shader
-	GetWindow()->GetLayerManager()->AddLayer("fgLightMask");
-	GetWindow()->GetLayerManager()->AddLayer("bkgLightMask");
-	GetWindow()->GetLayerManager()->AddLayer("lights");
-	GetWindow()->GetLayerManager()->AddLayer("skybox");
-	GetWindow()->GetLayerManager()->AddLayer("parallax");
-	GetWindow()->GetLayerManager()->AddLayer("bkgTiles");
-	GetWindow()->GetLayerManager()->AddLayer("fgGameplay");
-	GetWindow()->GetLayerManager()->AddLayer("fgTiles");
-	GetWindow()->GetLayerManager()->AddLayer("hud");
+	// Setup render layers (in eRenderLayer order, so spawn paths can use those ids instead of looking the layers up by name) & shader
+	const std::pair<eRenderLayer, const char*> renderLayers[] = {
+		{ RL_FgLightMask, "fgLightMask" },
+		{ RL_BkgLightMask, "bkgLightMask" },
+		{ RL_Lights, "lights" },
+		{ RL_Skybox, "skybox" },
+		{ RL_Parallax, "parallax" },
+		{ RL_BkgTiles, "bkgTiles" },
+		{ RL_FgGameplay, "fgGameplay" },
+		{ RL_FgTiles, "fgTiles" },
+		{ RL_Hud, "hud" },
+	};
+	for(const auto& [renderLayer, layerName] : renderLayers) {
+		const RenderLayerId layerId = GetWindow()->GetLayerManager()->AddLayer(layerName);
+		SQUID_RUNTIME_CHECK(layerId == renderLayer, "Render layers must be added in eRenderLayer order");
+	}
+	GetWindow()->GetLayerManager()->GetLayer(RL_Lights)->SetCoverageTileSize(16); // lets the lighting shader skip unlit tiles
 	auto postProcessShader = AssetCache<Shader>::Get()->LoadAsset("data/shaders/PostProcessLighting");
 	GetWindow()->SetPostProcessShader(postProcessShader);
+	auto lightClassTableTask = m_taskMgr.Run(ManageLightClassTable(postProcessShader));
 	bool newGame = true;
 
 	// Outer loop
 	while(true) {
-		// Alternate between menu and gameplay until exit
-		newGame = co_await GameState_Menu();
+		// Alternate between menu and gameplay until exit (headless runs have no input to drive the menu, so they go straight into a new game)
+		if(!GameWindow::IsHeadless()) {
+			newGame = co_await GameState_Menu();
+		}
 		co_await GameState_Gameplay(newGame);
 	}
 }
@@ -97,7 +119,7 @@ Task<bool> GameLoop::GameState_Menu() {
 	// Setup bkg
 	auto bkgSprite = Guard(MakeSprite({ (float)windowSize.x / 2.0f, (float)windowSize.y / 2.0f }));
 	bkgSprite->PlayAnim("MenuBkg/Bkg", true);
-	bkgSprite->SetRenderLayer("hud");
+	bkgSprite->SetRenderLayer(RL_Hud);
 	bkgSprite->SetComponentDrawOrder(-2000);
 	bkgSprite->SetHidden(false);
 
@@ -182,11 +204,11 @@ Task<bool> GameLoop::GameState_Menu() {
 	
 	// Setup carats
 	auto caratSpriteL = Guard(MakeSprite());
-	caratSpriteL->SetRenderLayer("hud");
+	caratSpriteL->SetRenderLayer(RL_Hud);
 	caratSpriteL->PlayAnim("MenuCarat/Carat", true);
 
 	auto caratSpriteR = Guard(MakeSprite());
-	caratSpriteR->SetRenderLayer("hud");
+	caratSpriteR->SetRenderLayer(RL_Hud);
 	caratSpriteR->PlayAnim("MenuCarat/Carat", true);
 	caratSpriteR->SetFlipHori(true);
 
@@ -525,22 +547,22 @@ Task<> GameLoop::DestroyPlayerSuit(bool in_isFish) {
 	Actor::Spawn<Effect>(world, { playerPos + Vec2f{ 4.0f, 0.0f } }, "Explosion2/Explosion");
 	if(!in_isFish) {
 		Actor::Spawn<ParticleSpawner>(GameWorld::Get(), { playerPos + Vec2f{ -4.0f, 8.0f } },
-			g_playerDeathExplosionDef, std::nullopt);
+			&g_playerDeathExplosionDef, std::nullopt);
 		Actor::Spawn<ParticleSpawner>(GameWorld::Get(), { playerPos + Vec2f{ 4.0f, 8.0f } },
-			g_playerDeathExplosionDef, std::nullopt);
+			&g_playerDeathExplosionDef, std::nullopt);
 		Actor::Spawn<ParticleSpawner>(GameWorld::Get(), { playerPos + Vec2f{ -4.0f, -8.0f } },
-			g_playerDeathExplosionDef, std::nullopt);
+			&g_playerDeathExplosionDef, std::nullopt);
 		Actor::Spawn<ParticleSpawner>(GameWorld::Get(), { playerPos + Vec2f{ 4.0f, -8.0f } },
-			g_playerDeathExplosionDef, std::nullopt);
+			&g_playerDeathExplosionDef, std::nullopt);
 		co_await WaitSeconds(0.05f);
 		Actor::Spawn<Effect>(world, { playerPos + Vec2f{ -4.0f, 8.0f } }, "Explosion2/Explosion");
 		co_await WaitSeconds(0.05f);
 		Actor::Spawn<Effect>(world, { playerPos + Vec2f{ -4.0f, -8.0f } }, "Explosion2/Explosion");
 	}
 	Actor::Spawn<ParticleSpawner>(GameWorld::Get(), { playerPos + Vec2f{ -4.0f, 0.0f } },
-		g_playerDeathExplosionDef, std::nullopt);
+		&g_playerDeathExplosionDef, std::nullopt);
 	Actor::Spawn<ParticleSpawner>(GameWorld::Get(), { playerPos + Vec2f{ 4.0f, 0.0f } },
-		g_playerDeathExplosionDef, std::nullopt);
+		&g_playerDeathExplosionDef, std::nullopt);
 	GameBase::Get()->SetTimeDilation(0.1f);
 	co_await WaitSeconds(0.4f);
 	co_await ReturnToFullSpeed(0.5f);
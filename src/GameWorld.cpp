@@ -50,6 +50,7 @@
 #include "Engine/DebugDrawSystem.h"
 #include "Engine/TileMap.h"
 #include "Engine/MathEasings.h"
+#include <math.h>
 
 static GameWorld* s_gameWorld = {};
 std::shared_ptr<GameWorld> GameWorld::Get() {
@@ -92,8 +93,15 @@ void GameWorld::Initialize() {
 	m_dropManager = Spawn<DropManager>({});
 
 	m_collisionWorld = std::make_shared<CollisionWorld>();
+
+	// Projectiles queue their moves during the pre-physics update -- sweep them all in one batch right before sensors are tested
+	GameBase::Get()->SetPhysicsCallback([this]() {
+		m_projectileManager->FlushMoves();
+		m_sensorManager->Update();
+	});
 }
 void GameWorld::Destroy() {
+	GameBase::Get()->SetPhysicsCallback(nullptr);
 	Actor::Destroy();
 	SQUID_RUNTIME_CHECK(s_gameWorld == this, "tried to destroy GameWorld when it wasn't the singleton instance");
 	Cleanup(); // This must happen AFTER the world cleans up its child Actors
@@ -141,6 +149,7 @@ void GameWorld::Update() {
 		}
 	}
 	m_actorsToDestroy.clear();
+	m_projectileManager->FlushReleases(); //< Same for pooled projectiles, which go back to the pool instead
 	GetPlayerStatus()->Save();
 	ClearInvalidRoomActors(GetPlayerRoom());
 }
@@ -155,29 +164,31 @@ void GameWorld::LoadMap(const std::string& in_filename) {
 	auto collisionLayer = m_tileMap->GetLayer("TileCollision");
 	auto collisionLayerCopy = std::make_shared<TileLayer>(*collisionLayer);
 	m_collisionTilesComp = MakeTiles(collisionLayerCopy, tilesTM);
-	m_collisionTilesComp->SetRenderLayer("hud");
+	m_collisionTilesComp->SetRenderLayer(RL_Hud);
 	m_colliderTilesComp = MakeCollider_TilesComp(tilesTM, m_collisionWorld, m_collisionTilesComp);
+	m_colliderTilesComp->SetCategory(CL_World);
+	m_collisionTilesComp->TrackTileCells(237); //< Blocking tiles (red diagonal lines) -- door-opening projectiles only collide with these
 
 	// Setup worldTiles layer
 	auto worldTilesLayer = m_tileMap->GetLayer("World");
 	auto worldTiles = MakeTiles(worldTilesLayer, tilesTM);
 	m_worldTilesComp = worldTiles;
 	m_drawTilesComp.push_back(worldTiles);
-	worldTiles->SetRenderLayer("fgTiles");
+	worldTiles->SetRenderLayer(RL_FgTiles);
 
 	// Setup worldBkgTiles layer
 	auto worldBkgTilesLayer = m_tileMap->GetLayer("WorldBkg");
 	auto worldBkgTiles = MakeTiles(worldBkgTilesLayer, tilesTM);
 	m_worldBkgTilesComp = worldBkgTiles;
 	m_drawTilesComp.push_back(worldBkgTiles);
-	worldBkgTiles->SetRenderLayer("bkgTiles");
+	worldBkgTiles->SetRenderLayer(RL_BkgTiles);
 
 	// Setup overlapTiles layer
 	auto overlapTilesLayer = m_tileMap->GetLayer("WorldOverlap");
 	auto overlapTiles = MakeTiles(overlapTilesLayer, tilesTM);
 	overlapTiles->GetActor()->SetDrawLayer(1);
 	m_drawTilesComp.push_back(overlapTiles);
-	overlapTiles->SetRenderLayer("fgTiles");
+	overlapTiles->SetRenderLayer(RL_FgTiles);
 
 	// Setup worldBkgTilesLit layer
 	auto worldBkgTilesLitLayer = std::make_shared<TileLayer>(*worldBkgTilesLayer);
@@ -197,7 +208,7 @@ void GameWorld::LoadMap(const std::string& in_filename) {
 	auto worldBkgTilesLit = MakeTiles(worldBkgTilesLitLayer, tilesTM);
 	m_worldBkgTilesLitComp = worldBkgTilesLit;
 	m_drawTilesLitComp.push_back(worldBkgTilesLit);
-	worldBkgTilesLit->SetRenderLayer("bkgLightMask");
+	worldBkgTilesLit->SetRenderLayer(RL_BkgLightMask);
 
 	// Setup worldTilesLit layer
 	auto worldTilesLitLayer = std::make_shared<TileLayer>(*worldTilesLayer);
@@ -217,7 +228,7 @@ void GameWorld::LoadMap(const std::string& in_filename) {
 	auto worldTilesLit = MakeTiles(worldTilesLitLayer, tilesTM);
 	m_worldTilesLitComp = worldTilesLit;
 	m_drawTilesLitComp.push_back(worldTilesLit);
-	worldTilesLit->SetRenderLayer("fgLightMask");
+	worldTilesLit->SetRenderLayer(RL_FgLightMask);
 
 	// Create tile layer draw components
 	for(auto tileLayer : m_tileMap->GetLayers()) {
@@ -228,7 +239,7 @@ void GameWorld::LoadMap(const std::string& in_filename) {
 			{
 			auto tiles = MakeTiles(tileLayer, tilesTM);
 			m_drawTilesComp.push_back(tiles);
-			tiles->SetRenderLayer("fgGameplay");
+			tiles->SetRenderLayer(RL_FgGameplay);
 		}
 	}
 	// Spawn things & create/populate rooms
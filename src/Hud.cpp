@@ -19,7 +19,7 @@ void FadeQuad::Initialize() {
 	GameActor::Initialize();
 	SetDrawLayer(10);
 	m_sprite = MakeSprite();
-	m_sprite->SetRenderLayer("hud");
+	m_sprite->SetRenderLayer(RL_Hud);
 	m_sprite->PlayAnim("Square/10px", true);
 	m_sprite->SetWorldScale({ 34.4f, 24.4f });
 	m_sprite->SetColor(0, 0, 0, 255);
@@ -43,21 +43,21 @@ void Hud::Initialize() {
 
 	// Setup skybox
 	m_skyboxQuad = MakeSprite(Transform::Identity);
-	m_skyboxQuad->SetRenderLayer("skybox");
+	m_skyboxQuad->SetRenderLayer(RL_Skybox);
 	m_skyboxQuad->PlayAnim("Skybox/Space2", true);
 	auto windowSize = GetRenderSize();
 	m_skyboxQuad->SetRelativePos({(float)windowSize.x / 2, -(float)windowSize.y / 2 });
 
 	// Setup letterbox bars (defaults to off-screen)
 	m_letterboxTop = MakeSprite(Transform::Identity);
-	m_letterboxTop->SetRenderLayer("hud");
+	m_letterboxTop->SetRenderLayer(RL_Hud);
 	m_letterboxTop->SetComponentDrawOrder(1000);
 	m_letterboxTop->PlayAnim("Square/10px", true);
 	m_letterboxTop->SetWorldScale({ 34.4f, 3.6f });
 	m_letterboxTop->SetRelativePos(Vec2f{ 0.0f, 36.0f });
 	m_letterboxTop->SetColor(0, 0, 0, 255);
 	m_letterboxBottom = MakeSprite(Transform::Identity);
-	m_letterboxBottom->SetRenderLayer("hud");
+	m_letterboxBottom->SetRenderLayer(RL_Hud);
 	m_letterboxBottom->SetComponentDrawOrder(1000);
 	m_letterboxBottom->PlayAnim("Square/10px", true);
 	m_letterboxBottom->SetWorldScale({ 34.4f, 3.6f });
@@ -66,13 +66,13 @@ void Hud::Initialize() {
 
 	// Create energy label sprite
 	m_hudLabelComponent = MakeSprite();
-	m_hudLabelComponent->SetRenderLayer("hud");
+	m_hudLabelComponent->SetRenderLayer(RL_Hud);
 	m_hudLabelComponent->PlayAnim("Hud2/En", true, 0);
 
 	// Create energy number sprites
 	for(int32_t i = 0; i < 2; i++) {
 		auto numberSpriteComponent = MakeSprite();
-		numberSpriteComponent->SetRenderLayer("hud");
+		numberSpriteComponent->SetRenderLayer(RL_Hud);
 		numberSpriteComponent->SetPlayRate(0.0f);
 		numberSpriteComponent->PlayAnim("Hud/Text", true, 2);
 		m_healthNumberSprites.push_back(numberSpriteComponent);
@@ -81,7 +81,7 @@ void Hud::Initialize() {
 	// Create energy tank icon sprites
 	for(int32_t i = 0; i < 6; i++) {
 		auto eTankSpriteComponent = MakeSprite();
-		eTankSpriteComponent->SetRenderLayer("hud");
+		eTankSpriteComponent->SetRenderLayer(RL_Hud);
 		eTankSpriteComponent->SetPlayRate(0.0f);
 		eTankSpriteComponent->PlayAnim("EnergyTankIcons/Icons", true, 0);
 		eTankSpriteComponent->SetHidden(true);
@@ -90,31 +90,31 @@ void Hud::Initialize() {
 
 	// Create LT button sprite
 	m_ltButtonComponent = MakeSprite();
-	m_ltButtonComponent->SetRenderLayer("hud");
+	m_ltButtonComponent->SetRenderLayer(RL_Hud);
 	m_ltButtonComponent->PlayAnim("HudTriggerButtonIcons/HudTriggerButtonIcons", false, 0);
 	m_ltButtonComponent->SetHidden(true);
 	// Create RT button sprite
 	m_rtButtonComponent = MakeSprite();
-	m_rtButtonComponent->SetRenderLayer("hud");
+	m_rtButtonComponent->SetRenderLayer(RL_Hud);
 	m_rtButtonComponent->PlayAnim("HudTriggerButtonIcons/HudTriggerButtonIcons", false, 1);
 	m_rtButtonComponent->SetHidden(true);
 
 	// Create X button sprite
 	m_xButtonComponent = MakeSprite();
-	m_xButtonComponent->SetRenderLayer("hud");
+	m_xButtonComponent->SetRenderLayer(RL_Hud);
 	m_xButtonComponent->PlayAnim("HudButtonIcons/HudButtonIcons", false, 0);
 	m_xButtonComponent->SetHidden(true);
 
 	// Create Y button sprite
 	m_yButtonComponent = MakeSprite();
-	m_yButtonComponent->SetRenderLayer("hud");
+	m_yButtonComponent->SetRenderLayer(RL_Hud);
 	m_yButtonComponent->PlayAnim("HudButtonIcons/HudButtonIcons", false, 1);
 	m_yButtonComponent->SetHidden(true);
 
 	// Create primary weapon icons
 	for(int32_t i = 0; i < 4; i++) {
 		auto pWeaponSpriteComponent = MakeSprite();
-		pWeaponSpriteComponent->SetRenderLayer("hud");
+		pWeaponSpriteComponent->SetRenderLayer(RL_Hud);
 		pWeaponSpriteComponent->SetPlayRate(0.0f);
 		pWeaponSpriteComponent->PlayAnim("HudWeaponIcons/WeaponIcons", false, i);
 		pWeaponSpriteComponent->SetHidden(true);
@@ -124,7 +124,7 @@ void Hud::Initialize() {
 	// Create support weapon icons
 	for(int32_t i = 0; i < 1; i++) {
 		auto sWeaponSpriteComponent = MakeSprite();
-		sWeaponSpriteComponent->SetRenderLayer("hud");
+		sWeaponSpriteComponent->SetRenderLayer(RL_Hud);
 		sWeaponSpriteComponent->SetPlayRate(0.0f);
 		sWeaponSpriteComponent->PlayAnim("HudWeaponIcons/Weapon2Icons", false, i);
 		sWeaponSpriteComponent->SetHidden(true);
@@ -133,7 +133,7 @@ void Hud::Initialize() {
 
 	// Setup missile text
 	m_missileCountTextComp = MakeText(Transform::Identity);
-	m_missileCountTextComp->SetRenderLayer("hud");
+	m_missileCountTextComp->SetRenderLayer(RL_Hud);
 	m_missileCountTextComp->SetFont("PixicaMicro-Regular");
 	m_missileCountTextComp->GetFont()->SetSmooth(false);
 	m_missileCountTextComp->SetFontSizePixels(16);
@@ -145,7 +145,7 @@ void Hud::Initialize() {
 
 	// Setup grenade text
 	m_grenadeCountTextComp = MakeText(Transform::Identity);
-	m_grenadeCountTextComp->SetRenderLayer("hud");
+	m_grenadeCountTextComp->SetRenderLayer(RL_Hud);
 	m_grenadeCountTextComp->SetFont("PixicaMicro-Regular");
 	m_grenadeCountTextComp->GetFont()->SetSmooth(false);
 	m_grenadeCountTextComp->SetFontSizePixels(16);
@@ -9,8 +9,8 @@ void Light::Initialize() {
 	GameActor::Initialize();
 
 	// Setup LightElements
-	m_core = Spawn<LightElement>({}, m_coreAnimName);
-	m_penumbra = Spawn<LightElement>({}, m_penumbraAnimName);
+	m_core = Spawn<LightElement>({}, m_coreAnimName, eLightClass::Core);
+	m_penumbra = Spawn<LightElement>({}, m_penumbraAnimName, eLightClass::Penumbra);
 	m_core->AttachToActor(AsShared<Actor>(), false);
 	m_penumbra->AttachToActor(AsShared<Actor>(), false);
 	m_core->SetDrawLayer(10);
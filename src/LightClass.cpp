@@ -0,0 +1,39 @@
+#include "LightClass.h"
+
+#include <algorithm>
+#include <array>
+
+#include "Engine/Shader.h"
+
+namespace {
+	// Indexed by eLightClass. unlit pixels get the "shadow" colour that gets multiplied down on unlit areas, everything else keeps its light colour
+	const std::array<LightClassEntry, (size_t)eLightClass::Count> s_lightClassTable = { {
+		{ sf::Color(83, 88, 141), true }, //< Unlit
+		{ sf::Color::White, false }, //< Penumbra
+		{ sf::Color::White, false }, //< Core
+		{ sf::Color::White, false }, //< Unclassified
+	} };
+}
+
+const LightClassEntry& GetLightClassEntry(eLightClass in_class) {
+	return s_lightClassTable[std::min((size_t)in_class, s_lightClassTable.size() - 1)];
+}
+eLightClass DecodeLightClass(uint8_t in_alpha) {
+	return (eLightClass)std::min(in_alpha, (uint8_t)eLightClass::Unclassified);
+}
+sf::Color ClassifyLight(sf::Color in_lightColor, uint8_t in_lightAlpha, bool in_maskCovered) {
+	const eLightClass lightClass = in_maskCovered ? DecodeLightClass(in_lightAlpha) : eLightClass::Unlit;
+	const LightClassEntry& entry = GetLightClassEntry(lightClass);
+	sf::Color result = entry.m_bReplace ? entry.m_color : in_lightColor;
+	result.a = 255;
+	return result;
+}
+void BindLightClassTable(std::shared_ptr<Shader> in_shader) {
+	std::array<sf::Color, (size_t)eLightClass::Count> colors;
+	for(size_t classIdx = 0; classIdx < s_lightClassTable.size(); ++classIdx) {
+		// the shader mixes towards the table colour by its alpha
+		colors[classIdx] = s_lightClassTable[classIdx].m_color;
+		colors[classIdx].a = s_lightClassTable[classIdx].m_bReplace ? 255 : 0;
+	}
+	in_shader->SetUniformArray("lightClassColors", colors.data(), colors.size());
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include <SFML/Graphics/Color.hpp>
+
+class Shader;
+
+// Light classes are written into the alpha channel of the "lights" layer (as in_class / 255) by LightElement sprites, so PostProcessLighting can look up
+// how to treat each lit pixel in the lightClassColors table instead of matching exact light colours. Anything drawn into the layer with ordinary alpha
+// blending ends up opaque, which decodes as Unclassified
+enum class eLightClass : uint8_t {
+	Unlit = 0, //< nothing drawn (the layer's clear)
+	Penumbra = 1, //< dim halo around a light's core
+	Core = 2, //< bright center of a light
+	Unclassified = 3, //< opaque pixels from sprites that don't write a light class
+	Count
+};
+
+// Entry of the light class table: a light colour is replaced by m_color when m_bReplace is set, and passed through unchanged otherwise
+struct LightClassEntry {
+	sf::Color m_color;
+	bool m_bReplace = false;
+};
+const LightClassEntry& GetLightClassEntry(eLightClass in_class);
+
+// Decodes the light class stored in a lights layer alpha value (matches PostProcessLighting)
+eLightClass DecodeLightClass(uint8_t in_alpha);
+
+// CPU reference of PostProcessLighting's light classification, for checking the table without a GPU
+// in_maskCovered is for the light terms that are masked by a light mask layer: pixels the mask doesn't cover are unlit
+sf::Color ClassifyLight(sf::Color in_lightColor, uint8_t in_lightAlpha, bool in_maskCovered = true);
+
+// Uploads the table to a shader's lightClassColors uniform (needs redoing whenever the shader is reloaded)
+void BindLightClassTable(std::shared_ptr<Shader> in_shader);
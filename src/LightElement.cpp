@@ -1,17 +1,33 @@
 #include "LightElement.h"
 #include "GameWorld.h"
 #include "Engine/MathEasings.h"
+#include "Engine/GameWindow.h"
+#include "Engine/AssetCache.h"
+#include "Engine/Shader.h"
 #include "Engine/Components/SpriteComponent.h"
 
-LightElement::LightElement(const std::string& in_anim)
+LightElement::LightElement(const std::string& in_anim, eLightClass in_lightClass)
 	: m_animName(in_anim)
+	, m_lightClass(in_lightClass)
 {
 }
 void LightElement::Initialize() {
 	GameActor::Initialize();
 	m_sprite = MakeSprite();
 	m_sprite->PlayAnim(m_animName, true);
-	m_sprite->SetRenderLayer("lights");
+	m_sprite->SetRenderLayer(RL_Lights);
+
+	// Write the light class into the lights layer's alpha (the LightClass shader takes it from the vertex colour and draws without blending)
+	m_sprite->SetShader(AssetCache<Shader>::Get()->LoadAsset("data/shaders/LightClass"));
+	m_sprite->SetBlendMode(sf::BlendNone);
+	m_sprite->SetColor(255, 255, 255, (uint8_t)m_lightClass);
+}
+void LightElement::Draw() {
+	// Skip lights the camera can't see (the lights layer only marks the tiles its sprites touch, so culled lights leave those tiles dark for the lighting shader to skip)
+	if(!m_sprite->GetWorldBounds().Overlaps(GetWindow()->GetWorldView())) {
+		return;
+	}
+	GameActor::Draw();
 }
 void LightElement::SetScale(float in_scale) {
 	m_scaleTask = {};
@@ -1,12 +1,14 @@
 #pragma once
 
 #include "GameActor.h"
+#include "LightClass.h"
 
 // Single element of a Light actor, used to express either the core or penumbra elements of a Light
 class LightElement : public GameActor {
 public:
-	LightElement(const std::string& in_anim);
+	LightElement(const std::string& in_anim, eLightClass in_lightClass);
 	virtual void Initialize() override;
+	virtual void Draw() override;
 	void SetScale(float in_scale);
 	void SetHidden(bool in_hide = true);
 
@@ -20,5 +22,6 @@ private:
 	TaskHandle<> m_scaleTask;
 	std::shared_ptr<SpriteComponent> m_sprite;
 	std::string m_animName;
+	eLightClass m_lightClass = eLightClass::Core;
 	bool m_bHoriOnly = false;
 };
@@ -1,12 +1,71 @@
 #include "Engine/Game.h"
+#include "Engine/GameWindow.h"
+#include "Engine/RenderTexture.h"
 #include "GameLoop.h"
 
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+// Prints the render stats gathered over a headless run
+static void PrintRenderStats(int32_t in_frames, double in_seconds)
+{
+	const RenderStats& stats = RenderTexture::GetRenderStats();
+	const double frames = in_frames > 0 ? (double)in_frames : 1.0;
+	auto PrintCounter = [frames](const char* in_name, uint64_t in_total) {
+		std::cout << in_name << ": " << in_total << " (" << in_total / frames << " per frame)\n";
+	};
+
+	std::cout << "frames: " << in_frames << " in " << in_seconds << "s (" << in_frames / in_seconds << " fps)\n";
+	PrintCounter("draw calls", stats.m_drawCalls);
+	PrintCounter("vertices", stats.m_vertices);
+	PrintCounter("texture changes", stats.m_textureChanges);
+	PrintCounter("shader changes", stats.m_shaderChanges);
+	PrintCounter("clears", stats.m_clears);
+	PrintCounter("displays", stats.m_displays);
+}
+
 // Simple main function
+// --headless runs with the null render backend (no window, nothing rasterized) and prints the render stats on exit
+// --frames N stops after N frames (headless runs default to 600, since they have no window to close)
 int main(int argc, char** argv)
 {
+	// Parse launch options
+	bool bHeadless = false;
+	int32_t maxFrames = 0;
+	for(int i = 1; i < argc; ++i)
+	{
+		const std::string arg = argv[i];
+		if(arg == "--headless")
+		{
+			bHeadless = true;
+		}
+		else if(arg == "--frames" && i + 1 < argc)
+		{
+			maxFrames = std::atoi(argv[++i]);
+		}
+	}
+	if(bHeadless)
+	{
+		GameWindow::SetRenderBackend(eRenderBackend::Null);
+		if(maxFrames <= 0)
+		{
+			maxFrames = 600;
+		}
+	}
+
 	// Run the game
 	Game<GameLoop> game;
+	game.SetMaxFrames(maxFrames);
+	const auto startTime = std::chrono::steady_clock::now();
 	game.Run();
 
+	if(bHeadless)
+	{
+		const std::chrono::duration<double> runTime = std::chrono::steady_clock::now() - startTime;
+		PrintRenderStats(game.GetFrameCount(), runTime.count());
+	}
+
 	return 0;
 }
@@ -45,7 +45,7 @@ void MenuItem::Initialize() {
 	SetDrawLayer(5);
 	// Setup text
 	m_textComp = MakeText(Transform::Identity);
-	m_textComp->SetRenderLayer("hud");
+	m_textComp->SetRenderLayer(RL_Hud);
 	m_textComp->SetFont("Pixica-Bold");
 	m_textComp->GetFont()->SetSmooth(false);
 	m_textComp->SetFontSizePixels(16);
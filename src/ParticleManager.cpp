@@ -1,16 +1,319 @@
 #include "ParticleManager.h"
 
-#include "Algorithms.h"
+#include "ParticleSpawner.h"
+#include "GameWorld.h"
+#include "Engine/Anim.h"
+#include "Engine/AssetCache.h"
+#include "Engine/SpriteSheet.h"
+#include "Engine/PaletteSet.h"
+#include "Engine/Texture.h"
+#include "Engine/Shader.h"
+#include "Engine/RenderTexture.h"
+#include "Engine/GameWindow.h"
+#include "Engine/StringUtils.h"
+#include "Engine/MathGeometry.h"
+#include "Engine/MathEasings.h"
+#include "Engine/Components/TilesComponent.h"
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <algorithm>
+#include <cmath>
 
 //--- PARTICLE MANAGER CODE ---//
 
+namespace {
+	constexpr float s_flickerFadeDuration = 1.0f;
+}
+
 void ParticleManager::Initialize() {
 	Actor::Initialize();
+
+	// Particles used to be actors of their own, spawned in layer 0 after whatever emitted them. the manager is spawned before any of the
+	// gameplay actors, so it sits a layer up to keep particles over creatures (and, spawned before the player, still under the player)
+	SetDrawLayer(1);
+}
+template <typename tFunc>
+void ParticleManager::ForEachArray(tFunc&& in_func) {
+	in_func(m_pos);
+	in_func(m_vel);
+	in_func(m_dirOverride);
+	in_func(m_elapsedLifetime);
+	in_func(m_lifetime);
+	in_func(m_rotation);
+	in_func(m_rotationSpeed);
+	in_func(m_scale);
+	in_func(m_playRate);
+	in_func(m_frameAccum);
+	in_func(m_flipTimer);
+	in_func(m_flickerTimer);
+	in_func(m_fadeTime);
+	in_func(m_frameIdx);
+	in_func(m_flipFrame);
+	in_func(m_paletteIdx);
+	in_func(m_spawnerId);
+	in_func(m_defIdx);
+	in_func(m_alpha);
+	in_func(m_flags);
+}
+uint16_t ParticleManager::RegisterDef(const ParticleSpawnerDef& in_def) {
+	auto found = m_defIdxByAddress.find(&in_def);
+	if(found != m_defIdxByAddress.end()) {
+		return found->second;
+	}
+
+	DefEntry entry;
+	entry.def = &in_def;
+	auto tokens = Split(in_def.animName, "/");
+	if(auto spriteSheet = AssetCache<SpriteSheet>::Get()->LoadAsset(std::string() + "data/anims/" + tokens[0])) {
+		entry.anim = spriteSheet->GetAnim(tokens[1]);
+	}
+	SQUID_RUNTIME_CHECK(entry.anim && entry.anim->GetNumFrames(), "Invalid particle anim name string");
+	entry.frameDur = 1.0f / entry.anim->GetFrameRate();
+
+	const auto defIdx = (uint16_t)m_defs.size();
+	m_defs.push_back(entry);
+	m_defIdxByAddress[&in_def] = defIdx;
+	return defIdx;
+}
+int32_t ParticleManager::GetPaletteIdx(uint16_t in_defIdx, const std::string& in_palette) const {
+	auto paletteSet = m_defs[in_defIdx].anim->GetPaletteSet();
+	return paletteSet ? paletteSet->GetPaletteIdx(in_palette) : 0;
+}
+void ParticleManager::SpawnParticle(uint16_t in_defIdx, uint32_t in_spawnerId, Vec2f in_pos, const ParticleSpawnParams& in_params) {
+	const auto& def = *m_defs[in_defIdx].def;
+	m_pos.push_back(in_pos);
+	m_vel.push_back(Math::DegreesToVec(in_params.direction) * in_params.speed);
+	m_dirOverride.push_back(in_params.dirOverride.value_or(Vec2f::Zero));
+	m_elapsedLifetime.push_back(0.0f);
+	m_lifetime.push_back(in_params.lifetime);
+	m_rotation.push_back(in_params.rotation);
+	m_rotationSpeed.push_back(in_params.rotationSpeed);
+	m_scale.push_back(in_params.scale);
+	m_playRate.push_back(def.animPlayrate);
+	m_frameAccum.push_back(0.0f);
+	m_flipTimer.push_back(0.0f);
+	m_flickerTimer.push_back(1.0f);
+	m_fadeTime.push_back(0.0f);
+	m_frameIdx.push_back((int32_t)def.animStartFrame % (int32_t)m_defs[in_defIdx].anim->GetNumFrames());
+	m_flipFrame.push_back(0);
+	m_paletteIdx.push_back(in_params.paletteIdx);
+	m_spawnerId.push_back(in_spawnerId);
+	m_defIdx.push_back(in_defIdx);
+	m_alpha.push_back(255);
+	m_flags.push_back((uint8_t)(PF_NextFlipH | PF_NextFlipV | (in_params.dirOverride ? PF_DirOverride : 0)));
+	++m_liveCountBySpawner[in_spawnerId];
+}
+uint32_t ParticleManager::GetParticleCount(uint32_t in_spawnerId) const {
+	auto found = m_liveCountBySpawner.find(in_spawnerId);
+	return found != m_liveCountBySpawner.end() ? found->second : 0;
+}
+void ParticleManager::RemoveParticle(size_t in_idx) {
+	auto liveCount = m_liveCountBySpawner.find(m_spawnerId[in_idx]);
+	if(--liveCount->second == 0) {
+		m_liveCountBySpawner.erase(liveCount);
+	}
+
+	// Swap with the last particle (draw order between particles doesn't matter, they're batched by texture anyway)
+	ForEachArray([in_idx](auto& in_array) {
+		in_array[in_idx] = in_array.back();
+		in_array.pop_back();
+	});
 }
 void ParticleManager::Update() {
 	Actor::Update();
-	EraseInvalid(m_particles);
+	if(m_pos.empty()) {
+		return;
+	}
+	auto collisionTiles = GameWorld::Get()->GetCollisionTilesComp();
+	UpdateParticles(DT(), collisionTiles->GetGridToWorldTransform(), collisionTiles->GetSolidCells());
+}
+void ParticleManager::UpdateParticles(float in_dt, const Transform& in_gridToWorldTM, const GridBitset& in_solidCells) {
+	for(size_t particleIdx = 0; particleIdx < m_pos.size(); ++particleIdx) {
+		UpdateParticle(particleIdx, in_dt, in_gridToWorldTM, in_solidCells);
+	}
+	for(size_t particleIdx = m_pos.size(); particleIdx-- > 0;) {
+		if(m_flags[particleIdx] & PF_Dead) {
+			RemoveParticle(particleIdx);
+		}
+	}
+}
+void ParticleManager::UpdateParticle(size_t in_idx, float in_dt, const Transform& in_gridToWorldTM, const GridBitset& in_solidCells) {
+	const auto& defEntry = m_defs[m_defIdx[in_idx]];
+	const auto& def = *defEntry.def;
+	auto& flags = m_flags[in_idx];
+
+	// Move, sweeping against the world if set that way (dies on hitting it, unless it bounces)
+	auto& pos = m_pos[in_idx];
+	auto& vel = m_vel[in_idx];
+	auto& dirOverride = m_dirOverride[in_idx];
+	const Vec2f moveDelta = (vel + dirOverride) * in_dt;
+	std::optional<Math::BoxSweepResults> sweepResults;
+	if(def.collideWorld) {
+		sweepResults = Math::SweepBoxAgainstGrid(Box2f::FromCenter(pos, def.collisionBoxDims), moveDelta, in_gridToWorldTM, in_solidCells);
+	}
+	if(sweepResults.has_value()) {
+		if(def.bounce) {
+			Bounce(in_idx, sweepResults.value().m_normal, def.bounce);
+			pos += sweepResults.value().m_normal * sweepResults.value().m_dist;
+		}
+		else {
+			flags |= PF_Dead;
+		}
+	}
+	else {
+		pos += moveDelta;
+	}
+
+	// Gravity (per tick, not scaled by dt), spin and lifetime
+	vel.y -= def.gravity;
+	if(flags & PF_DirOverride) {
+		dirOverride.y -= def.gravity;
+	}
+	if(auto rotSpeed = m_rotationSpeed[in_idx]) {
+		m_rotation[in_idx] += (rotSpeed * 360 * in_dt);
+	}
+	if(m_elapsedLifetime[in_idx] > m_lifetime[in_idx]) {
+		flags |= PF_Dead;
+	}
+	m_elapsedLifetime[in_idx] += in_dt;
+
+	// "NES-style" flip-based rotation (alternates horizontal and vertical flips to create illusion of 90-degree steps), and flickering
+	// out once stationary
+	auto& flipTimer = m_flipTimer[in_idx];
+	if(!(flags & PF_Fading)) {
+		if(def.animFlipRotation && flipTimer > 1 / def.animFlipRotationFps) {
+			auto& flipFrame = m_flipFrame[in_idx];
+			if(flipFrame % 2 == 0) {
+				const uint8_t flipH = (flags & PF_NextFlipH) ? PF_FlipH : 0;
+				flags = (uint8_t)(((flags & ~PF_FlipH) | flipH) ^ PF_NextFlipH);
+			}
+			else if(flipFrame % 2 == 1) {
+				const uint8_t flipV = (flags & PF_NextFlipV) ? PF_FlipV : 0;
+				flags = (uint8_t)(((flags & ~PF_FlipV) | flipV) ^ PF_NextFlipV);
+			}
+			flipFrame += def.animFlipRotation;
+			flipTimer = 0.0f;
+		}
+		if(def.animBlink && vel.Len() < 10.0f) {
+			auto& flickerTimer = m_flickerTimer[in_idx];
+			flickerTimer -= in_dt;
+			if(flickerTimer <= 0.0f && flipTimer > 0.1f) {
+				flags |= PF_Fading;
+			}
+			else if(flickerTimer <= -1.5f) {
+				flags |= PF_Dead;
+			}
+		}
+		flipTimer += in_dt;
+	}
+	if(flags & PF_Fading) {
+		auto& fadeTime = m_fadeTime[in_idx];
+		fadeTime += in_dt;
+		if(fadeTime >= s_flickerFadeDuration) {
+			m_alpha[in_idx] = 0;
+			flags |= PF_Dead;
+		}
+		else {
+			m_alpha[in_idx] = (uint8_t)(255 - int32_t(Math::EaseInOutSmoothstep(fadeTime / s_flickerFadeDuration) * 255.0f));
+		}
+	}
+
+	// Advance the (looping) anim
+	auto& frameAccum = m_frameAccum[in_idx];
+	frameAccum += in_dt * m_playRate[in_idx];
+	if(frameAccum >= defEntry.frameDur) {
+		auto& frameIdx = m_frameIdx[in_idx];
+		do {
+			frameAccum -= defEntry.frameDur;
+			++frameIdx;
+		} while(frameAccum >= defEntry.frameDur);
+		frameIdx %= (int32_t)defEntry.anim->GetNumFrames();
+	}
+}
+void ParticleManager::Bounce(size_t in_idx, Vec2f in_normal, float in_amount) {
+	// Reflects (eyyy) the velocity off the world geometry
+	auto& vel = m_vel[in_idx];
+	auto normalRightVec = in_normal.RotateDeg(-90.0f);
+	auto bounceVec = (normalRightVec * vel.Dot(normalRightVec) + (in_normal * vel.Dot(in_normal) * -1.0f));
+	vel = bounceVec * in_amount;
+	if(bounceVec.Len() * in_amount < 30.0f) {
+		m_rotationSpeed[in_idx] *= in_amount;
+		m_playRate[in_idx] *= in_amount;
+	}
+}
+void ParticleManager::Draw() {
+	Actor::Draw();
+	if(GetHidden() || m_pos.empty()) {
+		return;
+	}
+
+	// Build each particle's quad (the same one SpriteComponent would draw) into the vertex array for its texture/palette
+	for(auto& batch : m_drawBatches) {
+		batch.verts.clear();
+	}
+	sf::Transformable transformable;
+	for(size_t particleIdx = 0; particleIdx < m_pos.size(); ++particleIdx) {
+		const auto& defEntry = m_defs[m_defIdx[particleIdx]];
+		const auto& anim = *defEntry.anim;
+		const Texture* texture = anim.GetTexture().get();
+		auto paletteSet = anim.GetPaletteSet();
+		const Texture* paletteTexture = paletteSet ? paletteSet->GetPaletteTexture(m_paletteIdx[particleIdx]).get() : nullptr;
+		auto batchIt = std::find_if(m_drawBatches.begin(), m_drawBatches.end(), [texture, paletteTexture](const DrawBatch& in_batch) {
+			return in_batch.texture == texture && in_batch.paletteTexture == paletteTexture;
+		});
+		if(batchIt == m_drawBatches.end()) {
+			DrawBatch batch;
+			batch.texture = texture;
+			batch.paletteTexture = paletteTexture;
+			batch.shader = paletteSet ? paletteSet->GetPaletteShader().get() : nullptr;
+			batch.states.texture = texture->GetSFMLTexture();
+			batch.states.shader = batch.shader ? batch.shader->GetSFMLShader() : nullptr;
+			batchIt = m_drawBatches.insert(m_drawBatches.end(), std::move(batch));
+		}
+
+		const auto flags = m_flags[particleIdx];
+		const auto pos = m_pos[particleIdx];
+		const auto scale = m_scale[particleIdx];
+		transformable.setOrigin((float)anim.GetOrigin().x, (float)anim.GetOrigin().y);
+		transformable.setPosition(std::round(pos.x), std::round(pos.y));
+		transformable.setRotation(m_rotation[particleIdx]);
+		transformable.setScale((flags & PF_FlipH) ? -scale : scale, (flags & PF_FlipV) ? scale : -scale);
+		const sf::Transform& tm = transformable.getTransform();
+		const Box2i& frame = anim.GetFrame(m_frameIdx[particleIdx]);
+		const sf::Color color(255, 255, 255, m_alpha[particleIdx]);
+		const float left = (float)frame.x;
+		const float right = left + (float)frame.w;
+		const float top = (float)frame.y;
+		const float bottom = top + (float)frame.h;
+		const float width = (float)std::abs(frame.w);
+		const float height = (float)std::abs(frame.h);
+		const sf::Vertex quad[4] = {
+			sf::Vertex(tm.transformPoint(0.0f, 0.0f), color, { left, top }),
+			sf::Vertex(tm.transformPoint(0.0f, height), color, { left, bottom }),
+			sf::Vertex(tm.transformPoint(width, 0.0f), color, { right, top }),
+			sf::Vertex(tm.transformPoint(width, height), color, { right, bottom }),
+		};
+		auto& verts = batchIt->verts;
+		verts.push_back(quad[0]);
+		verts.push_back(quad[1]);
+		verts.push_back(quad[2]);
+		verts.push_back(quad[2]);
+		verts.push_back(quad[1]);
+		verts.push_back(quad[3]);
+	}
+
+	// One draw per texture/palette. Sprites queued on the target so far go first, so the palette shader uniforms set here stay bound
+	auto target = GetWindow()->GetRenderTarget();
+	target->FlushSprites();
+	for(const auto& batch : m_drawBatches) {
+		if(batch.verts.empty()) {
+			continue;
+		}
+		if(batch.states.shader) {
+			auto shader = const_cast<sf::Shader*>(batch.states.shader);
+			shader->setUniform("texture", *batch.states.texture);
+			shader->setUniform("palette", *batch.paletteTexture->GetSFMLTexture());
+		}
+		target->DrawSFML(batch.verts.data(), batch.verts.size(), sf::Triangles, batch.states, { batch.texture, batch.shader });
+	}
 }
-void ParticleManager::RegisterParticle(std::shared_ptr<Particle> in_particle) {
-	m_particles.push_back(in_particle);
-}
\ No newline at end of file
@@ -1,18 +1,115 @@
 #pragma once
 
-#include "Particle.h"
-#include "Effect.h"
+#include "Engine/Actor.h"
+#include "Engine/Vec2.h"
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Vertex.hpp>
 #include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
-// Dead simple particle manager -- keep registry of live particles, erases invalid (Destroyed) ones every tick
+struct ParticleSpawnerDef;
+class Anim;
+class Texture;
+class Shader;
+class GridBitset;
+
+// Per-particle values rolled by the spawner (everything else comes from the particle's def)
+struct ParticleSpawnParams {
+	int32_t paletteIdx = 0;
+	float lifetime = 1.0f;
+	float direction = 90.0f;
+	float speed = 1.0f * 60.0f;
+	float rotation = 0.0f;
+	float rotationSpeed = 0.0f;
+	float scale = 1.0f;
+	std::optional<Vec2f> dirOverride;
+};
+
+// Particle system -- every live particle is one row of a set of parallel arrays, all updated in one loop each tick and drawn with
+// one vertex array per texture/palette. Particles move according to their spawn params, and die when they hit the world (if set that way),
+// flicker out or their lifetime expires
 class ParticleManager : public Actor {
 public:
 	virtual void Initialize() override;
 	virtual void Update() override;
-	size_t GetParticleCount() const { return m_particles.size(); }
-	void RegisterParticle(std::shared_ptr<Particle> in_particle);
+	virtual void Draw() override;
+
+	// Particles reference their def by index into the def table. Defs are registered by address (so the table only grows by one entry
+	// per def), which means in_def has to outlive the manager -- the defs in ParticleSpawnerDefs.h live for the whole program
+	uint16_t RegisterDef(const ParticleSpawnerDef& in_def);
+	int32_t GetPaletteIdx(uint16_t in_defIdx, const std::string& in_palette) const;
+
+	// Spawners tag their particles with an id, so they can keep track of how many are still alive
+	uint32_t MakeSpawnerId() { return m_nextSpawnerId++; }
+	void SpawnParticle(uint16_t in_defIdx, uint32_t in_spawnerId, Vec2f in_pos, const ParticleSpawnParams& in_params);
+
+	size_t GetParticleCount() const { return m_pos.size(); }
+	uint32_t GetParticleCount(uint32_t in_spawnerId) const;
+	Vec2f GetParticlePos(size_t in_idx) const { return m_pos[in_idx]; } //< Indices shift as particles die (they're swap-removed)
+
+	// One tick of every particle, against the given collision grid (Update() runs this against the world's collision tiles)
+	void UpdateParticles(float in_dt, const Transform& in_gridToWorldTM, const GridBitset& in_solidCells);
 
 private:
-	std::vector<std::shared_ptr<Particle>> m_particles;
+	struct DefEntry {
+		const ParticleSpawnerDef* def = nullptr;
+		std::shared_ptr<Anim> anim;
+		float frameDur = 1.0f / 60.0f;
+	};
+	std::vector<DefEntry> m_defs;
+	std::unordered_map<const ParticleSpawnerDef*, uint16_t> m_defIdxByAddress;
+
+	enum eParticleFlags : uint8_t {
+		PF_FlipH = (1 << 0),
+		PF_FlipV = (1 << 1),
+		PF_NextFlipH = (1 << 2), //< Value the next horizontal "NES-style" flip sets (they alternate)
+		PF_NextFlipV = (1 << 3),
+		PF_DirOverride = (1 << 4),
+		PF_Fading = (1 << 5),
+		PF_Dead = (1 << 6),
+	};
+
+	void UpdateParticle(size_t in_idx, float in_dt, const Transform& in_gridToWorldTM, const GridBitset& in_solidCells);
+	void Bounce(size_t in_idx, Vec2f in_normal, float in_amount);
+	void RemoveParticle(size_t in_idx);
+	template <typename tFunc>
+	void ForEachArray(tFunc&& in_func);
+
+	// Particle arrays (all the same length, indexed by particle)
+	std::vector<Vec2f> m_pos;
+	std::vector<Vec2f> m_vel;
+	std::vector<Vec2f> m_dirOverride;
+	std::vector<float> m_elapsedLifetime;
+	std::vector<float> m_lifetime;
+	std::vector<float> m_rotation;
+	std::vector<float> m_rotationSpeed;
+	std::vector<float> m_scale;
+	std::vector<float> m_playRate;
+	std::vector<float> m_frameAccum;
+	std::vector<float> m_flipTimer;
+	std::vector<float> m_flickerTimer;
+	std::vector<float> m_fadeTime;
+	std::vector<int32_t> m_frameIdx;
+	std::vector<int32_t> m_flipFrame;
+	std::vector<int32_t> m_paletteIdx;
+	std::vector<uint32_t> m_spawnerId;
+	std::vector<uint16_t> m_defIdx;
+	std::vector<uint8_t> m_alpha;
+	std::vector<uint8_t> m_flags;
+
+	std::unordered_map<uint32_t, uint32_t> m_liveCountBySpawner;
+	uint32_t m_nextSpawnerId = 1;
+
+	// Drawing (batches are kept between frames so their vertex arrays don't reallocate, and are keyed on the engine textures, which exist headless too)
+	struct DrawBatch {
+		const Texture* texture = nullptr;
+		const Texture* paletteTexture = nullptr;
+		const Shader* shader = nullptr;
+		sf::RenderStates states;
+		std::vector<sf::Vertex> verts; //< Triangles, 6 per particle
+	};
+	std::vector<DrawBatch> m_drawBatches;
 };
@@ -1,28 +1,21 @@
 #include "ParticleSpawner.h"
-#include "Particle.h"
+#include "ParticleManager.h"
 #include "GameWorld.h"
 #include "Engine/MathRandom.h"
-#include "Algorithms.h"
 #include <iostream>
 
-ParticleSpawner::ParticleSpawner(const ParticleSpawnerDef& in_def, std::optional<Vec2f> in_dirOverride, const std::string& in_palette)
-	: m_particleSpawnerDef(std::make_shared<ParticleSpawnerDef>(in_def))
+ParticleSpawner::ParticleSpawner(const ParticleSpawnerDef* in_def, std::optional<Vec2f> in_dirOverride, const std::string& in_palette)
+	: m_particleSpawnerDef(in_def)
 	, m_dirOverride(in_dirOverride)
 	, m_palette(in_palette)
 {
 }
 void ParticleSpawner::Initialize() {
 	GameActor::Initialize();
-	m_worldCollisionBox = Box2f::FromCenter(Vec2f::Zero, m_particleSpawnerDef->collisionBoxDims);
-
-	if(m_particleSpawnerDef->sensorRadius) {
-		Circle particleCollisionCircle = { m_particleSpawnerDef->sensorRadius };
-		m_particleSensorShape.SetCircle(particleCollisionCircle);
-	}
-	else {
-		Vec2f particleCollisionBox = m_worldCollisionBox.GetDims();
-		m_particleSensorShape.SetBox(particleCollisionBox);
-	}
+	auto particleMgr = GetWorld()->GetParticleManager();
+	m_particleDefIdx = particleMgr->RegisterDef(*m_particleSpawnerDef);
+	m_paletteIdx = particleMgr->GetPaletteIdx(m_particleDefIdx, m_palette);
+	m_spawnerId = particleMgr->MakeSpawnerId();
 	m_spawnerLifetime = Math::RandomFloat(m_particleSpawnerDef->spawnerLifetimeRange.x, m_particleSpawnerDef->spawnerLifetimeRange.y);
 	//printf("Particle Spawner initialized!\n");
 }
@@ -30,37 +23,17 @@ void ParticleSpawner::Destroy() {
 	//printf("Particle Spawner destroyed!\n");
 	GameActor::Destroy();
 }
-void ParticleSpawner::Update() {
-	GameActor::Update();
-	EraseInvalid(m_liveParticles);
-}
 void ParticleSpawner::MakeParticle() {
-	ParticleDef newDef = {
-		m_particleSpawnerDef->spawnPosOffset,
-		m_particleSpawnerDef->animName,
-		m_particleSpawnerDef->animStartFrame,
-		m_particleSpawnerDef->animPlayrate,
-		m_particleSpawnerDef->animFlipRotation,
-		m_particleSpawnerDef->animFlipRotationFps,
-		m_particleSpawnerDef->animBlink,
-		m_particleSpawnerDef->effectAnimName,
-		m_worldCollisionBox,
-		m_particleSensorShape,
-		m_particleSpawnerDef->collideWorld,
-		m_particleSpawnerDef->bounce,
-		Math::RandomFloat(m_particleSpawnerDef->particleLifetimeRange.x, m_particleSpawnerDef->particleLifetimeRange.y),
-		Math::RandomFloat(m_particleSpawnerDef->directionRange.x, m_particleSpawnerDef->directionRange.y),
-		Math::RandomFloat(m_particleSpawnerDef->speedRange.x, m_particleSpawnerDef->speedRange.y),
-		Math::RandomFloat(m_particleSpawnerDef->rotationRange.x, m_particleSpawnerDef->rotationRange.y),
-		Math::RandomFloat(m_particleSpawnerDef->rotationSpeedRange.x, m_particleSpawnerDef->rotationSpeedRange.y),
-		Math::RandomFloat(m_particleSpawnerDef->scaleRange.x, m_particleSpawnerDef->scaleRange.y),
-		m_particleSpawnerDef->gravity,
-		m_particleSpawnerDef->category,
-		m_particleSpawnerDef->mask,
-		m_palette,
-	};
-	auto newParticle = Actor::Spawn<Particle>(GetWorld(), { GetWorldPos() }, newDef, m_dirOverride);
-	m_liveParticles.push_back(newParticle);
+	ParticleSpawnParams params;
+	params.paletteIdx = m_paletteIdx;
+	params.lifetime = Math::RandomFloat(m_particleSpawnerDef->particleLifetimeRange.x, m_particleSpawnerDef->particleLifetimeRange.y);
+	params.direction = Math::RandomFloat(m_particleSpawnerDef->directionRange.x, m_particleSpawnerDef->directionRange.y);
+	params.speed = Math::RandomFloat(m_particleSpawnerDef->speedRange.x, m_particleSpawnerDef->speedRange.y);
+	params.rotation = Math::RandomFloat(m_particleSpawnerDef->rotationRange.x, m_particleSpawnerDef->rotationRange.y);
+	params.rotationSpeed = Math::RandomFloat(m_particleSpawnerDef->rotationSpeedRange.x, m_particleSpawnerDef->rotationSpeedRange.y);
+	params.scale = Math::RandomFloat(m_particleSpawnerDef->scaleRange.x, m_particleSpawnerDef->scaleRange.y);
+	params.dirOverride = m_dirOverride;
+	GetWorld()->GetParticleManager()->SpawnParticle(m_particleDefIdx, m_spawnerId, GetWorldPos(), params);
 }
 Task<> ParticleSpawner::ManageActor() {
 	auto elapsedLifetime = 0.0f;
@@ -73,7 +46,7 @@ Task<> ParticleSpawner::ManageActor() {
 		spawnTimer = spawnRate;
 	}
 	while(true) {
-		if(m_liveParticles.size() < m_particlesMax) {
+		if(GetWorld()->GetParticleManager()->GetParticleCount(m_spawnerId) < m_particlesMax) {
 			if(m_burst) {
 				if(spawnTimer >= m_burstRate) {
 					auto burstAmount = Math::RandomInt(	m_particleSpawnerDef->burstParticleRange.x, 
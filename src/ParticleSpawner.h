@@ -3,8 +3,6 @@
 #include "GameActor.h"
 #include "GameEnums.h"
 
-class Particle;
-
 struct ParticleSpawnerDef {
 	Vec2f spawnPosOffset = Vec2f::Zero;
 	std::string animName = "Effects/PinkBox";
@@ -36,24 +34,24 @@ struct ParticleSpawnerDef {
 	float burstRate = 1.0f; // bursts/second
 };
 
-// Store (range-randomized) spawn settings for indiv. particles, and spawn 'em!
+// Roll (range-randomized) spawn settings for indiv. particles, and spawn 'em into the ParticleManager!
 class ParticleSpawner : public GameActor {
 public:
-	ParticleSpawner(const ParticleSpawnerDef& in_def, std::optional<Vec2f> in_dirOverride, const std::string& in_palette = "Base");
+	// in_def is referenced rather than copied (particles look it up by index), so it has to outlive them -- use the defs in ParticleSpawnerDefs.h
+	ParticleSpawner(const ParticleSpawnerDef* in_def, std::optional<Vec2f> in_dirOverride, const std::string& in_palette = "Base");
 	virtual void Initialize() override;
 	virtual void Destroy() override;
 	virtual Task<> ManageActor() override;
-	virtual void Update() override;
 
 private:
 	void MakeParticle();
-	std::shared_ptr<ParticleSpawnerDef> m_particleSpawnerDef;
-	std::vector<std::shared_ptr<Particle>> m_liveParticles;
+	const ParticleSpawnerDef* m_particleSpawnerDef = nullptr;
+	uint16_t m_particleDefIdx = 0;
+	uint32_t m_spawnerId = 0;
+	int32_t m_paletteIdx = 0;
 	float m_spawnerLifetime = 1.0f;
-	SensorShape m_particleSensorShape;
 
 	Vec2f m_spawnPosOffset = Vec2f::Zero;
-	Box2f m_worldCollisionBox = Box2f::FromCenter(Vec2f::Zero, { 8.0f, 8.0f });
 	uint32_t m_particlesMax = 10;
 	Vec2f m_spawnRange = { 1.0f, 10.0f };
 	bool m_burst = true;
@@ -2,7 +2,7 @@
 
 #include "ParticleSpawner.h"
 
-static ParticleSpawnerDef g_playerDeathExplosionDef = {
+inline ParticleSpawnerDef g_playerDeathExplosionDef = {
 	Vec2f::Zero,				// spawnPosOffset
 	"DebrisNew/DebrisGeneric",		// animName
 	0,							// animStartFrame
@@ -33,7 +33,7 @@ static ParticleSpawnerDef g_playerDeathExplosionDef = {
 	1.0f,						// burstRate
 };
 
-static ParticleSpawnerDef g_crawlerDeathExplosionDef0 = {
+inline ParticleSpawnerDef g_crawlerDeathExplosionDef0 = {
 	Vec2f::Zero,				// spawnPosOffset
 	"DebrisNew/DebrisGeneric",	// animName
 	0,							// animStartFrame
@@ -64,7 +64,7 @@ static ParticleSpawnerDef g_crawlerDeathExplosionDef0 = {
 	1.0f,						// burstRate
 };
 
-static ParticleSpawnerDef g_crawlerDeathExplosionDef1 = {
+inline ParticleSpawnerDef g_crawlerDeathExplosionDef1 = {
 	Vec2f::Zero,				// spawnPosOffset
 	"DebrisNew/DebrisGeneric",	// animName
 	1,							// animStartFrame
@@ -95,7 +95,7 @@ static ParticleSpawnerDef g_crawlerDeathExplosionDef1 = {
 	1.0f,						// burstRate
 };
 
-static ParticleSpawnerDef g_crawlerDeathExplosionDef2 = {
+inline ParticleSpawnerDef g_crawlerDeathExplosionDef2 = {
 	Vec2f::Zero,				// spawnPosOffset
 	"DebrisNew/DebrisGeneric",	// animName
 	2,							// animStartFrame
@@ -125,7 +125,7 @@ static ParticleSpawnerDef g_crawlerDeathExplosionDef2 = {
 	{ 1, 1 },					// burstParticleRange
 	1.0f,						// burstRate
 };
-static ParticleSpawnerDef g_crawlerDeathExplosionDef3 = {
+inline ParticleSpawnerDef g_crawlerDeathExplosionDef3 = {
 	Vec2f::Zero,				// spawnPosOffset
 	"DebrisNew/DebrisGeneric",	// animName
 	3,							// animStartFrame
@@ -155,7 +155,7 @@ static ParticleSpawnerDef g_crawlerDeathExplosionDef3 = {
 	{ 1, 1 },					// burstParticleRange
 	1.0f,						// burstRate
 };
-static ParticleSpawnerDef g_dropperDeathExplosionDef0 = {
+inline ParticleSpawnerDef g_dropperDeathExplosionDef0 = {
 	Vec2f::Zero,				// spawnPosOffset
 	"DebrisNew/DebrisGeneric",	// animName
 	0,							// animStartFrame
@@ -186,7 +186,7 @@ static ParticleSpawnerDef g_dropperDeathExplosionDef0 = {
 	1.0f,						// burstRate
 };
 
-static ParticleSpawnerDef g_dropperDeathExplosionDef1 = {
+inline ParticleSpawnerDef g_dropperDeathExplosionDef1 = {
 	Vec2f::Zero,				// spawnPosOffset
 	"DebrisNew/DebrisGeneric",	// animName
 	1,							// animStartFrame
@@ -217,7 +217,7 @@ static ParticleSpawnerDef g_dropperDeathExplosionDef1 = {
 	1.0f,						// burstRate
 };
 
-static ParticleSpawnerDef g_dropperDeathExplosionDef2 = {
+inline ParticleSpawnerDef g_dropperDeathExplosionDef2 = {
 	Vec2f::Zero,				// spawnPosOffset
 	"DebrisNew/DebrisGeneric",	// animName
 	2,							// animStartFrame
@@ -247,7 +247,7 @@ static ParticleSpawnerDef g_dropperDeathExplosionDef2 = {
 	{ 1, 1 },					// burstParticleRange
 	1.0f,						// burstRate
 };
-static ParticleSpawnerDef g_dropperDeathExplosionDef3 = {
+inline ParticleSpawnerDef g_dropperDeathExplosionDef3 = {
 	Vec2f::Zero,				// spawnPosOffset
 	"DebrisNew/DebrisGeneric",	// animName
 	3,							// animStartFrame
@@ -278,7 +278,7 @@ static ParticleSpawnerDef g_dropperDeathExplosionDef3 = {
 	1.0f,						// burstRate
 };
 // Swooper:
-static ParticleSpawnerDef g_swooperDeathExplosionDef0 = {
+inline ParticleSpawnerDef g_swooperDeathExplosionDef0 = {
 	Vec2f::Zero,				// spawnPosOffset
 	"DebrisNew/DebrisGeneric",	// animName
 	0,							// animStartFrame
@@ -309,7 +309,7 @@ static ParticleSpawnerDef g_swooperDeathExplosionDef0 = {
 	1.0f,						// burstRate
 };
 
-static ParticleSpawnerDef g_swooperDeathExplosionDef1 = {
+inline ParticleSpawnerDef g_swooperDeathExplosionDef1 = {
 	Vec2f::Zero,				// spawnPosOffset
 	"DebrisNew/DebrisGeneric",	// animName
 	1,							// animStartFrame
@@ -340,7 +340,7 @@ static ParticleSpawnerDef g_swooperDeathExplosionDef1 = {
 	1.0f,						// burstRate
 };
 
-static ParticleSpawnerDef g_swooperDeathExplosionDef2 = {
+inline ParticleSpawnerDef g_swooperDeathExplosionDef2 = {
 	Vec2f::Zero,				// spawnPosOffset
 	"DebrisNew/DebrisGeneric",	// animName
 	2,							// animStartFrame
@@ -370,7 +370,7 @@ static ParticleSpawnerDef g_swooperDeathExplosionDef2 = {
 	{ 1, 1 },					// burstParticleRange
 	1.0f,						// burstRate
 };
-static ParticleSpawnerDef g_swooperDeathExplosionDef3 = {
+inline ParticleSpawnerDef g_swooperDeathExplosionDef3 = {
 	Vec2f::Zero,				// spawnPosOffset
 	"DebrisNew/DebrisGeneric",	// animName
 	3,							// animStartFrame
@@ -401,7 +401,7 @@ static ParticleSpawnerDef g_swooperDeathExplosionDef3 = {
 	1.0f,						// burstRate
 };
 // Cruiser:
-static ParticleSpawnerDef g_cruiserDeathExplosionDef0 = {
+inline ParticleSpawnerDef g_cruiserDeathExplosionDef0 = {
 	Vec2f::Zero,				// spawnPosOffset
 	"DebrisNew/DebrisGeneric",	// animName
 	0,							// animStartFrame
@@ -432,7 +432,7 @@ static ParticleSpawnerDef g_cruiserDeathExplosionDef0 = {
 	1.0f,						// burstRate
 };
 
-static ParticleSpawnerDef g_cruiserDeathExplosionDef1 = {
+inline ParticleSpawnerDef g_cruiserDeathExplosionDef1 = {
 	Vec2f::Zero,				// spawnPosOffset
 	"DebrisNew/DebrisGeneric",	// animName
 	1,							// animStartFrame
@@ -463,7 +463,7 @@ static ParticleSpawnerDef g_cruiserDeathExplosionDef1 = {
 	1.0f,						// burstRate
 };
 
-static ParticleSpawnerDef g_cruiserDeathExplosionDef2 = {
+inline ParticleSpawnerDef g_cruiserDeathExplosionDef2 = {
 	Vec2f::Zero,				// spawnPosOffset
 	"DebrisNew/DebrisGeneric",	// animName
 	2,							// animStartFrame
@@ -493,7 +493,7 @@ static ParticleSpawnerDef g_cruiserDeathExplosionDef2 = {
 	{ 1, 1 },					// burstParticleRange
 	1.0f,						// burstRate
 };
-static ParticleSpawnerDef g_cruiserDeathExplosionDef3 = {
+inline ParticleSpawnerDef g_cruiserDeathExplosionDef3 = {
 	Vec2f::Zero,				// spawnPosOffset
 	"DebrisNew/DebrisGeneric",	// animName
 	3,							// animStartFrame
@@ -524,7 +524,7 @@ static ParticleSpawnerDef g_cruiserDeathExplosionDef3 = {
 	1.0f,						// burstRate
 };
 // Piper:
-static ParticleSpawnerDef g_piperDeathExplosionDef0 = {
+inline ParticleSpawnerDef g_piperDeathExplosionDef0 = {
 	Vec2f::Zero,				// spawnPosOffset
 	"DebrisNew/DebrisGeneric",	// animName
 	0,							// animStartFrame
@@ -555,7 +555,7 @@ static ParticleSpawnerDef g_piperDeathExplosionDef0 = {
 	1.0f,						// burstRate
 };
 
-static ParticleSpawnerDef g_piperDeathExplosionDef1 = {
+inline ParticleSpawnerDef g_piperDeathExplosionDef1 = {
 	Vec2f::Zero,				// spawnPosOffset
 	"DebrisNew/DebrisGeneric",	// animName
 	1,							// animStartFrame
@@ -586,7 +586,7 @@ static ParticleSpawnerDef g_piperDeathExplosionDef1 = {
 	1.0f,						// burstRate
 };
 
-static ParticleSpawnerDef g_piperDeathExplosionDef2 = {
+inline ParticleSpawnerDef g_piperDeathExplosionDef2 = {
 	Vec2f::Zero,				// spawnPosOffset
 	"DebrisNew/DebrisGeneric",	// animName
 	2,							// animStartFrame
@@ -616,7 +616,7 @@ static ParticleSpawnerDef g_piperDeathExplosionDef2 = {
 	{ 1, 1 },					// burstParticleRange
 	1.0f,						// burstRate
 };
-static ParticleSpawnerDef g_piperDeathExplosionDef3 = {
+inline ParticleSpawnerDef g_piperDeathExplosionDef3 = {
 	Vec2f::Zero,				// spawnPosOffset
 	"DebrisNew/DebrisGeneric",	// animName
 	3,							// animStartFrame
@@ -646,7 +646,7 @@ static ParticleSpawnerDef g_piperDeathExplosionDef3 = {
 	{ 1, 1 },					// burstParticleRange
 	1.0f,						// burstRate
 };
-static ParticleSpawnerDef g_debrisSpawnerLg1 = {
+inline ParticleSpawnerDef g_debrisSpawnerLg1 = {
 	Vec2f::Zero,				// spawnPosOffset
 	"DebrisNew/DebrisGenericDark",	// animName
 	0,							// animStartFrame
@@ -676,7 +676,7 @@ static ParticleSpawnerDef g_debrisSpawnerLg1 = {
 	{ 7, 7 },					// burstParticleRange
 	1.0f,						// burstRate
 };
-static ParticleSpawnerDef g_debrisSpawnerSm1 = {
+inline ParticleSpawnerDef g_debrisSpawnerSm1 = {
 	Vec2f::Zero,				// spawnPosOffset
 	"DebrisNew/DebrisGenericDark",	// animName
 	0,							// animStartFrame
@@ -706,7 +706,7 @@ static ParticleSpawnerDef g_debrisSpawnerSm1 = {
 	{ 4, 4 },					// burstParticleRange
 	1.0f,						// burstRate
 };
-static ParticleSpawnerDef g_emberSpawnerLg1 = {
+inline ParticleSpawnerDef g_emberSpawnerLg1 = {
 	Vec2f::Zero,				// spawnPosOffset
 	"DebrisNew/DebrisEmberLg",	// animName
 	0,							// animStartFrame
@@ -736,7 +736,7 @@ static ParticleSpawnerDef g_emberSpawnerLg1 = {
 	{ 4, 4 },					// burstParticleRange
 	1.0f,						// burstRate
 };
-static ParticleSpawnerDef g_emberSpawnerLg2 = {
+inline ParticleSpawnerDef g_emberSpawnerLg2 = {
 	Vec2f::Zero,				// spawnPosOffset
 	"DebrisNew/DebrisEmberLg",	// animName
 	0,							// animStartFrame
@@ -766,7 +766,7 @@ static ParticleSpawnerDef g_emberSpawnerLg2 = {
 	{ 2, 3 },					// burstParticleRange
 	1.0f,						// burstRate
 };
-static ParticleSpawnerDef g_emberSpawnerCharged = {
+inline ParticleSpawnerDef g_emberSpawnerCharged = {
 	Vec2f::Zero,				// spawnPosOffset
 	"DebrisNew/DebrisEmberLg",	// animName
 	0,							// animStartFrame
@@ -796,7 +796,7 @@ static ParticleSpawnerDef g_emberSpawnerCharged = {
 	{ 8, 8 },					// burstParticleRange
 	1.0f,						// burstRate
 };
-static ParticleSpawnerDef g_testSpawner = {
+inline ParticleSpawnerDef g_testSpawner = {
 	Vec2f::Zero,				// spawnPosOffset
 	"DebrisNew/DebrisGenericDark",	// animName
 	0,							// animStartFrame
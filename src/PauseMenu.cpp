@@ -22,7 +22,7 @@ void PauseMenu::Initialize() {
 	auto worldView = GetWindow()->GetWorldView();
 	SetDrawLayer(4);
 	m_bkgQuad = MakeSprite(Transform::Identity);
-	m_bkgQuad->SetRenderLayer("hud");
+	m_bkgQuad->SetRenderLayer(RL_Hud);
 	m_bkgQuad->SetComponentDrawOrder(0);
 	m_bkgQuad->PlayAnim("Square/10px", true);
 	m_bkgQuad->SetWorldScale({ 34.4f, 24.4f });
@@ -32,7 +32,7 @@ void PauseMenu::Initialize() {
 	// Setup menu heading
 	m_headingTextComp = MakeText(Transform::Identity);
 	m_headingTextComp->SetFont("Pixica-Bold");
-	m_headingTextComp->SetRenderLayer("hud");
+	m_headingTextComp->SetRenderLayer(RL_Hud);
 	m_headingTextComp->SetComponentDrawOrder(10);
 	auto font = m_headingTextComp->GetFont();
 	font->SetSmooth(false);
@@ -79,10 +79,10 @@ Task<> PauseMenu::ManageActor() {
 
 	// Setup caratSprites
 	auto caratSpriteL = Guard(MakeSprite());
-	caratSpriteL->SetRenderLayer("hud");
+	caratSpriteL->SetRenderLayer(RL_Hud);
 	caratSpriteL->PlayAnim("MenuCarat/Carat", true);
 	auto caratSpriteR = Guard(MakeSprite());
-	caratSpriteR->SetRenderLayer("hud");
+	caratSpriteR->SetRenderLayer(RL_Hud);
 	caratSpriteR->PlayAnim("MenuCarat/Carat", true);
 	caratSpriteR->SetFlipHori(true);
 	co_await Suspend(); //< HACK: wait one frame for menuItems to initialize, and therefore have an actual Bounds to Get()
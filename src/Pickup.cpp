@@ -82,7 +82,7 @@ namespace PickupFuncs {
 void Pickup::Initialize() {
 	GameActor::Initialize();
 	m_sprite = MakeSprite(Transform::Identity);
-	m_sprite->SetRenderLayer("hud");
+	m_sprite->SetRenderLayer(RL_Hud);
 	if(m_pickupDef->size == ePickupSize::Small) {
 		m_radius = 5.0f;
 		m_lifetime = 6.33f;
@@ -205,4 +205,5 @@ void Pickup::SetupShell() {
 	m_sprite->PlayAnim("ItemSphere/Sphere", false, 0);
 	m_sprite->SetPlayRate(0.0f);
 	m_collider = MakeCollider_Box(AsShared(), Transform::Identity, GetWorld()->GetCollisionWorld(), Box2f::FromCenter(Vec2f::Zero, {14.0f, 14.0f}));
+	m_collider->SetCategory(CL_Pickup);
 }
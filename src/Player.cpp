@@ -60,6 +60,9 @@ private:
 
 //--- PLAYER CODE ---//
 
+Player::Player() {
+	SetActorType(eGameActorType::Player);
+}
 void Player::Initialize() {
 	Character::Initialize();
 	// Set up world collision
@@ -938,7 +941,7 @@ Task<> Player::DashState() {
 						auto boxOffsetPos = Vec2f{ GetWorldPos().x, yPosRounded } + Vec2f{ 0.0f, float(i) * flipVal };
 						auto boxOffsetTransform = Transform{ boxOffsetPos, 0.0f, Vec2f::One };
 						auto testSweepVec = Vec2f{ xImpulse, 0.0f }.Norm();
-						auto colliderSweepResults = GetWorld()->GetCollisionWorld()->SweepBox(m_worldCollisionBoxLocal.TransformedBy(boxOffsetTransform), testSweepVec);
+						auto colliderSweepResults = GetWorld()->GetCollisionWorld()->SweepBox(m_worldCollisionBoxLocal.TransformedBy(boxOffsetTransform), testSweepVec, m_collisionMask);
 						auto tryDestroyResults = TryDestroyTiles(boxOffsetPos, Vec2f{ xImpulse, 0.0f }.Norm(), false);
 						if(!colliderSweepResults) {
 							Move(boxOffsetPos, false, 0.01f, nullptr, true);
@@ -970,7 +973,7 @@ Task<> Player::DashState() {
 						auto boxOffsetPos = Vec2f{ xPosRounded, GetWorldPos().y } + Vec2f{ float(i) * flipVal, 0.0f};
 						auto boxOffsetTransform = Transform{ boxOffsetPos, 0.0f, Vec2f::One };
 						auto testSweepVec = Vec2f{ 0.0f, yImpulse }.Norm();
-						auto colliderSweepResults = collisionWorld->SweepBox(testBox.TransformedBy(boxOffsetTransform), testSweepVec);
+						auto colliderSweepResults = collisionWorld->SweepBox(testBox.TransformedBy(boxOffsetTransform), testSweepVec, m_collisionMask);
 						auto tryDestroyResults = TryDestroyTiles(boxOffsetPos, Vec2f{  0.0f, yImpulse }.Norm(), false);
 						if(!colliderSweepResults) {
 							Move(boxOffsetPos, false, 0.01f, nullptr, true);
@@ -2106,7 +2109,7 @@ Task<> Player::FireWeaponTask() {
 					else if(playerStatus->IsLongBeamUnlocked()) {
 						projectileDefIndex += 6;
 					}
-					bullet = Actor::Spawn<Projectile>(world, bulletTransform, projectileDefLookupTable[projectileDefIndex], bulletDirection, m_fireHeur.facingDir);
+					bullet = world->GetProjectileManager()->SpawnPooled(bulletTransform, projectileDefLookupTable[projectileDefIndex], bulletDirection, m_fireHeur.facingDir);
 					AudioManager::Get()->PlaySound("BeamFire", 0.0f, 0.8f);
 				}
 				m_fireHeur.primaryChargedFiring = false;
@@ -3,6 +3,7 @@
 #include "Character.h"
 #include "TokenList.h"
 #include "GameEnums.h"
+#include "Projectile.h"
 
 class Projectile;
 class InputComponent;
@@ -20,6 +21,7 @@ class Light;
 // Main player character class (full movement & abilities controller, including weapon charging/firing)
 class Player : public Character {
 public:
+	Player();
 	virtual void Initialize() override;
 	virtual void Destroy() override;
 	virtual void Update() override;
@@ -132,7 +134,7 @@ private:
 	std::shared_ptr<Lava> m_touchingLava;
 
 	// Live projectile lists
-	std::vector<std::shared_ptr<Projectile>> m_bullets;
+	std::vector<ProjectileHandle> m_bullets;
 	std::vector<std::shared_ptr<Projectile>> m_grenades;
 	std::vector<std::shared_ptr<Bomb>> m_bombs;
 
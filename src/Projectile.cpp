@@ -7,6 +7,7 @@
 #include "Door.h"
 #include "Creature.h"
 #include "ProjectileManager.h"
+#include "SensorManager.h"
 #include "AudioManager.h"
 #include "Effect.h"
 #include "DestroyedTile.h"
@@ -31,6 +32,7 @@ Projectile::Projectile(const ProjectileDef& in_def, const Vec2f& in_dir, int32_t
 	//, m_mag(in_mag)
 	, m_def(in_def)
 {
+	SetActorType(eGameActorType::Projectile);
 }
 
 //--- PROJECTILE CODE ---//
@@ -38,6 +40,22 @@ Projectile::Projectile(const ProjectileDef& in_def, const Vec2f& in_dir, int32_t
 void Projectile::Initialize() {
 	GameActor::Initialize();
 	m_bUpdatesOffScreen = false;
+
+	// Setup sensor (shape + filtering are set per shot)
+	m_projectileSensor = MakeSensor(Transform::Identity, SensorShape{});
+	m_projectileSensor->SetTouchCallback([this](bool in_beginning, std::shared_ptr<SensorComponent> in_other) {
+		if(in_beginning) {
+			OnTouchSensor(in_other, true);
+		}
+	});
+
+	// Setup sprite
+	m_projectileSprite = MakeSprite(Transform::Identity);
+	m_projectileSprite->SetRenderLayer(RL_Hud);
+
+	SetupShot();
+}
+void Projectile::SetupShot() {
 	m_spawnPos = GetWorldPos();
 	m_worldCollisionBox = Box2f::FromCenter(Vec2f::Zero, { m_def.sensorRadius, m_def.sensorRadius });
 	
@@ -48,35 +66,13 @@ void Projectile::Initialize() {
 	Circle projectileCollisionCircle = { m_def.sensorRadius };
 	SensorShape projectileSensorShape;
 	projectileSensorShape.SetCircle(projectileCollisionCircle);
-	auto projectileSensor = MakeSensor(Transform::Identity, projectileSensorShape);
-	projectileSensor->SetFiltering(m_def.category, m_def.mask);
-	projectileSensor->SetTouchCallback([this](bool in_beginning, std::shared_ptr<SensorComponent> in_other) {
-		if(in_beginning) {
-			if(std::dynamic_pointer_cast<Creature>(in_other->GetActor())) {
-				OnTouchCreature(std::dynamic_pointer_cast<Creature>(in_other->GetActor()), in_other);
-			}
-			if(std::dynamic_pointer_cast<Player>(in_other->GetActor())) {
-				OnTouchPlayer(std::dynamic_pointer_cast<Player>(in_other->GetActor()), in_other);
-			}
-			if(std::dynamic_pointer_cast<Projectile>(in_other->GetActor())) {
-				OnTouchProjectile(std::dynamic_pointer_cast<Projectile>(in_other->GetActor()), in_other);
-			}
-			if(std::dynamic_pointer_cast<Door>(in_other->GetActor())) {
-				OnTouchDoor(std::dynamic_pointer_cast<Door>(in_other->GetActor()), in_other);
-			}
-		}
-	});
+	m_projectileSensor->SetShape(projectileSensorShape);
+	m_projectileSensor->SetFiltering(m_def.category, m_def.mask);
 
-	// Setup sprite
-	m_projectileSprite = MakeSprite(Transform::Identity);
-	m_projectileSprite->SetRenderLayer("hud");
+	// Setup sprite + orientation
 	m_projectileSprite->PlayAnim(m_def.animName, true);
 	m_projectileSprite->SetWorldRot(float(Math::VecToDegrees(m_direction)));
-
-	// Setup orientation
-	if(m_direction.x < 0.0f) {
-		m_projectileSprite->SetFlipVert(true);
-	}
+	m_projectileSprite->SetFlipVert(m_direction.x < 0.0f);
 
 	// Register
 	GetWorld()->GetProjectileManager()->RegisterProjectile(AsShared<Projectile>());
@@ -88,15 +84,65 @@ void Projectile::DeferredDestroy() {
 	if(std::dynamic_pointer_cast<Creature>(m_instigator)) {
 		std::dynamic_pointer_cast<Creature>(m_instigator)->ChangeProjectileCount(-1);
 	}
+	if(IsPooled()) { //< Pooled projectiles go back to the pool at the end of the frame instead of being destroyed
+		if(!m_bReleasePending) {
+			m_bReleasePending = true;
+			GetWorld()->GetProjectileManager()->QueueRelease(AsShared<Projectile>());
+		}
+		return;
+	}
 	GameActor::DeferredDestroy();
 }
+void Projectile::Reuse(	const Transform& in_transform, const ProjectileDef& in_def, const Vec2f& in_dir, int32_t in_facingDir, 
+						const float in_mag) {
+	// Reset everything a shot can change back to how a newly constructed projectile starts out, then set up the new shot
+	m_def = in_def;
+	m_worldCollisionBox = Box2f::FromCenter(Vec2f::Zero, in_def.collisionBoxDims);
+	m_speed = in_def.speed * in_mag;
+	m_direction = in_dir;
+	m_facingDir = in_facingDir;
+	m_maxSpeed = 1.0f * 60.0f;
+	m_waveDir = 1.0f;
+	m_bounce = 0.0f;
+	m_gravity = 0.05f * 60.0f;
+	m_bIgnoresWorld = false;
+	m_rotationSpeed = 0.0f;
+	m_animPlayrate = 1.0f;
+	m_elapsedLifetime = 0.0f;
+	m_finalCountdown = false;
+	m_bIsExploding = false;
+	m_bExplosionTriggered = false;
+	m_bReleasePending = false;
+	SetTargeted(false);
+	SetWorldTransform(in_transform);
+	SetHidden(false);
+	m_projectileSprite->SetPlayRate(m_animPlayrate);
+	SetupShot();
+	m_taskMgr.RunManaged(ManageActor());
+}
+void Projectile::Release(uint32_t in_generation) {
+	// Park the projectile until it's reused -- its sensors stay registered, but can't touch anything, and their current touches 
+	// are forgotten so the next shot's overlaps are reported as new touches
+	m_taskMgr.KillAllTasks();
+	auto sensorMgr = GetWorld()->GetSensorManager();
+	m_projectileSensor->SetFiltering(0, 0);
+	sensorMgr->ForgetTouches(m_projectileSensor);
+	if(m_aoeSensor) {
+		m_aoeSensor->SetFiltering(0, 0);
+		sensorMgr->ForgetTouches(m_aoeSensor);
+	}
+	m_projectileSprite->Stop();
+	SetHidden(true);
+	m_instigator = nullptr;
+	m_actorsAlreadyHit.clear();
+	m_generation = in_generation; //< The slot's new generation, which invalidates any handles to the shot that just ended
+}
 Task<> Projectile::ManageActor() {
 	while(true) {
 		if(!m_bIsExploding && (m_elapsedLifetime >= m_def.lifetime || m_bExplosionTriggered)) {
 			co_await ExplodeTask();
 		}
-		auto newPos = ModifyMovement();
-		Move(newPos);
+		GetWorld()->GetProjectileManager()->QueueMove(AsShared<Projectile>(), ModifyMovement());
 		m_projectileSprite->SetWorldRot(m_projectileSprite->GetWorldRot() + m_rotationSpeed * 360.0f * DT());
 		co_await Suspend();
 	}
@@ -106,26 +152,25 @@ Vec2f Projectile::ModifyMovement() {
 	return GetWorldPos() + (GetVel() * DT());
 }
 Vec2f Projectile::Move(Vec2f in_pos) {
+	std::vector<Math::GridSweepQuery> queries = { { GetCollisionBoxWorld().GetCenter(), in_pos - GetWorldPos(), GetCollisionBoxWorld().GetDims() * 0.5f } };
+	std::vector<std::optional<Math::GridSweepHit>> hits;
+	if(!m_bIgnoresWorld) {
+		Math::SweepBoxesAgainstGrid(queries, GetCollisionTilesComp()->GetGridToWorldTransform(), GetBlockingTileCells(), hits);
+	}
+	return ApplyMove(in_pos, hits.size() ? hits[0] : std::nullopt);
+}
+Vec2f Projectile::ApplyMove(Vec2f in_pos, const std::optional<Math::GridSweepHit>& in_worldHit) {
 	auto dmgInfo = GetDamageInfo();
 	auto newPos = in_pos - GetWorldPos();
-	auto bOpensDoors = (m_def.mask & CL_Door) != 0;
 	auto penetratesWalls = dmgInfo.m_damageFlags & DF_NoWalls;
 	auto isCharged = dmgInfo.m_damageFlags & DF_Charged;
-	int32_t tile = 0;
-	auto sweepResults = Math::SweepBoxAgainstGrid(GetCollisionBoxWorld(), newPos,
-		GetCollisionTilesComp()->GetGridToWorldTransform(),
-		GetCollisionTilesComp()->GetTileLayer()->GetGridBoundingBox(),
-		[this, tile, bOpensDoors](Vec2i in_testPos) mutable {
-			tile = GetCollisionTilesComp()->GetTileLayer()->GetTile(in_testPos);
-			return bOpensDoors ? (tile == 237) : (tile > 0);
-		});
-	if(sweepResults && !m_bIgnoresWorld) { //< Filter out homing missiles here
-		auto newVec = sweepResults->m_sweptBox.GetBottomLeft() - GetCollisionBoxWorld().GetBottomLeft();
+	if(in_worldHit && !m_bIgnoresWorld) { //< Filter out homing missiles here
+		auto newVec = newPos * in_worldHit->m_time;
 		auto tileBoundaryPos = GetWorldPos() + newVec + (newVec.Norm() * ((m_def.sensorRadius / 2) - 0.01f));
 		if(m_bounce) {
-			Bounce(sweepResults.value(), m_bounce);
+			Bounce(in_worldHit->m_normal, m_bounce);
 		}
-		else if(TryDestroyTiles(tileBoundaryPos, -sweepResults->m_normal, penetratesWalls, isCharged ? 1 : 0)) {
+		else if(TryDestroyTiles(tileBoundaryPos, -in_worldHit->m_normal, penetratesWalls, isCharged ? 1 : 0)) {
 			auto effect = Actor::Spawn<Effect>(GetWorld(), { tileBoundaryPos }, m_def.hitEffectAnimName);
 			AudioManager::Get()->PlaySound(m_def.hitEffectSoundName);
 			DeferredDestroy();
@@ -150,10 +195,15 @@ Vec2f Projectile::Move(Vec2f in_pos) {
 	//DrawDebugBox(worldTiles->GridPosToWorldBox(actorGridPos), sf::Color::Cyan);
 	return newPos;
 }
-void Projectile::Bounce(const Math::BoxSweepResults& in_sweepResults, float in_amount) {
+const GridBitset& Projectile::GetBlockingTileCells() const {
+	// Door-opening projectiles pass through door tiles and only stop at the blocking tiles (see GameWorld::LoadMap)
+	auto collisionTiles = GetCollisionTilesComp();
+	return OpensDoors() ? collisionTiles->GetTileCells(237) : collisionTiles->GetSolidCells();
+}
+void Projectile::Bounce(Vec2f in_hitNormal, float in_amount) {
 	// Modifies m_direction and m_speed to reflect (eyyy) a bounce off the world geometry
 	auto vel = GetVel();
-	auto normalUpVec = in_sweepResults.m_normal;
+	auto normalUpVec = in_hitNormal;
 	auto normalRightVec = normalUpVec.RotateDeg(-90.0f);
 	auto bounceVec = (normalRightVec * vel.Dot(normalRightVec) + (normalUpVec * vel.Dot(normalUpVec) * -1));
 	m_direction = bounceVec.Norm();
@@ -170,21 +220,19 @@ void Projectile::MakeAoeSensor(float in_radius) {
 	Circle projectileCollisionCircle = { in_radius };
 	SensorShape projectileSensorShape;
 	projectileSensorShape.SetCircle(projectileCollisionCircle);
-	auto projectileSensor = MakeSensor(Transform::Identity, projectileSensorShape);
-	projectileSensor->SetFiltering(m_def.category, CL_Enemy | CL_Player | CL_Door | CL_Pickup);
-	projectileSensor->SetTouchCallback([this](bool in_beginning, std::shared_ptr<SensorComponent> in_other) {
+	if(m_aoeSensor) { //< Pooled projectiles keep their AoE sensor between shots
+		m_aoeSensor->SetShape(projectileSensorShape);
+		m_aoeSensor->SetFiltering(m_def.category, CL_Enemy | CL_Player | CL_Door | CL_Pickup);
+		GetWorld()->GetSensorManager()->ForgetTouches(m_aoeSensor);
+		return;
+	}
+	m_aoeSensor = MakeSensor(Transform::Identity, projectileSensorShape);
+	m_aoeSensor->SetFiltering(m_def.category, CL_Enemy | CL_Player | CL_Door | CL_Pickup);
+	m_aoeSensor->SetTouchCallback([this](bool in_beginning, std::shared_ptr<SensorComponent> in_other) {
 		auto alreadyHit = std::find(m_actorsAlreadyHit.begin(), m_actorsAlreadyHit.end(), 
 									in_other->GetActor()) != m_actorsAlreadyHit.end();
 		if(!alreadyHit && m_bIsExploding && in_beginning) {
-			if(std::dynamic_pointer_cast<Creature>(in_other->GetActor())) {
-				OnTouchCreature(std::dynamic_pointer_cast<Creature>(in_other->GetActor()), in_other);
-			}
-			if(std::dynamic_pointer_cast<Player>(in_other->GetActor())) {
-				OnTouchPlayer(std::dynamic_pointer_cast<Player>(in_other->GetActor()), in_other);
-			}
-			if(std::dynamic_pointer_cast<Door>(in_other->GetActor())) {
-				OnTouchDoor(std::dynamic_pointer_cast<Door>(in_other->GetActor()), in_other);
-			}
+			OnTouchSensor(in_other, false);
 		}
 	});
 }
@@ -195,11 +243,11 @@ Task<> Projectile::ExplodeTask() {
 	m_bIsExploding = true;
 	auto effect = Actor::Spawn<Effect>(GetWorld(), GetWorldTransform(), m_def.hitEffectAnimName);
 	Actor::Spawn<ParticleSpawner>(GetWorld(), { GetWorldPos() },
-		g_debrisSpawnerSm1, std::nullopt, "Base");
+		&g_debrisSpawnerSm1, std::nullopt, "Base");
 	Actor::Spawn<ParticleSpawner>(GetWorld(), { GetWorldPos() },
-		g_emberSpawnerLg1, std::nullopt, "Base");
+		&g_emberSpawnerLg1, std::nullopt, "Base");
 	Actor::Spawn<ParticleSpawner>(GetWorld(), { GetWorldPos() },
-		g_emberSpawnerLg2, std::nullopt, "Base");
+		&g_emberSpawnerLg2, std::nullopt, "Base");
 	m_projectileSprite->PlayAnim("Util/Blank", true);
 	m_speed = 0.0f;
 	MakeAoeSensor(16.0f);
@@ -216,6 +264,31 @@ void Projectile::DestroyBullet() {
 	auto effect = Actor::Spawn<Effect>(GetWorld(), GetWorldTransform(), m_def.hitEffectAnimName);
 	DeferredDestroy();
 }
+void Projectile::OnTouchSensor(std::shared_ptr<SensorComponent> in_other, bool in_bTouchesProjectiles) {
+	// Sensors are only made by GameActor::MakeSensor(), so the other sensor's actor is always a GameActor
+	auto otherActor = std::static_pointer_cast<GameActor>(in_other->GetActor());
+	if(!otherActor) {
+		return;
+	}
+	switch(otherActor->GetActorType()) {
+	case eGameActorType::Creature:
+		OnTouchCreature(std::static_pointer_cast<Creature>(otherActor), in_other);
+		break;
+	case eGameActorType::Player:
+		OnTouchPlayer(std::static_pointer_cast<Player>(otherActor), in_other);
+		break;
+	case eGameActorType::Projectile:
+		if(in_bTouchesProjectiles) {
+			OnTouchProjectile(std::static_pointer_cast<Projectile>(otherActor), in_other);
+		}
+		break;
+	case eGameActorType::Door:
+		OnTouchDoor(std::static_pointer_cast<Door>(otherActor), in_other);
+		break;
+	default:
+		break;
+	}
+}
 void Projectile::OnTouchCreature(std::shared_ptr<Creature> in_creature, std::shared_ptr<SensorComponent> in_sensor) {
 	// Eliminate friendly fire between enemies
 	if(std::dynamic_pointer_cast<Creature>(m_instigator) && in_creature->GetDamageInfo().m_damageFlags & DF_Enemy) {
@@ -262,3 +335,13 @@ void Projectile::OnTouchProjectile(std::shared_ptr<Projectile> in_projectile, st
 		}
 	}
 }
+
+//--- PROJECTILE SPAWNING ---//
+
+template <>
+std::shared_ptr<Projectile> SpawnProjectile<Projectile>(std::shared_ptr<Character> in_instigator, const Transform& in_transform, 
+														const ProjectileDef& in_def, const Vec2f& in_dir, int32_t in_facingDir, const float in_mag) {
+	auto projectile = in_instigator->GetWorld()->GetProjectileManager()->SpawnPooled(in_transform, in_def, in_dir, in_facingDir, in_mag);
+	projectile->SetInstigator(in_instigator);
+	return projectile;
+}
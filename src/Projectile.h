@@ -24,6 +24,10 @@ std::shared_ptr<T> SpawnProjectile(	std::shared_ptr<Character> in_instigator, co
 	projectile->SetInstigator(in_instigator);
 	return projectile;
 }
+// Plain projectiles are recycled from the ProjectileManager's pool instead of being spawned per shot
+template <>
+std::shared_ptr<Projectile> SpawnProjectile<Projectile>(std::shared_ptr<Character> in_instigator, const Transform& in_transform, 
+														const ProjectileDef& in_def, const Vec2f& in_dir, int32_t in_facingDir, const float in_mag);
 
 struct ProjectileDef {
 	Vec2f collisionBoxDims = { 8.0f, 8.0f };
@@ -70,8 +74,10 @@ public:
 	Box2f GetCollisionBoxWorld() const { return m_worldCollisionBox.TransformedBy(GetWorldTransform()); };
 	virtual Vec2f ModifyMovement();
 
-	Vec2f Move(Vec2f in_pos);
-	void Bounce(const Math::BoxSweepResults& in_sweepResults, float in_amount);
+	Vec2f Move(Vec2f in_pos); //< Sweeps + moves immediately (normally moves are queued with the ProjectileManager and swept in a batch)
+	Vec2f ApplyMove(Vec2f in_pos, const std::optional<Math::GridSweepHit>& in_worldHit);
+	const GridBitset& GetBlockingTileCells() const;
+	void Bounce(Vec2f in_hitNormal, float in_amount);
 	void MakeAoeSensor(float in_radius);
 	void SetInstigator(std::shared_ptr<Character> in_character) { m_instigator = in_character; }
 	Vec2f GetVel() { return m_direction * m_speed; }
@@ -81,15 +87,34 @@ public:
 	void Detonate();
 	bool IsPlayerBullet() { return (m_category & CL_PlayerBullet) != 0; }
 	bool IsEnemyBullet() { return (m_category & CL_EnemyBullet) != 0; }
+	bool IgnoresWorld() const { return m_bIgnoresWorld; }
+	bool OpensDoors() const { return (m_def.mask & CL_Door) != 0; } //< Door-opening projectiles only collide with the blocking tiles
+
+	// Pooling (see ProjectileManager::SpawnPooled()) -- a pooled projectile is reused for many shots, and its generation goes up each 
+	// time one of its shots ends. Use a ProjectileHandle to hold on to a single shot
+	bool IsPooled() const { return m_poolSlot >= 0; }
+	int32_t GetPoolSlot() const { return m_poolSlot; }
+	uint32_t GetGeneration() const { return m_generation; }
+	bool IsReleasePending() const { return m_bReleasePending; } //< Shot has ended, the projectile goes back to the pool at the end of the frame
 
 protected:
 	Task<> ExplodeTask();
 	void DestroyBullet();
+	void OnTouchSensor(std::shared_ptr<SensorComponent> in_other, bool in_bTouchesProjectiles); //< Dispatches to the OnTouch*() for the other actor's type
 	virtual void OnTouchCreature(std::shared_ptr<Creature> in_creature, std::shared_ptr<SensorComponent> in_sensor);
 	virtual void OnTouchPlayer(std::shared_ptr<Player> in_player, std::shared_ptr<SensorComponent> in_sensor);
-	void OnTouchDoor(std::shared_ptr<Door> in_door, std::shared_ptr<SensorComponent> in_sensor);
-	void OnTouchProjectile(std::shared_ptr<Projectile> in_projectile, std::shared_ptr<SensorComponent> in_sensor);
+	virtual void OnTouchDoor(std::shared_ptr<Door> in_door, std::shared_ptr<SensorComponent> in_sensor);
+	virtual void OnTouchProjectile(std::shared_ptr<Projectile> in_projectile, std::shared_ptr<SensorComponent> in_sensor);
+	void SetupShot(); //< Per-shot part of Initialize(), redone each time a pooled projectile is reused
 	
+	// Pooling
+	friend class ProjectileManager;
+	void Reuse(	const Transform& in_transform, const ProjectileDef& in_def, const Vec2f& in_dir, int32_t in_facingDir, const float in_mag);
+	void Release(uint32_t in_generation);
+	int32_t m_poolSlot = -1;
+	uint32_t m_generation = 0;
+	bool m_bReleasePending = false;
+
 	std::shared_ptr<Character> m_instigator;
 	Vec2f m_spawnPos = Vec2f::Zero;
 	// Sprite + anim data
@@ -99,9 +124,11 @@ protected:
 	std::string m_hitEffectSoundName = "Blank";
 	float m_animPlayrate = 1.0f;
 	// Collision/sensor + damage data
+	std::shared_ptr<SensorComponent> m_projectileSensor;
+	std::shared_ptr<SensorComponent> m_aoeSensor; //< Made by the first MakeAoeSensor() call
 	Box2f m_worldCollisionBox = Box2f::FromCenter(Vec2f::Zero, { 8.0f, 8.0f });
 	float m_sensorRadius = 8.0f;
-	const ProjectileDef m_def;
+	ProjectileDef m_def; //< Non-const so pooled projectiles can take a new def when they're reused
 	uint32_t m_category = 0;
 	uint32_t m_mask = 0;
 	// Physics data
@@ -124,6 +151,25 @@ protected:
 	std::vector<std::shared_ptr<GameActor>> m_actorsAlreadyHit;
 };
 
+// Reference to one shot -- unlike a plain shared_ptr, it goes invalid once the shot ends even if its (pooled) projectile is reused
+class ProjectileHandle {
+public:
+	ProjectileHandle() = default;
+	ProjectileHandle(std::shared_ptr<Projectile> in_projectile)
+		: m_projectile(in_projectile)
+		, m_generation(in_projectile ? in_projectile->GetGeneration() : 0) {
+	}
+	bool IsValid() const { return IsAlive(m_projectile) && m_projectile->GetGeneration() == m_generation; }
+	std::shared_ptr<Projectile> Get() const { return IsValid() ? m_projectile : nullptr; }
+
+private:
+	std::shared_ptr<Projectile> m_projectile;
+	uint32_t m_generation = 0;
+};
+inline bool IsAlive(const ProjectileHandle& in_handle) { //< Lets EraseInvalid() clean up containers of handles
+	return in_handle.IsValid();
+}
+
 //--- PROJECILE DEFS ---//
 
 static ProjectileDef g_creatureBulletDef = {
@@ -3,14 +3,17 @@
 
 #include "GameWorld.h"
 #include "Algorithms.h"
+#include "Engine/Components/TilesComponent.h"
 
 void ProjectileManager::Initialize() {
 	Actor::Initialize();
+	m_slotPool.Reset(s_poolCapacity);
+	m_poolSlots.resize(s_poolCapacity);
 }
 void ProjectileManager::Update() {
 	Actor::Update();
 	for(auto projectile : m_projectiles) {
-		if(!projectile->StillAlive() && !projectile->IsDestroyed()) {
+		if(!projectile->StillAlive() && !projectile->IsDestroyed() && !projectile->IsReleasePending()) {
 			auto hitEffectAnimName = projectile->GetHitEffectAnimName();
 			auto effect = Actor::Spawn<Effect>(GameWorld::Get(), { projectile->GetWorldPos() }, hitEffectAnimName);
 			auto hitEffectSoundName = projectile->GetHitEffectSoundName();
@@ -24,6 +27,95 @@ void ProjectileManager::Update() {
 void ProjectileManager::RegisterProjectile(std::shared_ptr<Projectile> in_proj) {
 	m_projectiles.push_back(in_proj);
 }
+std::shared_ptr<Projectile> ProjectileManager::SpawnPooled(	const Transform& in_transform, const ProjectileDef& in_def, const Vec2f& in_dir, 
+															int32_t in_facingDir, const float in_mag) {
+	const auto slotIdx = m_slotPool.Acquire();
+	if(slotIdx < 0) {
+		++m_numPoolFallbacks;
+		return Actor::Spawn<Projectile>(GameWorld::Get(), in_transform, in_def, in_dir, in_facingDir, in_mag);
+	}
+
+	// Reuse the slot's projectile, unless it hasn't been made yet (or was destroyed out from under the pool, e.g. with the world)
+	auto& projectile = m_poolSlots[slotIdx];
+	if(IsAlive(projectile)) {
+		projectile->Reuse(in_transform, in_def, in_dir, in_facingDir, in_mag);
+	}
+	else {
+		const auto generation = m_slotPool.GetGeneration(slotIdx);
+		projectile = Actor::SpawnWithInit<Projectile>(GameWorld::Get(), in_transform, [slotIdx, generation](std::shared_ptr<Projectile> in_proj) {
+			in_proj->m_poolSlot = slotIdx;
+			in_proj->m_generation = generation;
+		}, in_def, in_dir, in_facingDir, in_mag);
+	}
+	return projectile;
+}
+void ProjectileManager::QueueRelease(std::shared_ptr<Projectile> in_proj) {
+	m_pendingReleases.push_back(in_proj);
+}
+void ProjectileManager::FlushReleases() {
+	if(m_pendingReleases.empty()) {
+		return;
+	}
+	for(auto& projectile : m_pendingReleases) {
+		const auto slotIdx = projectile->GetPoolSlot();
+		m_slotPool.Release(slotIdx);
+		if(IsAlive(projectile)) {
+			projectile->Release(m_slotPool.GetGeneration(slotIdx));
+		}
+	}
+	m_projectiles.erase(std::remove_if(m_projectiles.begin(), m_projectiles.end(), [](const auto& in_proj) {
+		return in_proj->IsReleasePending();
+	}), m_projectiles.end());
+	m_pendingReleases.clear();
+}
 void ProjectileManager::RegisterEffect(std::shared_ptr<Effect> in_effect) {
 	m_effects.push_back(in_effect);
 }
+void ProjectileManager::QueueMove(std::shared_ptr<Projectile> in_proj, Vec2f in_targetPos) {
+	m_queuedMoves.push_back({ in_proj, in_targetPos, -1, -1 });
+}
+void ProjectileManager::FlushMoves() {
+	if(m_queuedMoves.empty()) {
+		return;
+	}
+	auto collisionTiles = GameWorld::Get()->GetCollisionTilesComp();
+	auto gridToWorldTM = collisionTiles->GetGridToWorldTransform();
+	const GridBitset* batchCells[2] = { &collisionTiles->GetSolidCells(), &collisionTiles->GetTileCells(237) };
+
+	// Split the queued moves by which tiles they collide with, then sweep each batch in one pass
+	for(auto& queries : m_sweepQueries) {
+		queries.clear();
+	}
+	for(auto& move : m_queuedMoves) {
+		if(!IsAlive(move.proj) || move.proj->IgnoresWorld()) {
+			continue;
+		}
+		const auto box = move.proj->GetCollisionBoxWorld();
+		move.batchIdx = move.proj->OpensDoors() ? 1 : 0;
+		move.queryIdx = (int32_t)m_sweepQueries[move.batchIdx].size();
+		m_sweepQueries[move.batchIdx].push_back({ box.GetCenter(), move.targetPos - move.proj->GetWorldPos(), box.GetDims() * 0.5f });
+	}
+	for(int32_t batchIdx = 0; batchIdx < 2; ++batchIdx) {
+		Math::SweepBoxesAgainstGrid(m_sweepQueries[batchIdx], gridToWorldTM, *batchCells[batchIdx], m_sweepHits[batchIdx]);
+	}
+
+	// Apply the moves in the order they were queued. Projectiles can destroy tiles as they hit them, which can only remove hits -- 
+	// so once the tiles have changed, any later hit gets re-swept against the current tiles.
+	const auto tileChangeCount = collisionTiles->GetTileChangeCount();
+	for(auto& move : m_queuedMoves) {
+		if(!IsAlive(move.proj)) {
+			continue;
+		}
+		std::optional<Math::GridSweepHit> hit;
+		if(move.batchIdx >= 0) {
+			hit = m_sweepHits[move.batchIdx][move.queryIdx];
+			if(hit && collisionTiles->GetTileChangeCount() != tileChangeCount) {
+				m_resweepQuery.assign(1, m_sweepQueries[move.batchIdx][move.queryIdx]);
+				Math::SweepBoxesAgainstGrid(m_resweepQuery, gridToWorldTM, *batchCells[move.batchIdx], m_resweepHit);
+				hit = m_resweepHit[0];
+			}
+		}
+		move.proj->ApplyMove(move.targetPos, hit);
+	}
+	m_queuedMoves.clear();
+}
@@ -2,10 +2,12 @@
 
 #include "Projectile.h"
 #include "Effect.h"
+#include "Engine/SlotPool.h"
 #include <memory>
 #include <vector>
 
-// Simple projectile registry and cleaner -- spawns hit effects, erases invalid (destroyed) entries each tick
+// Simple projectile registry and cleaner -- spawns hit effects, erases invalid (destroyed) entries each tick. Also owns the pool plain 
+// projectiles are recycled from
 class ProjectileManager : public Actor {
 public:
 	virtual void Initialize() override;
@@ -13,10 +15,46 @@ public:
 
 	size_t GetProjectileCount() { return m_projectiles.size(); }
 
+	// Pooling -- SpawnPooled() reuses a free slot's projectile (or makes one, the first time a slot is used) instead of spawning a new 
+	// actor. Pooled projectiles that are DeferredDestroy()ed are queued for release, and FlushReleases() (called by the world once per 
+	// frame, right after it destroys its DeferredDestroy()ed actors) parks them and frees their slots. If every slot is in use, 
+	// SpawnPooled() falls back to spawning an unpooled projectile
+	static constexpr int32_t s_poolCapacity = 64;
+	std::shared_ptr<Projectile> SpawnPooled(const Transform& in_transform, const ProjectileDef& in_def, const Vec2f& in_dir, 
+											int32_t in_facingDir = 0, const float in_mag = 1.0f);
+	void QueueRelease(std::shared_ptr<Projectile> in_proj);
+	void FlushReleases();
+	int32_t GetNumFreePoolSlots() const { return m_slotPool.GetNumFree(); }
+	uint32_t GetNumPoolFallbacks() const { return m_numPoolFallbacks; } //< Shots spawned unpooled because the pool was full
+
 	void RegisterProjectile(std::shared_ptr<Projectile> in_proj);
 	void RegisterEffect(std::shared_ptr<Effect> in_effect);
 
+	// Projectiles queue their moves while updating, then all queued moves are swept against the collision tiles in one batch 
+	// (FlushMoves() is called once per frame, just before sensors are tested)
+	void QueueMove(std::shared_ptr<Projectile> in_proj, Vec2f in_targetPos);
+	void FlushMoves();
+
 private:
 	std::vector<std::shared_ptr<Projectile>> m_projectiles;
 	std::vector<std::shared_ptr<Effect>> m_effects;
+
+	// Pooling
+	SlotPool m_slotPool; //< Which slots are free, and each slot's generation (its projectile's generation, see ProjectileHandle)
+	std::vector<std::shared_ptr<Projectile>> m_poolSlots; //< Null until the slot is first used
+	std::vector<std::shared_ptr<Projectile>> m_pendingReleases;
+	uint32_t m_numPoolFallbacks = 0;
+
+	// Move batching
+	struct QueuedMove {
+		std::shared_ptr<Projectile> proj;
+		Vec2f targetPos;
+		int32_t batchIdx; //< Which of the two sweep batches (solid tiles, or blocking tiles only) this move is in, or -1 if it ignores the world
+		int32_t queryIdx;
+	};
+	std::vector<QueuedMove> m_queuedMoves;
+	std::vector<Math::GridSweepQuery> m_sweepQueries[2];
+	std::vector<std::optional<Math::GridSweepHit>> m_sweepHits[2];
+	std::vector<Math::GridSweepQuery> m_resweepQuery; //< Scratch for re-sweeping a single move after the tiles change
+	std::vector<std::optional<Math::GridSweepHit>> m_resweepHit;
 };
@@ -8,47 +8,33 @@
 
 //--- SENSOR MANAGER CODE ---//
 
-void SensorManager::Initialize() {
-	Actor::Initialize();
-	GameBase::Get()->SetPhysicsCallback([this]() {
-		Update();
-	});
-}
-void SensorManager::Destroy() {
-	GameBase::Get()->SetPhysicsCallback(nullptr);
-	Actor::Destroy();
-}
 void SensorManager::Update() {
+	// Gather candidate pairs from the broadphase, then narrowphase-test only those
+	BuildBroadphasePairs();
+	++m_touchGeneration;
 	tTouches newTouches;
-	for(const auto& sensorA : m_sensors) {
+	for(const auto& pairIdxs : m_broadphasePairs) {
+		const auto& sensorA = m_sensors[pairIdxs.first];
+		const auto& sensorB = m_sensors[pairIdxs.second];
+		if(sensorA == sensorB) {
+			continue;
+		}
+		if(sensorA->IsTouching(sensorB)) {
 
-		// Check for touches
-		for(const auto& sensorB : m_sensors) {
-			if(sensorA == sensorB) {
-				continue;
-			}
-			if(sensorA->IsTouching(sensorB)) {
-
-				// Verify this is a NEW touch -- if not, ignore
-				auto IsDuplicate = [this, sensorA, sensorB](const tTouches& in_sensorVector) {
-					for(const auto& pair : in_sensorVector) {
-						if((pair.first == sensorA && pair.second == sensorB) ||
-							(pair.first == sensorB && pair.second == sensorA)) {
-							return true;
-						}
-					}
-					return false;
-				};
-				if(!IsDuplicate(newTouches) && !IsDuplicate(m_currentTouches)) {
-					auto newPair = std::make_pair(sensorA, sensorB);
-					newTouches.push_back(newPair);
-					//printf("new touch!\n");
-				}
+			// Stamp the pair as touching this frame -- it's a NEW touch only if it wasn't already in the table
+			bool bInserted = false;
+			m_touchPairs.FindOrInsert(sensorA.get(), sensorB.get(), bInserted) = m_touchGeneration;
+			if(bInserted) {
+				auto newPair = std::make_pair(sensorA, sensorB);
+				newTouches.push_back(newPair);
+				//printf("new touch!\n");
 			}
 		}
+	}
 
-		// Display debug shapes
-		if(GameLoop::ShouldDisplayDebug()) {
+	// Display debug shapes
+	if(GameLoop::ShouldDisplayDebug()) {
+		for(const auto& sensorA : m_sensors) {
 			if(sensorA->GetShape().GetShapeType() == eSensorShapeType::Circle) {
 				auto circle = sensorA->GetShape().GetCircle();
 				DrawDebugCircle(Vec2f::Zero, circle.radius, sf::Color::White, sensorA->GetWorldTransform(), (-1.0f));
@@ -61,6 +47,7 @@ void SensorManager::Update() {
 	}
 
 	// Dispatch new touch callbacks
+	m_bDispatchingTouches = true;
 	for(const auto& sensorPair : newTouches) {
 		auto& sensorA = sensorPair.first;
 		auto& sensorB = sensorPair.second;
@@ -73,15 +60,79 @@ void SensorManager::Update() {
 	}
 
 	// Identify + remove touches that are no longer overlapping
+	// (if no touch callbacks ran, nothing has moved since the narrowphase, so pairs stamped this frame are known to still be touching --
+	// everything else, eg pairs involving unregistered sensors, gets re-tested)
+	const bool bStampsAreCurrent = newTouches.empty();
 	tTouches untouches;
-	auto CheckPairTouch = [](const auto& pair) {
+	auto CheckPairTouch = [this, bStampsAreCurrent](const auto& pair) {
+		if(bStampsAreCurrent) {
+			const uint32_t* stamp = m_touchPairs.Find(pair.first.get(), pair.second.get());
+			if(stamp && *stamp == m_touchGeneration) {
+				return false;
+			}
+		}
 		return !pair.first->IsTouching(pair.second);
 	};
-	std::copy_if(m_currentTouches.begin(), m_currentTouches.end(), std::back_inserter(untouches), CheckPairTouch);
-	m_currentTouches.erase(std::remove_if(m_currentTouches.begin(), m_currentTouches.end(), CheckPairTouch), m_currentTouches.end());
+	size_t numKept = 0;
+	for(size_t touchIdx = 0; touchIdx < m_currentTouches.size(); ++touchIdx) {
+		auto& pair = m_currentTouches[touchIdx];
+		if(CheckPairTouch(pair)) {
+			m_touchPairs.Erase(pair.first.get(), pair.second.get());
+			untouches.push_back(std::move(pair));
+		}
+		else if(numKept++ != touchIdx) {
+			m_currentTouches[numKept - 1] = std::move(pair);
+		}
+	}
+	m_currentTouches.resize(numKept);
 
 	// Dispatch untouch callbacks
-	for(const auto sensorPair : untouches) {
+	DispatchUntouches(untouches);
+	m_bDispatchingTouches = false;
+
+	// Add new touches that are overlapping this frame
+	std::move(newTouches.begin(), newTouches.end(), std::back_inserter(m_currentTouches));
+
+	// Now that this frame's new touches are tracked, forget the sensors that callbacks asked to forget
+	auto deferredForgets = std::move(m_deferredForgets);
+	m_deferredForgets.clear();
+	for(const auto& sensor : deferredForgets) {
+		ForgetTouches(sensor);
+	}
+
+	// Remove any invalid sensors (this shifts sensor indices, so the static partition has to be rebuilt)
+	const auto numSensors = m_sensors.size();
+	EraseInvalid(m_sensors);
+	if(m_sensors.size() != numSensors) {
+		m_bStaticPartitionDirty = true;
+	}
+}
+void SensorManager::RegisterSensor(std::shared_ptr<SensorComponent> in_comp) {
+	m_sensors.push_back(in_comp);
+}
+void SensorManager::ForgetTouches(const std::shared_ptr<SensorComponent>& in_sensor) {
+	// Callbacks run mid-Update, while this frame's new touches aren't in m_currentTouches yet -- defer until they are
+	if(m_bDispatchingTouches) {
+		m_deferredForgets.push_back(in_sensor);
+		return;
+	}
+	tTouches untouches;
+	size_t numKept = 0;
+	for(size_t touchIdx = 0; touchIdx < m_currentTouches.size(); ++touchIdx) {
+		auto& pair = m_currentTouches[touchIdx];
+		if(pair.first == in_sensor || pair.second == in_sensor) {
+			m_touchPairs.Erase(pair.first.get(), pair.second.get());
+			untouches.push_back(std::move(pair));
+		}
+		else if(numKept++ != touchIdx) {
+			m_currentTouches[numKept - 1] = std::move(pair);
+		}
+	}
+	m_currentTouches.resize(numKept);
+	DispatchUntouches(untouches);
+}
+void SensorManager::DispatchUntouches(const tTouches& in_untouches) {
+	for(const auto& sensorPair : in_untouches) {
 		auto& sensorA = sensorPair.first;
 		auto& sensorB = sensorPair.second;
 		if(IsAlive(sensorA)) {
@@ -91,13 +142,199 @@ void SensorManager::Update() {
 			sensorB->CallTouchCallback(false, sensorA);
 		}
 	}
+}
+void SensorManager::SetBroadphaseCellSize(float in_cellSize) {
+	SQUID_RUNTIME_CHECK(in_cellSize > 0.0f, "Broadphase cell size must be positive");
+	m_broadphaseCellSize = in_cellSize;
+}
+void SensorManager::BuildBroadphasePairs() {
+	const auto ToCellKey = [](int32_t in_x, int32_t in_y) {
+		return ((uint64_t)(uint32_t)in_x << 32) | (uint64_t)(uint32_t)in_y;
+	};
+	const auto SortEntries = [](std::vector<BroadphaseEntry>& in_entries) {
+		std::sort(in_entries.begin(), in_entries.end(), [](const BroadphaseEntry& in_a, const BroadphaseEntry& in_b) {
+			return in_a.cellKey < in_b.cellKey || (in_a.cellKey == in_b.cellKey && in_a.sensorIdx < in_b.sensorIdx);
+		});
+	};
 
-	// Add new touches that are overlapping this frame
-	std::move(newTouches.begin(), newTouches.end(), std::back_inserter(m_currentTouches));
+	// Classify sensors as static or dynamic, and rebuild the spatial hash for dynamic ones: one entry per (covered cell, sensor)
+	m_broadphaseEntries.clear();
+	m_sensorCellRanges.resize(m_sensors.size());
+	m_sensorKinds.resize(m_sensors.size(), eBroadphaseKind::None);
+	for(int32_t sensorIdx = 0; sensorIdx < (int32_t)m_sensors.size(); ++sensorIdx) {
+		const auto& sensor = m_sensors[sensorIdx];
+		const auto prevKind = m_sensorKinds[sensorIdx];
+		if(sensor->GetShape().GetShapeType() == eSensorShapeType::None) {
+			m_sensorKinds[sensorIdx] = eBroadphaseKind::None; //< Shapeless sensors can never touch anything
+			m_bStaticPartitionDirty |= (prevKind == eBroadphaseKind::Static);
+			continue;
+		}
+		// Shape and filtering changes count as moving, so an idle sensor that's just been switched on gets tested against the static 
+		// partition again (static vs static pairs never are)
+		auto bounds = sensor->GetWorldBounds();
+		const bool bMoved = sensor->m_bBroadphaseWoken || 
+			bounds.GetMin() != sensor->m_lastBroadphaseBounds.GetMin() || bounds.GetMax() != sensor->m_lastBroadphaseBounds.GetMax();
+		sensor->m_lastBroadphaseBounds = bounds;
+		sensor->m_bBroadphaseWoken = false;
+		sensor->m_broadphaseFramesUnmoved = bMoved ? 0 : Math::Min(sensor->m_broadphaseFramesUnmoved + 1, m_autoStaticFrameCount);
+		const bool bIsStatic = sensor->IsStatic() || (m_autoStaticFrameCount > 0 && sensor->m_broadphaseFramesUnmoved >= m_autoStaticFrameCount);
+		m_sensorKinds[sensorIdx] = bIsStatic ? eBroadphaseKind::Static : eBroadphaseKind::Dynamic;
+		m_bStaticPartitionDirty |= (bIsStatic != (prevKind == eBroadphaseKind::Static)) || (bIsStatic && bMoved);
 
-	// Remove any invalid sensors
-	EraseInvalid(m_sensors);
+		auto minCell = Vec2i{ Math::FloorToInt(bounds.GetMin().x / m_broadphaseCellSize), Math::FloorToInt(bounds.GetMin().y / m_broadphaseCellSize) };
+		auto maxCell = Vec2i{ Math::FloorToInt(bounds.GetMax().x / m_broadphaseCellSize), Math::FloorToInt(bounds.GetMax().y / m_broadphaseCellSize) };
+		m_sensorCellRanges[sensorIdx] = Box2i::FromCorners(minCell, maxCell); //< Inclusive cell range
+		if(bIsStatic) {
+			continue;
+		}
+		for(auto y = minCell.y; y <= maxCell.y; ++y) {
+			for(auto x = minCell.x; x <= maxCell.x; ++x) {
+				m_broadphaseEntries.push_back({ ToCellKey(x, y), sensorIdx });
+			}
+		}
+	}
+	SortEntries(m_broadphaseEntries);
+
+	// Rebuild the static partition only when it's changed
+	if(m_bStaticPartitionDirty) {
+		m_bStaticPartitionDirty = false;
+		m_staticBroadphaseEntries.clear();
+		for(int32_t sensorIdx = 0; sensorIdx < (int32_t)m_sensors.size(); ++sensorIdx) {
+			if(m_sensorKinds[sensorIdx] != eBroadphaseKind::Static) {
+				continue;
+			}
+			const auto& range = m_sensorCellRanges[sensorIdx];
+			for(auto y = range.GetBottom(); y <= range.GetTop(); ++y) {
+				for(auto x = range.GetLeft(); x <= range.GetRight(); ++x) {
+					m_staticBroadphaseEntries.push_back({ ToCellKey(x, y), sensorIdx });
+				}
+			}
+		}
+		SortEntries(m_staticBroadphaseEntries);
+	}
+
+	// Emit each filtered pair once, from the lowest cell the two sensors share
+	m_broadphasePairs.clear();
+	const auto TryAddPair = [this, &ToCellKey](int32_t in_idxA, int32_t in_idxB, uint64_t in_cellKey) {
+		const auto& rangeA = m_sensorCellRanges[in_idxA];
+		const auto& rangeB = m_sensorCellRanges[in_idxB];
+		if(ToCellKey(Math::Max(rangeA.x, rangeB.x), Math::Max(rangeA.y, rangeB.y)) != in_cellKey) {
+			return; //< Emitted from a lower shared cell
+		}
+		if(!m_sensors[in_idxA]->CanTouch(m_sensors[in_idxB])) {
+			return;
+		}
+		m_broadphasePairs.push_back({ Math::Min(in_idxA, in_idxB), Math::Max(in_idxA, in_idxB) });
+	};
+	size_t runStart = 0;
+	while(runStart < m_broadphaseEntries.size()) {
+		size_t runEnd = runStart + 1;
+		while(runEnd < m_broadphaseEntries.size() && m_broadphaseEntries[runEnd].cellKey == m_broadphaseEntries[runStart].cellKey) {
+			++runEnd;
+		}
+		const auto cellKey = m_broadphaseEntries[runStart].cellKey;
+
+		// Dynamic vs dynamic
+		for(size_t a = runStart; a < runEnd; ++a) {
+			for(size_t b = a + 1; b < runEnd; ++b) {
+				TryAddPair(m_broadphaseEntries[a].sensorIdx, m_broadphaseEntries[b].sensorIdx, cellKey);
+			}
+		}
+
+		// Dynamic vs static (static vs static pairs are never tested)
+		const auto staticRun = std::equal_range(m_staticBroadphaseEntries.begin(), m_staticBroadphaseEntries.end(), BroadphaseEntry{ cellKey, 0 }, 
+			[](const BroadphaseEntry& in_a, const BroadphaseEntry& in_b) {
+				return in_a.cellKey < in_b.cellKey;
+			});
+		for(auto staticIt = staticRun.first; staticIt != staticRun.second; ++staticIt) {
+			for(size_t a = runStart; a < runEnd; ++a) {
+				TryAddPair(m_broadphaseEntries[a].sensorIdx, staticIt->sensorIdx, cellKey);
+			}
+		}
+		runStart = runEnd;
+	}
+
+	// Keep the same pair order as a full pairwise sweep over m_sensors, so callback order is unchanged
+	std::sort(m_broadphasePairs.begin(), m_broadphasePairs.end());
 }
-void SensorManager::RegisterSensor(std::shared_ptr<SensorComponent> in_comp) {
-	m_sensors.push_back(in_comp);
+
+//--- TOUCH PAIR TABLE ---//
+
+uint32_t& SensorManager::TouchPairTable::FindOrInsert(const SensorComponent* in_a, const SensorComponent* in_b, bool& in_bOutInserted) {
+	OrderKey(in_a, in_b);
+	if((m_count + 1) * 4 > m_entries.size() * 3) {
+		Grow(); //< Keep the load factor under 3/4
+	}
+	const size_t slot = FindSlot(in_a, in_b);
+	auto& entry = m_entries[slot];
+	in_bOutInserted = (entry.a == nullptr);
+	if(in_bOutInserted) {
+		entry = { in_a, in_b, 0 };
+		++m_count;
+	}
+	return entry.stamp;
+}
+uint32_t* SensorManager::TouchPairTable::Find(const SensorComponent* in_a, const SensorComponent* in_b) {
+	if(m_count == 0) {
+		return nullptr;
+	}
+	OrderKey(in_a, in_b);
+	auto& entry = m_entries[FindSlot(in_a, in_b)];
+	return entry.a ? &entry.stamp : nullptr;
+}
+void SensorManager::TouchPairTable::Erase(const SensorComponent* in_a, const SensorComponent* in_b) {
+	if(m_count == 0) {
+		return;
+	}
+	OrderKey(in_a, in_b);
+	size_t hole = FindSlot(in_a, in_b);
+	if(!m_entries[hole].a) {
+		return;
+	}
+
+	// Backward-shift deletion: pull later entries of the probe run into the hole so lookups never need tombstones
+	const size_t mask = m_entries.size() - 1;
+	size_t slot = hole;
+	while(true) {
+		slot = (slot + 1) & mask;
+		const auto& entry = m_entries[slot];
+		if(!entry.a) {
+			break;
+		}
+		const size_t home = GetHomeSlot(entry.a, entry.b);
+		if(((slot - home) & mask) >= ((slot - hole) & mask)) {
+			m_entries[hole] = entry;
+			hole = slot;
+		}
+	}
+	m_entries[hole] = {};
+	--m_count;
+}
+void SensorManager::TouchPairTable::OrderKey(const SensorComponent*& in_a, const SensorComponent*& in_b) {
+	if(std::less<const SensorComponent*>()(in_b, in_a)) {
+		std::swap(in_a, in_b);
+	}
+}
+size_t SensorManager::TouchPairTable::GetHomeSlot(const SensorComponent* in_a, const SensorComponent* in_b) const {
+	uint64_t hash = (uint64_t)(uintptr_t)in_a * 0x9E3779B97F4A7C15ull;
+	hash ^= (uint64_t)(uintptr_t)in_b + 0x7F4A7C159E3779B9ull + (hash << 6) + (hash >> 2);
+	hash ^= hash >> 29;
+	return (size_t)hash & (m_entries.size() - 1);
+}
+size_t SensorManager::TouchPairTable::FindSlot(const SensorComponent* in_a, const SensorComponent* in_b) const {
+	const size_t mask = m_entries.size() - 1;
+	size_t slot = GetHomeSlot(in_a, in_b);
+	while(m_entries[slot].a && (m_entries[slot].a != in_a || m_entries[slot].b != in_b)) {
+		slot = (slot + 1) & mask;
+	}
+	return slot;
+}
+void SensorManager::TouchPairTable::Grow() {
+	auto oldEntries = std::move(m_entries);
+	m_entries.assign(oldEntries.empty() ? 64 : oldEntries.size() * 2, Entry{});
+	for(const auto& entry : oldEntries) {
+		if(entry.a) {
+			m_entries[FindSlot(entry.a, entry.b)] = entry;
+		}
+	}
 }
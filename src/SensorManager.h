@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Engine/Actor.h"
+#include "Engine/Box.h"
 #include <vector>
 #include <memory>
 
@@ -11,14 +12,77 @@ class SensorComponent;
 class SensorManager : public Actor
 {
 public:
-	virtual void Initialize() override;
-	virtual void Destroy() override;
-	void Update();
+	void Update(); //< Called from GameWorld's physics callback
 	void RegisterSensor(std::shared_ptr<SensorComponent> in_comp);
 
+	// Drops every touch involving the sensor (dispatching their untouch callbacks), so its next overlap is reported as a new touch 
+	// even if its filtering is switched off and back on between updates (eg a pooled projectile being parked and reused)
+	void ForgetTouches(const std::shared_ptr<SensorComponent>& in_sensor);
+
+	// Broadphase grid cell size (in world units) -- sensors only get narrowphase-tested against sensors sharing a cell
+	void SetBroadphaseCellSize(float in_cellSize);
+	float GetBroadphaseCellSize() const { return m_broadphaseCellSize; }
+
+	// Sensors whose bounds haven't changed for this many frames are treated as static (like sensors flagged with SetStatic), 
+	// so they're kept in a prebuilt partition that only moving sensors query, and static-vs-static pairs are skipped
+	void SetAutoStaticFrameCount(int32_t in_frameCount) { m_autoStaticFrameCount = in_frameCount; }
+	int32_t GetAutoStaticFrameCount() const { return m_autoStaticFrameCount; }
+
 private:
 	using tTouch = std::pair<std::shared_ptr<SensorComponent>, std::shared_ptr<SensorComponent>>;
 	using tTouches = std::vector<tTouch>;
+	using tSensorPair = std::pair<int32_t, int32_t>; //< Indices into m_sensors (first < second)
+
+	// Spatial hash broadphase
+	struct BroadphaseEntry {
+		uint64_t cellKey;
+		int32_t sensorIdx;
+	};
+	enum class eBroadphaseKind : uint8_t {
+		None, //< Shapeless (never touches anything)
+		Dynamic,
+		Static,
+	};
+	void BuildBroadphasePairs();
+	void DispatchUntouches(const tTouches& in_untouches);
+
+	// Open-addressing hash set of touching sensor pairs (keyed by the two sensor addresses, in address order) that persists across frames.
+	// Each entry is stamped with the generation (physics frame) in which the narrowphase last saw the pair touching.
+	class TouchPairTable
+	{
+	public:
+		// Returns the pair's entry, inserting it (with a zero stamp) if it isn't present -- in_bOutInserted reports which happened
+		uint32_t& FindOrInsert(const SensorComponent* in_a, const SensorComponent* in_b, bool& in_bOutInserted);
+		uint32_t* Find(const SensorComponent* in_a, const SensorComponent* in_b);
+		void Erase(const SensorComponent* in_a, const SensorComponent* in_b);
+
+	private:
+		struct Entry {
+			const SensorComponent* a = nullptr; //< nullptr marks an empty slot
+			const SensorComponent* b = nullptr;
+			uint32_t stamp = 0;
+		};
+		static void OrderKey(const SensorComponent*& in_a, const SensorComponent*& in_b);
+		size_t GetHomeSlot(const SensorComponent* in_a, const SensorComponent* in_b) const;
+		size_t FindSlot(const SensorComponent* in_a, const SensorComponent* in_b) const; //< Slot holding the key, or the empty slot ending its probe run
+		void Grow();
+
+		std::vector<Entry> m_entries;
+		size_t m_count = 0;
+	};
+
 	tTouches m_currentTouches;
+	TouchPairTable m_touchPairs; //< Every pair in m_currentTouches (plus the new touches being gathered this frame)
+	uint32_t m_touchGeneration = 0;
+	bool m_bDispatchingTouches = false;
+	std::vector<std::shared_ptr<SensorComponent>> m_deferredForgets; //< ForgetTouches() calls made by callbacks during Update
 	std::vector<std::shared_ptr<SensorComponent>> m_sensors;
-};
\ No newline at end of file
+	float m_broadphaseCellSize = 64.0f;
+	std::vector<Box2i> m_sensorCellRanges; //< Per-sensor range of covered cells, indexed like m_sensors
+	std::vector<eBroadphaseKind> m_sensorKinds; //< Indexed like m_sensors
+	std::vector<BroadphaseEntry> m_broadphaseEntries; //< Dynamic sensors only, rebuilt every frame
+	std::vector<BroadphaseEntry> m_staticBroadphaseEntries; //< Rebuilt only when the static set (or a static sensor's bounds) changes
+	bool m_bStaticPartitionDirty = true;
+	int32_t m_autoStaticFrameCount = 30;
+	std::vector<tSensorPair> m_broadphasePairs;
+};
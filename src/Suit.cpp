@@ -13,12 +13,12 @@ void Suit::Initialize() {
 	// Setup sprites
 	SetDrawLayer(0);
 	m_sprite = MakeSprite();
-	m_sprite->SetRenderLayer("bkgTiles");
+	m_sprite->SetRenderLayer(RL_BkgTiles);
 	m_sprite->PlayAnim("GariSuitEntry/Idle", true);
 
 	// Foreground sprite enables "sandwiching" player between two sprites to create illusion of falling "into" the suit
 	m_fgSprite = MakeSprite();
-	m_fgSprite->SetRenderLayer("fgGameplay");
+	m_fgSprite->SetRenderLayer(RL_FgGameplay);
 	m_fgSprite->PlayAnim("GariSuitEntry/Idle", true); //< TODO: Needs a custom anim here, tho. Still looks good without it!
 	m_fgSprite->SetComponentDrawOrder(10);
 
@@ -19,7 +19,7 @@ void TitleChar::Initialize() {
 
 	m_sprite = MakeSprite();
 	m_sprite->SetRelativePos(m_spawnOffset);
-	m_sprite->SetRenderLayer("hud");
+	m_sprite->SetRenderLayer(RL_Hud);
 	m_sprite->SetComponentDrawOrder(m_drawOrder);
 	m_spriteShadow = MakeSprite();
 	if(m_singleFrame) {
@@ -30,7 +30,7 @@ void TitleChar::Initialize() {
 	auto shadowAnimName = m_animName + "Shadow";
 	m_spriteShadow->PlayAnim(shadowAnimName, true, m_startFrame);
 	m_spriteShadow->SetRelativePos(m_spawnOffset + m_shadowOffset);
-	m_spriteShadow->SetRenderLayer("hud");
+	m_spriteShadow->SetRenderLayer(RL_Hud);
 	m_spriteShadow->SetComponentDrawOrder(m_drawOrder - 25);
 	m_direction = (-m_spawnOffset.Norm());
 }
@@ -30,6 +30,7 @@ void Trigger::Initialize() {
 	playerSensorShape.SetBox({ m_triggerBox.GetDims() });
 	auto playerSensor = MakeSensor(Transform::Identity, playerSensorShape);
 	playerSensor->SetFiltering(CL_Trigger, CL_Player);
+	playerSensor->SetStatic(true);
 	playerSensor->SetTouchCallback([this](bool in_beginning, std::shared_ptr<SensorComponent> in_other) {
 		if(in_beginning) {
 			if(std::dynamic_pointer_cast<Player>(in_other->GetActor())) {
@@ -0,0 +1,188 @@
+#include "TestFramework.h"
+
+#include "GameActor.h"
+#include "Player.h"
+#include "Door.h"
+#include "Effect.h"
+#include "Lava.h"
+#include "Trigger.h"
+#include "Creature.h"
+#include "CreatureSpawner.h"
+#include "Projectile.h"
+#include "Projectiles/Grenade.h"
+#include "Projectiles/HomingMissile.h"
+#include "Projectiles/WaveBeam.h"
+#include "Creatures/Blobber.h"
+#include "Creatures/Charger.h"
+#include "Creatures/Crawler.h"
+#include "Creatures/Cruiser.h"
+#include "Creatures/Dropper.h"
+#include "Creatures/Laser.h"
+#include "Creatures/Monopod.h"
+#include "Creatures/Piper.h"
+#include "Creatures/Pirate.h"
+#include "Creatures/Rammer.h"
+#include "Creatures/Sentry.h"
+#include "Creatures/Ship.h"
+#include "Creatures/Swooper.h"
+#include "Creatures/Turret.h"
+#include "Engine/Components/SensorComponent.h"
+
+#include <string>
+#include <vector>
+
+// Only constructs the actors (none of them are initialized or spawned into a world), which is all the type tag depends on
+
+namespace
+{
+	struct NamedActor
+	{
+		std::shared_ptr<GameActor> m_actor;
+		eGameActorType m_expectedType;
+	};
+
+	// Every GameActor subclass the projectiles can touch, plus a few of the untagged ones
+	std::vector<NamedActor> MakeActors()
+	{
+		auto spawner = std::make_shared<CreatureSpawner>(nullptr, false, 0.0f, "");
+		const ProjectileDef projectileDef;
+		return {
+			{ std::make_shared<Player>(), eGameActorType::Player },
+			{ std::make_shared<Door>(eDoorColor::Blue, 0, true), eGameActorType::Door },
+			{ std::make_shared<Projectile>(projectileDef, Vec2f{ 1.0f, 0.0f }), eGameActorType::Projectile },
+			{ std::make_shared<Grenade>(projectileDef, Vec2f{ 1.0f, 0.0f }), eGameActorType::Projectile },
+			{ std::make_shared<HomingMissile>(projectileDef, Vec2f{ 1.0f, 0.0f }), eGameActorType::Projectile },
+			{ std::make_shared<WaveBeam>(projectileDef, Vec2f{ 1.0f, 0.0f }), eGameActorType::Projectile },
+			{ std::make_shared<Blobber>(spawner, false, 0.0f, ""), eGameActorType::Creature },
+			{ std::make_shared<Charger>(spawner, false, 0.0f, ""), eGameActorType::Creature },
+			{ std::make_shared<Crawler>(spawner, false, 0.0f, ""), eGameActorType::Creature },
+			{ std::make_shared<Cruiser>(spawner, false, 0.0f, ""), eGameActorType::Creature },
+			{ std::make_shared<Dropper>(spawner, false, 0.0f, ""), eGameActorType::Creature },
+			{ std::make_shared<Laser>(spawner, false, 0.0f, ""), eGameActorType::Creature },
+			{ std::make_shared<Monopod>(spawner, false, 0.0f, ""), eGameActorType::Creature },
+			{ std::make_shared<Piper>(spawner, false, 0.0f, ""), eGameActorType::Creature },
+			{ std::make_shared<Pirate>(spawner, false, 0.0f, ""), eGameActorType::Creature },
+			{ std::make_shared<Rammer>(spawner, false, 0.0f, ""), eGameActorType::Creature },
+			{ std::make_shared<Sentry>(spawner, false, 0.0f, ""), eGameActorType::Creature },
+			{ std::make_shared<Ship>(spawner, false, 0.0f, ""), eGameActorType::Creature },
+			{ std::make_shared<Swooper>(spawner, false, 0.0f, ""), eGameActorType::Creature },
+			{ std::make_shared<Turret>(spawner, false, 0.0f, ""), eGameActorType::Creature },
+			{ std::make_shared<TurretStill>(spawner, false, 0.0f, ""), eGameActorType::Creature },
+			{ std::make_shared<GameActor>(), eGameActorType::Other },
+			{ spawner, eGameActorType::Other },
+			{ std::make_shared<Effect>("Util/Blank"), eGameActorType::Other },
+			{ std::make_shared<Lava>(Box2f::FromCenter(Vec2f::Zero, { 16.0f, 16.0f })), eGameActorType::Other },
+			{ std::make_shared<Trigger>(eTriggerTarget::None, Box2f::FromCenter(Vec2f::Zero, { 16.0f, 16.0f }), 0), eGameActorType::Other },
+		};
+	}
+
+	// The handlers the old touch callbacks reached, found with the dynamic casts they used
+	std::vector<std::string> GetOldHandlers(const std::shared_ptr<GameActor>& in_actor, bool in_bTouchesProjectiles)
+	{
+		std::vector<std::string> handlers;
+		if(std::dynamic_pointer_cast<Creature>(in_actor))
+		{
+			handlers.push_back("Creature");
+		}
+		if(std::dynamic_pointer_cast<Player>(in_actor))
+		{
+			handlers.push_back("Player");
+		}
+		if(in_bTouchesProjectiles && std::dynamic_pointer_cast<Projectile>(in_actor))
+		{
+			handlers.push_back("Projectile");
+		}
+		if(std::dynamic_pointer_cast<Door>(in_actor))
+		{
+			handlers.push_back("Door");
+		}
+		return handlers;
+	}
+
+	// Logs which OnTouch*() handlers the dispatch calls (and with what), instead of running them
+	class TouchProbe : public Projectile
+	{
+	public:
+		using Projectile::Projectile;
+		using Projectile::OnTouchSensor;
+
+		std::vector<std::string> m_handlers;
+		std::shared_ptr<GameActor> m_lastActor;
+		std::shared_ptr<SensorComponent> m_lastSensor;
+
+	protected:
+		virtual void OnTouchCreature(std::shared_ptr<Creature> in_creature, std::shared_ptr<SensorComponent> in_sensor) override
+		{
+			Log("Creature", in_creature, in_sensor);
+		}
+		virtual void OnTouchPlayer(std::shared_ptr<Player> in_player, std::shared_ptr<SensorComponent> in_sensor) override
+		{
+			Log("Player", in_player, in_sensor);
+		}
+		virtual void OnTouchDoor(std::shared_ptr<Door> in_door, std::shared_ptr<SensorComponent> in_sensor) override
+		{
+			Log("Door", in_door, in_sensor);
+		}
+		virtual void OnTouchProjectile(std::shared_ptr<Projectile> in_projectile, std::shared_ptr<SensorComponent> in_sensor) override
+		{
+			Log("Projectile", in_projectile, in_sensor);
+		}
+
+	private:
+		void Log(const char* in_handler, std::shared_ptr<GameActor> in_actor, std::shared_ptr<SensorComponent> in_sensor)
+		{
+			m_handlers.push_back(in_handler);
+			m_lastActor = in_actor;
+			m_lastSensor = in_sensor;
+		}
+	};
+}
+
+TEST_CASE("ActorType: every actor subclass reports its tag, and the tag agrees with its class")
+{
+	for(const auto& namedActor : MakeActors())
+	{
+		const auto& actor = namedActor.m_actor;
+		REQUIRE(actor != nullptr);
+		CHECK(actor->GetActorType() == namedActor.m_expectedType);
+
+		// Tagged actors are exactly the ones the old dynamic casts picked out
+		CHECK((std::dynamic_pointer_cast<Creature>(actor) != nullptr) == (actor->GetActorType() == eGameActorType::Creature));
+		CHECK((std::dynamic_pointer_cast<Player>(actor) != nullptr) == (actor->GetActorType() == eGameActorType::Player));
+		CHECK((std::dynamic_pointer_cast<Projectile>(actor) != nullptr) == (actor->GetActorType() == eGameActorType::Projectile));
+		CHECK((std::dynamic_pointer_cast<Door>(actor) != nullptr) == (actor->GetActorType() == eGameActorType::Door));
+	}
+}
+
+TEST_CASE("ActorType: projectile touches reach the same handler as the old dynamic-cast dispatch")
+{
+	auto probe = std::make_shared<TouchProbe>(ProjectileDef{}, Vec2f{ 1.0f, 0.0f });
+	for(const auto& namedActor : MakeActors())
+	{
+		auto sensor = std::make_shared<SensorComponent>();
+		sensor->SetActor(namedActor.m_actor);
+
+		// Both the projectile's own sensor (which also touches other projectiles) and its AoE sensor (which doesn't)
+		for(const bool bTouchesProjectiles : { true, false })
+		{
+			probe->m_handlers.clear();
+			probe->m_lastActor = nullptr;
+			probe->m_lastSensor = nullptr;
+			probe->OnTouchSensor(sensor, bTouchesProjectiles);
+
+			const auto oldHandlers = GetOldHandlers(namedActor.m_actor, bTouchesProjectiles);
+			CHECK(probe->m_handlers == oldHandlers);
+			if(!oldHandlers.empty())
+			{
+				CHECK(probe->m_lastActor == namedActor.m_actor); //< The static cast hands over the same object
+				CHECK(probe->m_lastSensor == sensor);
+			}
+		}
+	}
+
+	// Sensors whose actor has gone away are ignored
+	auto orphanSensor = std::make_shared<SensorComponent>();
+	probe->m_handlers.clear();
+	probe->OnTouchSensor(orphanSensor, true);
+	CHECK(probe->m_handlers.empty());
+}
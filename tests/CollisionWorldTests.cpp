@@ -0,0 +1,394 @@
+#include "TestFramework.h"
+
+#include "GameEnums.h"
+#include "Engine/Actor.h"
+#include "Engine/AABBTree.h"
+#include "Engine/CollisionWorld.h"
+#include "Engine/GridBitset.h"
+#include "Engine/Components/ColliderComponent.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+	std::shared_ptr<ColliderComponent_Box> MakeBoxCollider(const std::shared_ptr<Actor>& in_actor, const std::shared_ptr<CollisionWorld>& in_world,
+		Box2f in_box, uint32_t in_category)
+	{
+		auto collider = Object::MakeWithInit<ColliderComponent_Box>(in_actor, [&in_actor](const std::shared_ptr<ColliderComponent_Box>& in_comp) {
+			in_comp->SetActor(in_actor);
+		}, in_world, in_box);
+		collider->SetCategory(in_category);
+		return collider;
+	}
+
+	// A tile grid collider that owns its solid cells (ColliderComponent_TilesComponent needs a tile set loaded to size its cells)
+	class GridCollider : public ColliderComponent
+	{
+	public:
+		GridCollider(std::shared_ptr<CollisionWorld> in_world, Transform in_gridToWorld, GridBitset in_solidCells)
+			: ColliderComponent(in_world)
+			, m_gridToWorld(in_gridToWorld)
+			, m_solidCells(std::move(in_solidCells))
+		{
+		}
+
+		virtual Box2f GetBoundingBoxLocal() const override { return Box2f(m_solidCells.GetGridBox()).TransformedBy(m_gridToWorld); }
+		virtual std::optional<Math::BoxSweepResults> SweepBoxAgainstThis(Box2f in_boxToSweep, Vec2f in_sweepVec) const override
+		{
+			return Math::SweepBoxAgainstGrid(in_boxToSweep, in_sweepVec, m_gridToWorld, m_solidCells);
+		}
+
+	private:
+		Transform m_gridToWorld;
+		GridBitset m_solidCells;
+	};
+
+	// What SweepBox() did before the broadphase tree: sweep every collider and keep the nearest hit
+	// (in_outNumNearest is how many colliders tied for it -- the tree may pick a different one of those)
+	template<typename tColliderPtr>
+	std::optional<Math::BoxSweepResults> LinearSweepBox(const std::vector<tColliderPtr>& in_colliders, Box2f in_box,
+		Vec2f in_sweepVec, uint32_t in_mask, int32_t& out_numNearest)
+	{
+		std::optional<Math::BoxSweepResults> firstHit;
+		out_numNearest = 0;
+		for(const auto& collider : in_colliders)
+		{
+			if(!(collider->GetCategory() & in_mask))
+			{
+				continue;
+			}
+			const auto res = collider->SweepBoxAgainstThis(in_box, in_sweepVec);
+			if(res && (!firstHit || res->m_dist < firstHit->m_dist))
+			{
+				firstHit = res;
+				out_numNearest = 1;
+			}
+			else if(res && res->m_dist == firstHit->m_dist)
+			{
+				++out_numNearest;
+			}
+		}
+		return firstHit;
+	}
+
+	// Random static boxes scattered over in_areaSize x in_areaSize (snapped to whole pixels, so some edges line up)
+	std::vector<std::shared_ptr<ColliderComponent_Box>> MakeRandomBoxColliders(const std::shared_ptr<Actor>& in_actor,
+		const std::shared_ptr<CollisionWorld>& in_world, int32_t in_numColliders, float in_areaSize, std::mt19937& in_rng)
+	{
+		std::uniform_real_distribution<float> posDist(0.0f, in_areaSize);
+		std::uniform_real_distribution<float> sizeDist(4.0f, 64.0f);
+		std::uniform_int_distribution<int32_t> categoryDist(0, 2);
+		const uint32_t categories[] = { CL_World, CL_Enemy, CL_Door };
+		std::vector<std::shared_ptr<ColliderComponent_Box>> colliders;
+		for(int32_t i = 0; i < in_numColliders; ++i)
+		{
+			const Vec2f center = { std::round(posDist(in_rng)), std::round(posDist(in_rng)) };
+			const Vec2f dims = { std::round(sizeDist(in_rng)), std::round(sizeDist(in_rng)) };
+			colliders.push_back(MakeBoxCollider(in_actor, in_world, Box2f::FromCenter(center, dims), categories[categoryDist(in_rng)]));
+		}
+		return colliders;
+	}
+}
+
+TEST_CASE("CollisionWorld: colliders outside the query mask are never swept")
+{
+	auto owner = Object::MakeRoot();
+	auto actor = std::make_shared<Actor>();
+	actor->SetOwner(owner);
+	auto world = std::make_shared<CollisionWorld>();
+
+	// A wall of world tiles behind a frozen creature, both in the path of a sweep to the right
+	auto wall = MakeBoxCollider(actor, world, Box2f::FromCenter({ 100.0f, 0.0f }, { 16.0f, 64.0f }), CL_World);
+	auto frozenCreature = MakeBoxCollider(actor, world, Box2f::FromCenter({ 50.0f, 0.0f }, { 16.0f, 16.0f }), CL_Enemy);
+	const Box2f box = Box2f::FromCenter({ 0.0f, 0.0f }, { 8.0f, 8.0f });
+	const Vec2f sweepVec = { 200.0f, 0.0f };
+
+	// Unmasked sweeps test both colliders and stop at the nearer one
+	int32_t sweepCount = world->GetColliderSweepCount();
+	auto hit = world->SweepBox(box, sweepVec);
+	CHECK(world->GetColliderSweepCount() - sweepCount == 2);
+	REQUIRE(hit.has_value());
+	CHECK(std::abs(hit->m_sweptBox.GetRight() - 42.0f) < 0.01f);
+
+	// Masking out CL_Enemy skips the creature without sweeping it
+	sweepCount = world->GetColliderSweepCount();
+	hit = world->SweepBox(box, sweepVec, CL_World);
+	CHECK(world->GetColliderSweepCount() - sweepCount == 1);
+	REQUIRE(hit.has_value());
+	CHECK(std::abs(hit->m_sweptBox.GetRight() - 92.0f) < 0.01f);
+
+	// Masking out both hits nothing, and sweeps nothing
+	sweepCount = world->GetColliderSweepCount();
+	hit = world->SweepBox(box, sweepVec, CL_Pickup);
+	CHECK(world->GetColliderSweepCount() == sweepCount);
+	CHECK(!hit.has_value());
+
+	// Cardinal probes filter the same way (only the creature is in range of the probes)
+	const Box2f probeBox = Box2f::FromCenter({ 36.0f, 0.0f }, { 8.0f, 8.0f });
+	sweepCount = world->GetColliderSweepCount();
+	auto probeResults = world->ProbeCardinal(probeBox, 10.0f, CL_World | CL_Enemy);
+	CHECK(world->GetColliderSweepCount() > sweepCount);
+	CHECK(probeResults.m_right.has_value());
+
+	sweepCount = world->GetColliderSweepCount();
+	probeResults = world->ProbeCardinal(probeBox, 10.0f, CL_World);
+	CHECK(world->GetColliderSweepCount() == sweepCount);
+	CHECK(!probeResults.m_right.has_value());
+
+	// Changing a collider's category takes effect on the next query
+	frozenCreature->SetCategory(CL_World);
+	hit = world->SweepBox(box, sweepVec, CL_World);
+	REQUIRE(hit.has_value());
+	CHECK(std::abs(hit->m_sweptBox.GetRight() - 42.0f) < 0.01f);
+}
+
+TEST_CASE("CollisionWorld: tree sweeps find the same hits as sweeping every collider")
+{
+	std::mt19937 rng(2);
+	auto owner = Object::MakeRoot();
+	auto actor = std::make_shared<Actor>();
+	actor->SetOwner(owner);
+	auto world = std::make_shared<CollisionWorld>();
+	auto colliders = MakeRandomBoxColliders(actor, world, 400, 2000.0f, rng);
+
+	// Move some colliders (both within and past their fat boxes) and remove others, so the tree has been updated as well as built
+	std::uniform_real_distribution<float> nudgeDist(-3.0f, 3.0f);
+	std::uniform_real_distribution<float> jumpDist(-400.0f, 400.0f);
+	for(size_t collIdx = 0; collIdx < colliders.size(); collIdx += 3)
+	{
+		colliders[collIdx]->SetWorldPos((collIdx % 2) ? Vec2f{ nudgeDist(rng), nudgeDist(rng) } : Vec2f{ jumpDist(rng), jumpDist(rng) });
+	}
+	for(size_t collIdx = 0; collIdx < colliders.size(); collIdx += 7)
+	{
+		colliders[collIdx]->Destroy();
+	}
+	colliders.erase(std::remove_if(colliders.begin(), colliders.end(), [](const auto& in_coll) {
+		return in_coll->IsDestroyed();
+	}), colliders.end());
+
+	std::uniform_real_distribution<float> posDist(-100.0f, 2100.0f);
+	std::uniform_real_distribution<float> sizeDist(2.0f, 40.0f);
+	std::uniform_real_distribution<float> sweepDist(-300.0f, 300.0f);
+	const uint32_t masks[] = { CollisionWorld::AllCategories, CL_World, CL_World | CL_Enemy, CL_Pickup };
+	int32_t numHits = 0;
+	int32_t numTies = 0;
+	for(int32_t i = 0; i < 4000; ++i)
+	{
+		const Box2f box = Box2f::FromCenter({ posDist(rng), posDist(rng) }, { sizeDist(rng), sizeDist(rng) });
+		Vec2f sweepVec = { sweepDist(rng), sweepDist(rng) };
+		if(i % 3 == 0)
+		{
+			(i % 2 ? sweepVec.x : sweepVec.y) = 0.0f; //< Axis-aligned, like character movement
+		}
+		const uint32_t mask = masks[i % 4];
+
+		int32_t numNearest = 0;
+		const auto linearHit = LinearSweepBox(colliders, box, sweepVec, mask, numNearest);
+		const auto treeHit = world->SweepBox(box, sweepVec, mask);
+		REQUIRE(treeHit.has_value() == linearHit.has_value());
+		if(!treeHit)
+		{
+			continue;
+		}
+		++numHits;
+		CHECK(treeHit->m_dist == linearHit->m_dist);
+		CHECK(treeHit->m_sweptBox.GetMin() == linearHit->m_sweptBox.GetMin());
+		if(numNearest == 1)
+		{
+			CHECK(treeHit->m_normal == linearHit->m_normal);
+		}
+		else
+		{
+			++numTies;
+		}
+	}
+	CHECK(numHits > 500);
+	CHECK(numTies > 0); //< Ties do come up (and only the hit distance is guaranteed to match for them)
+}
+
+BENCHMARK_CASE("CollisionWorld: sweeps against 1k and 10k static colliders")
+{
+	for(const int32_t numColliders : { 1000, 10000 })
+	{
+		std::mt19937 rng(20);
+		auto owner = Object::MakeRoot();
+		auto actor = std::make_shared<Actor>();
+		actor->SetOwner(owner);
+		auto world = std::make_shared<CollisionWorld>();
+		const float areaSize = 64.0f * std::sqrt((float)numColliders); //< The same density for both counts
+		auto colliders = MakeRandomBoxColliders(actor, world, numColliders, areaSize, rng);
+
+		// Character-sized boxes moving a few pixels, like a frame's worth of movement
+		std::uniform_real_distribution<float> posDist(0.0f, areaSize);
+		std::uniform_real_distribution<float> sweepDist(-8.0f, 8.0f);
+		std::vector<std::pair<Box2f, Vec2f>> sweeps;
+		for(int32_t i = 0; i < 1000; ++i)
+		{
+			sweeps.push_back({ Box2f::FromCenter({ posDist(rng), posDist(rng) }, { 16.0f, 24.0f }), { sweepDist(rng), sweepDist(rng) } });
+		}
+
+		int32_t numTreeHits = 0;
+		int32_t numLinearHits = 0;
+		const std::string label = std::to_string(numColliders) + " colliders, 1000 sweeps";
+		Test::Measure((label + ", tree").c_str(), 20, [&]() {
+			numTreeHits = 0;
+			for(const auto& sweep : sweeps)
+			{
+				numTreeHits += world->SweepBox(sweep.first, sweep.second).has_value() ? 1 : 0;
+			}
+		});
+		Test::Measure((label + ", linear").c_str(), 2, [&]() {
+			numLinearHits = 0;
+			int32_t numNearest = 0;
+			for(const auto& sweep : sweeps)
+			{
+				numLinearHits += LinearSweepBox(colliders, sweep.first, sweep.second, CollisionWorld::AllCategories, numNearest).has_value() ? 1 : 0;
+			}
+		});
+		CHECK(numTreeHits == numLinearHits);
+		owner->Destroy();
+	}
+}
+
+TEST_CASE("CollisionWorld: cardinal probes find the same hits as four separate sweeps")
+{
+	std::mt19937 rng(5);
+	auto owner = Object::MakeRoot();
+	auto actor = std::make_shared<Actor>();
+	actor->SetOwner(owner);
+	auto world = std::make_shared<CollisionWorld>();
+	std::vector<std::shared_ptr<ColliderComponent>> colliders;
+
+	// Boxes snapped to an 8px grid, so several colliders often sit the same distance from a probe
+	std::uniform_int_distribution<int32_t> cellDist(0, 100);
+	std::uniform_int_distribution<int32_t> sizeDist(1, 6);
+	const uint32_t categories[] = { CL_World, CL_Enemy, CL_Door };
+	for(int32_t i = 0; i < 300; ++i)
+	{
+		const Vec2f min = { 8.0f * cellDist(rng), 8.0f * cellDist(rng) };
+		const Vec2f dims = { 8.0f * sizeDist(rng), 8.0f * sizeDist(rng) };
+		colliders.push_back(MakeBoxCollider(actor, world, Box2f::FromCorners(min, min + dims), categories[i % 3]));
+	}
+
+	// A few overlapping tile grids with random layouts, aligned with the boxes
+	std::uniform_int_distribution<int32_t> percentDist(0, 99);
+	for(int32_t gridIdx = 0; gridIdx < 4; ++gridIdx)
+	{
+		GridBitset solidCells;
+		solidCells.Reset({ 0, -30, 30, 30 });
+		for(int32_t y = -30; y < 0; ++y)
+		{
+			for(int32_t x = 0; x < 30; ++x)
+			{
+				solidCells.Set({ x, y }, percentDist(rng) < 10 + 10 * gridIdx);
+			}
+		}
+		Transform gridToWorld = Transform::Identity;
+		gridToWorld.pos = { 8.0f * cellDist(rng), 8.0f * cellDist(rng) + 240.0f };
+		gridToWorld.scale = { 8.0f, 8.0f };
+		auto gridCollider = Object::MakeWithInit<GridCollider>(actor, [&actor](const std::shared_ptr<GridCollider>& in_comp) {
+			in_comp->SetActor(actor);
+		}, world, gridToWorld, std::move(solidCells));
+		gridCollider->SetCategory(CL_World);
+		colliders.push_back(gridCollider);
+	}
+
+	std::uniform_real_distribution<float> posDist(-40.0f, 1100.0f);
+	std::uniform_int_distribution<int32_t> probeSizeDist(1, 4);
+	std::uniform_real_distribution<float> probeDistDist(0.5f, 64.0f);
+	const uint32_t masks[] = { CollisionWorld::AllCategories, CL_World, CL_World | CL_Enemy, CL_Pickup };
+	int32_t numHits = 0;
+	int32_t numTies = 0;
+	for(int32_t i = 0; i < 3000; ++i)
+	{
+		// Half the probes start on the 8px grid too (and probe whole cells), like characters standing on the ground
+		Vec2f center = { posDist(rng), posDist(rng) };
+		float dist = probeDistDist(rng);
+		if(i % 2 == 0)
+		{
+			center = { 8.0f * std::round(center.x / 8.0f), 8.0f * std::round(center.y / 8.0f) };
+			dist = 8.0f * std::ceil(dist / 8.0f);
+		}
+		const Box2f box = Box2f::FromCenter(center, { 8.0f * probeSizeDist(rng), 8.0f * probeSizeDist(rng) });
+		const uint32_t mask = masks[i % 4];
+
+		const int32_t sweepCountBeforeProbe = world->GetColliderSweepCount();
+		const auto probe = world->ProbeCardinal(box, dist, mask);
+		const int32_t sweepCountBeforeSweeps = world->GetColliderSweepCount();
+
+		const std::pair<const std::optional<Math::BoxSweepResults>&, Vec2f> dirs[] = {
+			{ probe.m_up, { 0.0f, dist } },
+			{ probe.m_down, { 0.0f, -dist } },
+			{ probe.m_left, { -dist, 0.0f } },
+			{ probe.m_right, { dist, 0.0f } },
+		};
+		for(const auto& dir : dirs)
+		{
+			const auto sweepHit = world->SweepBox(box, dir.second, mask);
+			REQUIRE(dir.first.has_value() == sweepHit.has_value());
+			if(!sweepHit)
+			{
+				continue;
+			}
+			++numHits;
+			CHECK(dir.first->m_dist == sweepHit->m_dist);
+			CHECK(dir.first->m_normal == sweepHit->m_normal);
+			CHECK(dir.first->m_sweptBox.GetMin() == sweepHit->m_sweptBox.GetMin());
+			CHECK(dir.first->m_sweptBox.GetMax() == sweepHit->m_sweptBox.GetMax());
+
+			int32_t numNearest = 0;
+			const auto linearHit = LinearSweepBox(colliders, box, dir.second, mask, numNearest);
+			REQUIRE(linearHit.has_value());
+			CHECK(linearHit->m_dist == sweepHit->m_dist);
+			numTies += (numNearest > 1) ? 1 : 0;
+		}
+
+		// The probe sweeps exactly the colliders the four sweeps do, no more
+		CHECK(sweepCountBeforeSweeps - sweepCountBeforeProbe == world->GetColliderSweepCount() - sweepCountBeforeSweeps);
+	}
+	CHECK(numHits > 1000);
+	CHECK(numTies > 100); //< Ties are common, and the probe resolves them the same way as SweepBox
+}
+
+TEST_CASE("CollisionWorld: colliders moving at a steady speed are rarely re-indexed")
+{
+	auto owner = Object::MakeRoot();
+	auto actor = std::make_shared<Actor>();
+	actor->SetOwner(owner);
+	auto world = std::make_shared<CollisionWorld>();
+	std::mt19937 rng(7);
+	auto staticColliders = MakeRandomBoxColliders(actor, world, 50, 1000.0f, rng); //< Something for the movers to share the tree with
+
+	const Box2f boxLocal = Box2f::FromCenter(Vec2f::Zero, { 16.0f, 24.0f });
+	for(const Vec2f velocity : { Vec2f{ 2.0f, 0.0f }, Vec2f{ 0.0f, -3.0f }, Vec2f{ 1.5f, 1.5f } })
+	{
+		const int32_t numFrames = 600;
+		auto mover = MakeBoxCollider(actor, world, boxLocal, CL_Enemy);
+
+		// The same motion in a tree that isn't told the displacement, ie with plain (unstretched) fat boxes
+		AABBTree<int32_t> unstretchedTree;
+		const int32_t proxyId = unstretchedTree.CreateProxy(boxLocal, 0);
+
+		const int32_t reindexCountBefore = world->GetColliderReindexCount();
+		for(int32_t frame = 1; frame <= numFrames; ++frame)
+		{
+			const Vec2f pos = velocity * (float)frame;
+			mover->SetWorldPos(pos);
+			unstretchedTree.MoveProxy(proxyId, Box2f::FromCenter(pos, boxLocal.GetDims()));
+		}
+		const int32_t numStretchedReindexes = world->GetColliderReindexCount() - reindexCountBefore;
+		const int32_t numUnstretchedReindexes = unstretchedTree.GetReinsertCount();
+		CHECK(numStretchedReindexes > 0); //< It does keep up with the collider
+		CHECK(numStretchedReindexes < numFrames / 4);
+		CHECK(numStretchedReindexes * 2 < numUnstretchedReindexes);
+
+		// ...and it's still found where it ended up
+		const Vec2f endPos = velocity * (float)numFrames;
+		const auto hit = world->SweepBox(Box2f::FromCenter(endPos + Vec2f{ 0.0f, 40.0f }, { 4.0f, 4.0f }), { 0.0f, -40.0f }, CL_Enemy);
+		REQUIRE(hit.has_value());
+		CHECK(std::abs(hit->m_dist - (40.0f - 12.0f - 2.0f)) < 0.01f);
+		mover->Destroy();
+	}
+}
@@ -0,0 +1,262 @@
+#include "TestFramework.h"
+#include "HeadlessScope.h"
+
+#include "Engine/Actor.h"
+#include "Engine/CoverageMask.h"
+#include "Engine/Game.h"
+#include "Engine/LayerManager.h"
+#include "Engine/RenderTexture.h"
+#include "Engine/SpriteBatch.h"
+#include "Engine/Components/SpriteComponent.h"
+
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <algorithm>
+#include <random>
+
+namespace
+{
+	// Marks every tile the box overlaps with nonzero area, testing each tile's rect in turn
+	void MarkPixelBoxPerTile(std::vector<uint8_t>& inout_tiles, Vec2i in_dims, Vec2f in_tileExtents, Vec2f in_minPixel, Vec2f in_maxPixel)
+	{
+		for(int32_t tileY = 0; tileY < in_dims.y; ++tileY)
+		{
+			for(int32_t tileX = 0; tileX < in_dims.x; ++tileX)
+			{
+				const float overlapX = std::min(in_maxPixel.x, (tileX + 1) * in_tileExtents.x) - std::max(in_minPixel.x, tileX * in_tileExtents.x);
+				const float overlapY = std::min(in_maxPixel.y, (tileY + 1) * in_tileExtents.y) - std::max(in_minPixel.y, tileY * in_tileExtents.y);
+				if(overlapX > 0.0f && overlapY > 0.0f)
+				{
+					inout_tiles[tileY * in_dims.x + tileX] = 1;
+				}
+			}
+		}
+	}
+}
+
+TEST_CASE("CoverageMask: tiles evenly divide the texture")
+{
+	CoverageMask mask;
+	mask.Reset({ 336, 240 }, 16); //< GameLoop's render size and lights layer tile size
+	CHECK((mask.GetDims() == Vec2i{ 21, 15 }));
+	CHECK(mask.GetTiles().size() == 21 * 15);
+	CHECK(mask.GetNumCovered() == 0);
+
+	// Sizes that don't divide evenly get slightly smaller tiles, so the last tile still ends on the texture's edge
+	mask.Reset({ 100, 50 }, 16);
+	CHECK((mask.GetDims() == Vec2i{ 7, 4 }));
+	mask.MarkPixelBox({ 99.0f, 49.0f }, { 100.0f, 50.0f });
+	CHECK(mask.GetNumCovered() == 1);
+	CHECK(mask.IsCovered(6, 3));
+
+	// No tiles at all for an empty texture or no tile size
+	mask.Reset({ 0, 50 }, 16);
+	CHECK(mask.GetTiles().empty());
+	mask.Reset({ 100, 50 }, 0);
+	CHECK(mask.GetTiles().empty());
+}
+
+TEST_CASE("CoverageMask: marking pixel boxes matches testing every tile")
+{
+	CoverageMask mask;
+	mask.Reset({ 320, 192 }, 16);
+	const Vec2i dims = mask.GetDims();
+	const Vec2f tileExtents = { 16.0f, 16.0f };
+
+	// Boxes ending exactly on a tile edge don't touch the next tile, and empty or off-texture boxes mark nothing
+	mask.MarkPixelBox({ 0.0f, 0.0f }, { 16.0f, 16.0f });
+	CHECK(mask.GetNumCovered() == 1);
+	CHECK(mask.IsCovered(0, 0));
+	mask.MarkPixelBox({ 32.0f, 0.0f }, { 32.0f, 100.0f });
+	mask.MarkPixelBox({ -50.0f, -50.0f }, { -1.0f, 100.0f });
+	mask.MarkPixelBox({ 330.0f, 10.0f }, { 400.0f, 20.0f });
+	CHECK(mask.GetNumCovered() == 1);
+
+	// Boxes hanging off the texture are clipped to it
+	mask.MarkPixelBox({ 310.0f, 180.0f }, { 1000.0f, 1000.0f });
+	CHECK(mask.GetNumCovered() == 2);
+	CHECK(mask.IsCovered(dims.x - 1, dims.y - 1));
+
+	// Random boxes, accumulated until the mask is mostly covered
+	std::mt19937 rng(18);
+	std::uniform_real_distribution<float> posDist(-40.0f, 360.0f);
+	std::uniform_real_distribution<float> sizeDist(0.0f, 40.0f);
+	for(int32_t trial = 0; trial < 20; ++trial)
+	{
+		mask.Clear();
+		CHECK(mask.GetNumCovered() == 0);
+		std::vector<uint8_t> expectedTiles(mask.GetTiles().size(), 0);
+		for(int32_t boxIdx = 0; boxIdx < 10 * trial; ++boxIdx)
+		{
+			const Vec2f minPixel = { posDist(rng), posDist(rng) * 0.6f };
+			const Vec2f maxPixel = minPixel + Vec2f{ sizeDist(rng), sizeDist(rng) };
+			mask.MarkPixelBox(minPixel, maxPixel);
+			MarkPixelBoxPerTile(expectedTiles, dims, tileExtents, minPixel, maxPixel);
+		}
+		REQUIRE(mask.GetTiles() == expectedTiles);
+		CHECK(mask.GetNumCovered() == (uint32_t)std::count(expectedTiles.begin(), expectedTiles.end(), (uint8_t)1));
+	}
+
+	mask.MarkAll();
+	CHECK(mask.GetNumCovered() == mask.GetTiles().size());
+	mask.MarkPixelBox({ 0.0f, 0.0f }, { 8.0f, 8.0f });
+	CHECK(mask.GetNumCovered() == mask.GetTiles().size());
+}
+
+TEST_CASE("CoverageMask: render textures mark the tiles under queued sprites")
+{
+	Test::HeadlessScope headless;
+	RenderTexture renderTexture({ 64, 32 }); //< The default view maps world units 1:1 to pixels, y-up from the bottom-left
+	renderTexture.SetCoverageTileSize(16);
+	REQUIRE(renderTexture.GetCoverageMask() != nullptr);
+	const CoverageMask& mask = *renderTexture.GetCoverageMask();
+	CHECK((mask.GetDims() == Vec2i{ 4, 2 }));
+
+	// Nothing's been drawn since the first clear (a new render texture counts as drawn until then), so nothing's covered
+	renderTexture.Clear(sf::Color::Black);
+	CHECK(mask.GetNumCovered() == 0);
+
+	// A sprite inside tile (1, 0), then one straddling tiles (2, 0) to (3, 1)
+	const auto QueueQuad = [&renderTexture](Vec2f in_min, Vec2f in_max) {
+		const sf::Vertex quad[4] = {
+			sf::Vertex({ in_min.x, in_max.y }),
+			sf::Vertex({ in_min.x, in_min.y }),
+			sf::Vertex({ in_max.x, in_max.y }),
+			sf::Vertex({ in_max.x, in_min.y }),
+		};
+		renderTexture.QueueSprite(quad, {});
+	};
+	QueueQuad({ 20.0f, 4.0f }, { 28.0f, 12.0f });
+	CHECK(mask.GetNumCovered() == 1);
+	CHECK(mask.IsCovered(1, 0));
+	QueueQuad({ 40.0f, 10.0f }, { 50.0f, 20.0f });
+	CHECK(mask.GetNumCovered() == 5);
+	CHECK(mask.IsCovered(2, 0));
+	CHECK(mask.IsCovered(3, 0));
+	CHECK(mask.IsCovered(2, 1));
+	CHECK(mask.IsCovered(3, 1));
+	CHECK(!mask.IsCovered(0, 0));
+
+	// Any other kind of draw covers the whole texture
+	const sf::Vertex line[2] = { sf::Vertex({ 0.0f, 0.0f }), sf::Vertex({ 1.0f, 1.0f }) };
+	renderTexture.DrawSFML(line, 2, sf::Lines, sf::RenderStates::Default);
+	CHECK(mask.GetNumCovered() == 8);
+	CHECK(renderTexture.Clear(sf::Color::Transparent));
+	CHECK(mask.GetNumCovered() == 0);
+
+	// Turning tracking on after drawing starts fully covered, since nothing's known about what was drawn before
+	renderTexture.DrawSFML(line, 2, sf::Lines, sf::RenderStates::Default);
+	renderTexture.SetCoverageTileSize(32);
+	REQUIRE(renderTexture.GetCoverageMask() != nullptr);
+	CHECK(renderTexture.GetCoverageMask()->GetNumCovered() == 2);
+}
+
+TEST_CASE("CoverageMask: sprite world bounds match the tiles their drawn quads cover")
+{
+	Test::HeadlessScope headless;
+	GameBase game({ 64, 64 }, { 64, 64 }, L"CoverageMaskTests");
+	GetWindow()->GetLayerManager()->AddLayer("fgGameplay"); //< Sprites start out on it
+	auto root = Object::MakeRoot();
+	auto renderTexture = std::make_shared<RenderTexture>(Vec2i{ 160, 128 }); //< 1:1 world units to pixels, y-up from the bottom-left
+	renderTexture->SetCoverageTileSize(1); //< A tile per pixel, so the covered tiles are the drawn quad's pixel bounds
+
+	// A 16x8 frame with an off-center origin, on a scaled actor, in each combination of flips
+	Transform actorTransform = { Vec2f{ 100.0f, 50.0f } };
+	actorTransform.scale = { 2.0f, 3.0f };
+	auto actor = Actor::Spawn<Actor>(root, actorTransform);
+	auto sprite = actor->MakeSprite();
+	sprite->SetTargetRenderTexture(renderTexture);
+	sprite->SetSubTexture({ 32, 16, 16, 8 });
+	sprite->SetOrigin({ 4.0f, 2.0f });
+	const struct
+	{
+		bool m_bFlipH;
+		bool m_bFlipV;
+		Box2f m_expectedBounds;
+	} cases[] = {
+		{ false, false, { 92.0f, 32.0f, 32.0f, 24.0f } }, //< Texture y is down and world y is up, so unflipped sprites are mirrored vertically
+		{ true, false, { 76.0f, 32.0f, 32.0f, 24.0f } },
+		{ false, true, { 92.0f, 44.0f, 32.0f, 24.0f } },
+		{ true, true, { 76.0f, 44.0f, 32.0f, 24.0f } },
+	};
+	for(const auto& testCase : cases)
+	{
+		sprite->SetFlipHori(testCase.m_bFlipH);
+		sprite->SetFlipVert(testCase.m_bFlipV);
+		const Box2f bounds = sprite->GetWorldBounds();
+		CHECK(bounds.GetMin() == testCase.m_expectedBounds.GetMin());
+		CHECK(bounds.GetMax() == testCase.m_expectedBounds.GetMax());
+
+		// Drawing the sprite covers those pixels (give or take the rounding of the view transform along the edges)
+		renderTexture->Clear(sf::Color::Transparent);
+		actor->Draw();
+		const CoverageMask& mask = *renderTexture->GetCoverageMask();
+		const Vec2i minPixel = Vec2i(bounds.GetMin());
+		const Vec2i maxPixel = Vec2i(bounds.GetMax()) - Vec2i{ 1, 1 };
+		CHECK(mask.GetNumCovered() >= (uint32_t)(bounds.w * bounds.h));
+		CHECK(mask.GetNumCovered() <= (uint32_t)((bounds.w + 2.0f) * (bounds.h + 2.0f)));
+		CHECK(mask.IsCovered(minPixel.x, minPixel.y));
+		CHECK(mask.IsCovered(maxPixel.x, maxPixel.y));
+		CHECK(!mask.IsCovered(minPixel.x - 2, minPixel.y));
+		CHECK(!mask.IsCovered(minPixel.x, minPixel.y - 2));
+		CHECK(!mask.IsCovered(maxPixel.x + 2, maxPixel.y));
+		CHECK(!mask.IsCovered(maxPixel.x, maxPixel.y + 2));
+	}
+
+	root->Destroy();
+}
+
+TEST_CASE("CoverageMask: sprites culled against the view leave their tiles unmarked")
+{
+	// Lights cull their sprite against the world view before drawing it (see LightElement::Draw()), so the lighting shader can skip their tiles
+	Test::HeadlessScope headless;
+	GameBase game({ 64, 64 }, { 64, 64 }, L"CoverageMaskTests");
+	const auto layerManager = GetWindow()->GetLayerManager();
+	layerManager->AddLayer("fgGameplay");
+	RenderLayer* layer = layerManager->GetLayer(layerManager->AddLayer("lights"));
+	layer->SetCoverageTileSize(16);
+	const Box2f view = { 0.0f, 0.0f, 64.0f, 64.0f };
+	layer->SetView(view);
+	const CoverageMask& mask = *layer->GetRenderTexture()->GetCoverageMask();
+	REQUIRE((mask.GetDims() == Vec2i{ 4, 4 }));
+
+	auto root = Object::MakeRoot();
+	const auto DrawIfVisible = [&root, &view](Vec2f in_pos, float in_scale) {
+		Transform transform = { in_pos };
+		transform.scale = { in_scale, in_scale };
+		auto actor = Actor::Spawn<Actor>(root, transform);
+		auto sprite = actor->MakeSprite();
+		sprite->SetRenderLayer(GetWindow()->GetLayerManager()->FindLayerId("lights"));
+		sprite->SetSubTexture({ 0, 0, 16, 16 });
+		sprite->SetOrigin({ 8.0f, 8.0f });
+		const bool bVisible = sprite->GetWorldBounds().Overlaps(view);
+		if(bVisible)
+		{
+			actor->Draw();
+		}
+		actor->Destroy();
+		return bVisible;
+	};
+
+	// Off to each side of the view (the big one only just misses it), none of them are drawn or mark anything
+	layer->GetRenderTexture()->Clear(sf::Color::Transparent);
+	CHECK(!DrawIfVisible({ -9.0f, 32.0f }, 1.0f));
+	CHECK(!DrawIfVisible({ 32.0f, 73.0f }, 1.0f));
+	CHECK(!DrawIfVisible({ 100.0f, 32.0f }, 4.0f));
+	CHECK(!DrawIfVisible({ 32.0f, -200.0f }, 2.0f));
+	CHECK(mask.GetNumCovered() == 0);
+	CHECK(!layer->GetRenderTexture()->HasDrawnContent());
+
+	// A sprite straddling the view's left edge is drawn, and marks only the tiles inside it
+	CHECK(DrawIfVisible({ 0.0f, 8.0f }, 1.0f));
+	CHECK(mask.GetNumCovered() == 1);
+	CHECK(mask.IsCovered(0, 0));
+
+	// Growing a light's scale can bring it into view
+	CHECK(DrawIfVisible({ 96.0f, 56.0f }, 5.0f));
+	CHECK(mask.IsCovered(3, 3));
+	CHECK(!mask.IsCovered(0, 3));
+
+	root->Destroy();
+}
@@ -0,0 +1,202 @@
+#include "TestFramework.h"
+#include "HeadlessScope.h"
+
+#include "Engine/Actor.h"
+#include "Engine/Game.h"
+#include "Engine/LayerManager.h"
+#include "Engine/SortUtils.h"
+#include "Engine/Components/DrawComponent.h"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+	using DrawLog = std::vector<std::pair<const Actor*, const DrawComponent*>>;
+
+	// Logs itself when drawn, then draws its components
+	class DrawLogActor : public Actor
+	{
+	public:
+		DrawLogActor(DrawLog* in_drawLog)
+			: m_drawLog(in_drawLog)
+		{
+		}
+		virtual void Draw() override
+		{
+			m_drawLog->push_back({ this, nullptr });
+			Actor::Draw();
+		}
+		DrawLog* m_drawLog;
+	};
+
+	// Logs itself (under its actor) when drawn
+	class DrawLogComponent : public DrawComponent
+	{
+	public:
+		virtual void Draw() override
+		{
+			auto actor = std::static_pointer_cast<DrawLogActor>(GetActor());
+			actor->m_drawLog->push_back({ actor.get(), this });
+		}
+	};
+
+	// Element of a sorted list, sorted on its layer (ties keep their sequence order)
+	struct DrawEntry
+	{
+		int32_t m_drawLayer;
+		uint32_t m_drawSeq; //< Registration order
+	};
+
+	bool SameOrder(const std::vector<DrawEntry>& in_a, const std::vector<DrawEntry>& in_b)
+	{
+		return std::equal(in_a.begin(), in_a.end(), in_b.begin(), in_b.end(), [](const DrawEntry& in_lhs, const DrawEntry& in_rhs) {
+			return in_lhs.m_drawLayer == in_rhs.m_drawLayer && in_lhs.m_drawSeq == in_rhs.m_drawSeq;
+		});
+	}
+}
+
+TEST_CASE("InsertionSort: keeps equal elements in their original order")
+{
+	std::mt19937 rng(13);
+	std::uniform_int_distribution<int32_t> layerDist(-3, 3); //< Few layers, so most elements tie
+	for(int32_t size : { 0, 1, 2, 7, 100, 1000 })
+	{
+		std::vector<DrawEntry> entries;
+		for(int32_t i = 0; i < size; ++i)
+		{
+			entries.push_back({ layerDist(rng), (uint32_t)i });
+		}
+
+		// Sort on the layer alone -- ties must come out in sequence order, like std::stable_sort
+		const auto layerLess = [](const DrawEntry& in_lhs, const DrawEntry& in_rhs) {
+			return in_lhs.m_drawLayer < in_rhs.m_drawLayer;
+		};
+		auto expected = entries;
+		std::stable_sort(expected.begin(), expected.end(), layerLess);
+		InsertionSort(entries.begin(), entries.end(), layerLess);
+		CHECK(SameOrder(entries, expected));
+	}
+
+	// Move-only elements are moved, never copied
+	std::vector<std::unique_ptr<int32_t>> values;
+	for(int32_t value : { 3, 1, 2, 1, 0 })
+	{
+		values.push_back(std::make_unique<int32_t>(value));
+	}
+	const int32_t* firstOne = values[1].get();
+	InsertionSort(values.begin(), values.end(), [](const auto& in_lhs, const auto& in_rhs) {
+		return *in_lhs < *in_rhs;
+	});
+	REQUIRE(std::all_of(values.begin(), values.end(), [](const auto& in_value) { return in_value != nullptr; }));
+	CHECK(*values[0] == 0);
+	CHECK(values[1].get() == firstOne);
+	CHECK(*values[2] == 1);
+	CHECK(*values[3] == 2);
+	CHECK(*values[4] == 3);
+}
+
+TEST_CASE("DrawOrder: actors and their draw components are drawn in the order re-sorting every frame gives")
+{
+	// Spawns, draw layer and draw order changes and destroys happen between frames, through the real actor and component calls.
+	// Each frame must draw in the order of the old per-frame stable_sort of the registration-ordered (and add-ordered) lists.
+	Test::HeadlessScope headless;
+	GameBase game({ 64, 64 }, { 64, 64 }, L"DrawOrderTests");
+	GetWindow()->GetLayerManager()->AddLayer("fgGameplay"); //< Draw components start out on it
+	auto root = Object::MakeRoot();
+	DrawLog drawLog;
+
+	std::mt19937 rng(14);
+	std::uniform_int_distribution<int32_t> layerDist(0, 5);
+	std::uniform_int_distribution<int32_t> percentDist(0, 99);
+	std::vector<std::shared_ptr<DrawLogActor>> actors; //< In registration order
+	std::vector<std::vector<std::shared_ptr<DrawLogComponent>>> actorComps; //< Each actor's, in the order they were added
+	const auto AddComponent = [&actorComps, &actors, &percentDist, &rng](size_t in_actorIdx) {
+		auto drawComp = actors[in_actorIdx]->MakeDrawComponent<DrawLogComponent>();
+		drawComp->SetComponentDrawOrder(percentDist(rng) % 4 - 1);
+		actorComps[in_actorIdx].push_back(drawComp);
+	};
+	for(int32_t frame = 0; frame < 500; ++frame)
+	{
+		// Spawns
+		const int32_t numSpawns = percentDist(rng) < 30 ? 1 + percentDist(rng) % 4 : 0;
+		for(int32_t i = 0; i < numSpawns; ++i)
+		{
+			actors.push_back(Actor::Spawn<DrawLogActor>(root, Transform::Identity, &drawLog));
+			actors.back()->SetDrawLayer(layerDist(rng));
+			actorComps.emplace_back();
+			for(int32_t numComps = percentDist(rng) % 4; numComps > 0; --numComps)
+			{
+				AddComponent(actors.size() - 1);
+			}
+		}
+
+		if(!actors.empty())
+		{
+			// Draw layer changes
+			if(percentDist(rng) < 20)
+			{
+				actors[(size_t)percentDist(rng) % actors.size()]->SetDrawLayer(layerDist(rng));
+			}
+
+			// Components added to, reordered on, or destroyed on an existing actor
+			const size_t actorIdx = (size_t)percentDist(rng) % actors.size();
+			auto& comps = actorComps[actorIdx];
+			const int32_t compRoll = percentDist(rng);
+			if(compRoll < 15)
+			{
+				AddComponent(actorIdx);
+			}
+			else if(compRoll < 40 && !comps.empty())
+			{
+				comps[(size_t)percentDist(rng) % comps.size()]->SetComponentDrawOrder(percentDist(rng) % 4 - 1);
+			}
+			else if(compRoll < 45 && !comps.empty())
+			{
+				const size_t compIdx = (size_t)percentDist(rng) % comps.size();
+				comps[compIdx]->Destroy();
+				comps.erase(comps.begin() + compIdx);
+			}
+
+			// Destroys
+			if(percentDist(rng) < 25)
+			{
+				const size_t destroyIdx = (size_t)percentDist(rng) % actors.size();
+				actors[destroyIdx]->Destroy();
+				actors.erase(actors.begin() + destroyIdx);
+				actorComps.erase(actorComps.begin() + destroyIdx);
+			}
+		}
+
+		drawLog.clear();
+		game.Draw();
+
+		// The old order: actors stable-sorted by draw layer, and each actor's components stable-sorted by draw order
+		std::vector<size_t> actorOrder(actors.size());
+		std::iota(actorOrder.begin(), actorOrder.end(), 0);
+		std::stable_sort(actorOrder.begin(), actorOrder.end(), [&actors](size_t in_lhs, size_t in_rhs) {
+			return actors[in_lhs]->GetDrawLayer() < actors[in_rhs]->GetDrawLayer();
+		});
+		DrawLog expected;
+		for(const size_t actorIdx : actorOrder)
+		{
+			expected.push_back({ actors[actorIdx].get(), nullptr });
+			auto comps = actorComps[actorIdx];
+			std::stable_sort(comps.begin(), comps.end(), [](const auto& in_lhs, const auto& in_rhs) {
+				return in_lhs->GetDrawOrder() < in_rhs->GetDrawOrder();
+			});
+			for(const auto& comp : comps)
+			{
+				expected.push_back({ actors[actorIdx].get(), comp.get() });
+			}
+		}
+		REQUIRE(drawLog == expected);
+	}
+	CHECK(!actors.empty());
+
+	root->Destroy();
+}
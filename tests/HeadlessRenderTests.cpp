@@ -0,0 +1,210 @@
+#include "TestFramework.h"
+#include "HeadlessScope.h"
+
+#include "GameLoop.h"
+#include "Engine/Actor.h"
+#include "Engine/Components/SpriteComponent.h"
+#include "Engine/Game.h"
+#include "Engine/GameWindow.h"
+#include "Engine/LayerManager.h"
+#include "Engine/PaletteSet.h"
+#include "Engine/RenderTexture.h"
+#include "Engine/Shader.h"
+#include "Engine/SpriteBatch.h"
+#include "Engine/Texture.h"
+
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <vector>
+
+// These load assets by relative path, so run the tests from the repo root (the project's default working directory)
+
+namespace
+{
+	// 100 actors with 10 sprites each, every sprite showing one of the frames of a shared sheet (drawn in this order)
+	std::vector<std::shared_ptr<SpriteComponent>> SpawnSpriteActors(const std::shared_ptr<Object>& in_owner, std::shared_ptr<Texture> in_sheet)
+	{
+		std::vector<std::shared_ptr<SpriteComponent>> sprites;
+		for(int32_t actorIdx = 0; actorIdx < 100; ++actorIdx)
+		{
+			auto actor = Actor::Spawn<Actor>(in_owner, Transform{ Vec2f{ (float)(actorIdx % 10) * 6.0f, (float)(actorIdx / 10) * 6.0f } });
+			for(int32_t spriteIdx = 0; spriteIdx < 10; ++spriteIdx)
+			{
+				auto sprite = actor->MakeSprite(Transform{ Vec2f{ (float)spriteIdx, 0.0f } });
+				sprite->SetTexture(in_sheet);
+				sprite->SetSubTexture({ (spriteIdx % 4) * 16, (spriteIdx / 4) * 16, 16, 16 });
+				sprites.push_back(sprite);
+			}
+		}
+		return sprites;
+	}
+}
+
+TEST_CASE("Headless: render textures, shaders and textures have nothing SFML behind them")
+{
+	Test::HeadlessScope headless;
+
+	Shader shader("data/shaders/PostProcessLighting");
+	CHECK(shader.GetSFMLShader() == nullptr);
+	CHECK(shader.GetLoadCount() == 0);
+	shader.SetUniform("time", 1.0f); //< Ignored
+
+	Texture texture("data/tilesets/autoTiles.png");
+	CHECK(texture.GetSFMLTexture() == nullptr);
+
+	auto renderTexture = std::make_shared<RenderTexture>(Vec2i{ 64, 32 });
+	auto compositeTarget = std::make_shared<RenderTexture>(Vec2i{ 64, 32 });
+	renderTexture->SetCoverageTileSize(16);
+	CHECK(renderTexture->GetSFMLRenderTexture() == nullptr);
+	CHECK(renderTexture->GetCoverageMask() != nullptr);
+	CHECK(renderTexture->GetCoverageTexture() == nullptr);
+	RenderTexture::ResetRenderStats();
+	const RenderStats& stats = RenderTexture::GetRenderStats();
+
+	// New textures need one clear, after which clearing to the same color again is skipped
+	CHECK(renderTexture->Clear(sf::Color::Black));
+	CHECK(!renderTexture->Clear(sf::Color::Black));
+	CHECK(stats.m_clears == 1);
+
+	// Direct draws and sprite batches are counted as if they were submitted to SFML
+	const sf::Vertex triangle[3] = { sf::Vertex({ 0.0f, 0.0f }), sf::Vertex({ 8.0f, 0.0f }), sf::Vertex({ 0.0f, 8.0f }) };
+	renderTexture->DrawSFML(triangle, 3, sf::Triangles, sf::RenderStates::Default);
+	const sf::Vertex quad[4] = { sf::Vertex({ 0.0f, 0.0f }), sf::Vertex({ 0.0f, 8.0f }), sf::Vertex({ 8.0f, 0.0f }), sf::Vertex({ 8.0f, 8.0f }) };
+	for(int32_t i = 0; i < 3; ++i)
+	{
+		renderTexture->QueueSprite(quad, {});
+	}
+	renderTexture->FlushSprites();
+	CHECK(renderTexture->GetSpriteCount() == 3);
+	CHECK(renderTexture->GetSpriteDrawCallCount() == 1);
+	CHECK(stats.m_drawCalls == 2);
+	CHECK(stats.m_vertices == 3 + 3 * 6);
+	CHECK(renderTexture->HasDrawnContent());
+
+	// Sampling resolves the texture once, even though there's no texture to sample
+	CHECK(renderTexture->GetSFMLTexture() == nullptr);
+	CHECK(renderTexture->GetSFMLTexture() == nullptr);
+	CHECK(stats.m_displays == 1);
+
+	// Nothing so far used a texture or shader
+	CHECK(stats.m_textureChanges == 0);
+	CHECK(stats.m_shaderChanges == 0);
+
+	// Compositing into another render texture is one more draw (with any shader, which is just as null)
+	// the render texture and shader still count as state changes, like they would with SFML behind them
+	renderTexture->Draw(Transform::Identity, compositeTarget, std::make_shared<Shader>("data/shaders/PostProcessLighting"));
+	CHECK(stats.m_drawCalls == 3);
+	CHECK(stats.m_vertices == 3 + 3 * 6 + 4);
+	CHECK(compositeTarget->HasDrawnContent());
+	CHECK(stats.m_textureChanges == 1);
+	CHECK(stats.m_shaderChanges == 1);
+}
+
+TEST_CASE("Headless: the game runs a fixed number of frames and counts its draws")
+{
+	Test::HeadlessScope headless;
+	const int32_t numFrames = 120;
+	{
+		Game<GameLoop> game;
+		REQUIRE(game.GetWindow()->GetSFMLWindow() == nullptr);
+		game.SetMaxFrames(numFrames);
+		game.Run();
+		CHECK(game.GetFrameCount() == numFrames);
+	}
+
+	// Every frame at least applies the post-process shader, then composites through the PixelSmooth intermediate target to the window,
+	// resolving the two textures it drew into along the way (the game render texture is only resolved on frames something drew to it)
+	const RenderStats& stats = RenderTexture::GetRenderStats();
+	CHECK(stats.m_drawCalls >= 3 * (uint64_t)numFrames);
+	CHECK(stats.m_vertices >= 4 * 3 * (uint64_t)numFrames);
+	CHECK(stats.m_displays >= 2 * (uint64_t)numFrames);
+	CHECK(stats.m_clears >= (uint64_t)numFrames);
+
+	// Textures and shaders are told apart headless too, so the frames' switches between them are counted
+	CHECK(stats.m_textureChanges > 0);
+	CHECK(stats.m_shaderChanges > 0);
+	CHECK(stats.m_textureChanges <= stats.m_drawCalls);
+}
+
+TEST_CASE("Headless: a thousand sprites sharing a sheet draw in one call per layer")
+{
+	Test::HeadlessScope headless;
+	GameBase game({ 64, 64 }, { 64, 64 }, L"HeadlessRenderTests");
+	const auto layerManager = game.GetWindow()->GetLayerManager();
+	const RenderLayerId gameplayLayerId = layerManager->AddLayer("fgGameplay"); //< Sprites start out on it
+	const RenderLayerId hudLayerId = layerManager->AddLayer("hud");
+	auto root = Object::MakeRoot();
+	const auto sprites = SpawnSpriteActors(root, std::make_shared<Texture>("data/anims/Crawler.png"));
+	REQUIRE(sprites.size() == 1000);
+
+	// Every sprite on one layer is one run, whatever the frames and transforms
+	game.Draw();
+	RenderLayer* gameplayLayer = layerManager->GetLayer(gameplayLayerId);
+	RenderLayer* hudLayer = layerManager->GetLayer(hudLayerId);
+	CHECK(gameplayLayer->GetRenderTexture()->GetSpriteCount() == 1000);
+	CHECK(gameplayLayer->GetSpriteDrawCallCount() == 1);
+	CHECK(hudLayer->GetSpriteDrawCallCount() == 0);
+
+	// Each layer batches its own sprites, so sprites alternating between two layers are still one run on each
+	for(size_t spriteIdx = 1; spriteIdx < sprites.size(); spriteIdx += 2)
+	{
+		sprites[spriteIdx]->SetRenderLayer(hudLayerId);
+	}
+	game.Draw();
+	CHECK(gameplayLayer->GetRenderTexture()->GetSpriteCount() == 500);
+	CHECK(hudLayer->GetRenderTexture()->GetSpriteCount() == 500);
+	CHECK(gameplayLayer->GetSpriteDrawCallCount() == 1);
+	CHECK(hudLayer->GetSpriteDrawCallCount() == 1);
+
+	root->Destroy();
+}
+
+TEST_CASE("Headless: sprite runs split where the palette or shader changes")
+{
+	Test::HeadlessScope headless;
+	GameBase game({ 64, 64 }, { 64, 64 }, L"HeadlessRenderTests");
+	const auto layerManager = game.GetWindow()->GetLayerManager();
+	RenderLayer* layer = layerManager->GetLayer(layerManager->AddLayer("fgGameplay"));
+	auto root = Object::MakeRoot();
+	const auto sprites = SpawnSpriteActors(root, std::make_shared<Texture>("data/anims/Crawler.png"));
+	const uint32_t numSprites = (uint32_t)sprites.size();
+
+	// Palettes are separate textures bound alongside the sheet, so each change of palette starts a new run...
+	auto paletteSet = std::make_shared<PaletteSet>("data/anims/Crawler_Palette_");
+	REQUIRE(paletteSet->GetPaletteTexture(paletteSet->GetPaletteIdx("Chill")) != paletteSet->GetPaletteTexture(0));
+	for(size_t spriteIdx = 0; spriteIdx < sprites.size(); ++spriteIdx)
+	{
+		sprites[spriteIdx]->SetPaletteSet(paletteSet);
+		sprites[spriteIdx]->SetPalette(spriteIdx % 2 ? "Chill" : "Base");
+	}
+	game.Draw();
+	CHECK(layer->GetSpriteDrawCallCount() == numSprites);
+
+	// ...but sprites sharing a palette still share a run
+	for(size_t spriteIdx = 0; spriteIdx < sprites.size(); ++spriteIdx)
+	{
+		sprites[spriteIdx]->SetPalette(spriteIdx < sprites.size() / 2 ? "Base" : "Chill");
+	}
+	game.Draw();
+	CHECK(layer->GetSpriteDrawCallCount() == 2);
+
+	// The same goes for sprites without a palette set drawn with their own shader
+	auto shader = std::make_shared<Shader>("data/shaders/PostProcessLighting");
+	for(size_t spriteIdx = 0; spriteIdx < sprites.size(); ++spriteIdx)
+	{
+		sprites[spriteIdx]->SetPaletteSet(nullptr);
+		sprites[spriteIdx]->SetShader(spriteIdx % 10 == 9 ? shader : nullptr); //< The last sprite of each actor
+	}
+	game.Draw();
+	CHECK(layer->GetSpriteDrawCallCount() == 200);
+	for(size_t spriteIdx = 0; spriteIdx < sprites.size(); ++spriteIdx)
+	{
+		sprites[spriteIdx]->SetShader(spriteIdx < 900 ? nullptr : shader);
+	}
+	game.Draw();
+	CHECK(layer->GetSpriteDrawCallCount() == 2);
+	CHECK(layer->GetRenderTexture()->GetSpriteCount() == numSprites);
+
+	root->Destroy();
+}
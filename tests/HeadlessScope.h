@@ -0,0 +1,22 @@
+#pragma once
+
+#include "Engine/GameWindow.h"
+#include "Engine/RenderTexture.h"
+
+namespace Test
+{
+	// Selects the null render backend (and resets the render stats) for as long as it's in scope
+	// create any GameBase inside it, since the backend can only be changed while there's no game
+	struct HeadlessScope
+	{
+		HeadlessScope()
+		{
+			GameWindow::SetRenderBackend(eRenderBackend::Null);
+			RenderTexture::ResetRenderStats();
+		}
+		~HeadlessScope()
+		{
+			GameWindow::SetRenderBackend(eRenderBackend::SFML);
+		}
+	};
+}
@@ -0,0 +1,198 @@
+#include "TestFramework.h"
+#include "HeadlessScope.h"
+
+#include "GameEnums.h"
+#include "Engine/Game.h"
+#include "Engine/LayerManager.h"
+#include "Engine/RenderTexture.h"
+#include "Engine/Shader.h"
+
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+	// The layers GameLoop registers, in its order
+	const std::vector<std::string> s_gameLayerNames = { "fgLightMask", "bkgLightMask", "lights", "skybox", "parallax", "bkgTiles", "fgGameplay", "fgTiles", "hud" };
+}
+
+TEST_CASE("LayerManager: cached layer uniform names match building them from the layer names")
+{
+	Test::HeadlessScope headless;
+	GameBase game({ 64, 64 }, { 64, 64 }, L"LayerManagerTests"); //< Layers take their initial view from the game window
+	LayerManager layerManager;
+	layerManager.SetRenderSize({ 64, 64 });
+	for(const auto& layerName : s_gameLayerNames)
+	{
+		layerManager.AddLayer(layerName);
+	}
+
+	// The names BindShaderUniforms() binds are what it used to build every frame ("<layerName>Texture" and "<layerName>Coverage")
+	const auto CheckUniformNames = [&layerManager]() {
+		REQUIRE(layerManager.GetNumLayers() == s_gameLayerNames.size());
+		for(RenderLayerId layerId = 0; layerId < layerManager.GetNumLayers(); ++layerId)
+		{
+			const std::string& layerName = layerManager.GetLayerName(layerId);
+			CHECK(layerManager.GetLayerUniformName(layerId) == layerName + "Texture");
+			CHECK(layerManager.GetLayerCoverageUniformName(layerId) == layerName + "Coverage");
+			CHECK(layerManager.GetLayerUniformName(layerId) == LayerManager::GetLayerUniformName(layerName));
+			CHECK(layerManager.GetLayerCoverageUniformName(layerId) == LayerManager::GetLayerCoverageUniformName(layerName));
+		}
+	};
+	CheckUniformNames();
+
+	// Binding (a headless shader, so nothing is actually bound) and resizing the layers leave the names alone
+	auto shader = std::make_shared<Shader>("data/shaders/PostProcessLighting");
+	layerManager.BindShaderUniforms(shader);
+	layerManager.SetRenderSize({ 128, 96 });
+	layerManager.BindShaderUniforms(shader);
+	CheckUniformNames();
+
+	// Ids that don't name a layer have no uniforms
+	CHECK(layerManager.GetLayerUniformName((RenderLayerId)s_gameLayerNames.size()).empty());
+	CHECK(layerManager.GetLayerCoverageUniformName(InvalidRenderLayerId).empty());
+}
+
+TEST_CASE("LayerManager: layers are registered, looked up and ordered by dense id")
+{
+	Test::HeadlessScope headless;
+	GameBase game({ 64, 64 }, { 64, 64 }, L"LayerManagerTests");
+	LayerManager layerManager;
+	layerManager.SetRenderSize({ 64, 64 });
+	CHECK(layerManager.GetNumLayers() == 0);
+	CHECK(layerManager.FindLayerId("fgGameplay") == InvalidRenderLayerId);
+	CHECK(layerManager.GetDefaultLayerId() == InvalidRenderLayerId);
+
+	// Ids are handed out in registration order
+	std::vector<RenderLayer*> layers;
+	for(size_t layerIdx = 0; layerIdx < s_gameLayerNames.size(); ++layerIdx)
+	{
+		CHECK(layerManager.AddLayer(s_gameLayerNames[layerIdx]) == (RenderLayerId)layerIdx);
+		layers.push_back(layerManager.GetLayer((RenderLayerId)layerIdx));
+		REQUIRE(layers.back() != nullptr);
+	}
+	CHECK(layerManager.GetNumLayers() == s_gameLayerNames.size());
+
+	// Names and ids resolve to each other, and to the same layer
+	for(size_t layerIdx = 0; layerIdx < s_gameLayerNames.size(); ++layerIdx)
+	{
+		const RenderLayerId layerId = (RenderLayerId)layerIdx;
+		CHECK(layerManager.FindLayerId(s_gameLayerNames[layerIdx]) == layerId);
+		CHECK(layerManager.GetLayerName(layerId) == s_gameLayerNames[layerIdx]);
+		CHECK(layerManager.GetLayer(s_gameLayerNames[layerIdx]) == layers[layerIdx]);
+	}
+	CHECK(layerManager.FindLayerId("FGGAMEPLAY") == InvalidRenderLayerId); //< Names are case-sensitive
+
+	// The default layer's id is cached as it's added, and the game's layer enum matches the order GameLoop adds them in
+	CHECK(layerManager.GetDefaultLayerId() == layerManager.FindLayerId(LayerManager::s_defaultLayerName));
+	CHECK(layerManager.GetDefaultLayerId() == RL_FgGameplay);
+	CHECK(layerManager.FindLayerId("fgLightMask") == RL_FgLightMask);
+	CHECK(layerManager.FindLayerId("bkgLightMask") == RL_BkgLightMask);
+	CHECK(layerManager.FindLayerId("lights") == RL_Lights);
+	CHECK(layerManager.FindLayerId("skybox") == RL_Skybox);
+	CHECK(layerManager.FindLayerId("parallax") == RL_Parallax);
+	CHECK(layerManager.FindLayerId("bkgTiles") == RL_BkgTiles);
+	CHECK(layerManager.FindLayerId("fgTiles") == RL_FgTiles);
+	CHECK(layerManager.FindLayerId("hud") == RL_Hud);
+	CHECK(layerManager.GetLayer("missing") == nullptr);
+	CHECK(layerManager.GetLayer((RenderLayerId)s_gameLayerNames.size()) == nullptr);
+	CHECK(layerManager.GetLayer(InvalidRenderLayerId) == nullptr);
+	CHECK(layerManager.GetLayerName(InvalidRenderLayerId).empty());
+
+	// Filling up to the limit doesn't move the layers already registered (ids and pointers are resolved once, at load time)
+	for(size_t layerIdx = s_gameLayerNames.size(); layerIdx < LayerManager::s_maxLayers; ++layerIdx)
+	{
+		CHECK(layerManager.AddLayer("extra" + std::to_string(layerIdx)) == (RenderLayerId)layerIdx);
+	}
+	CHECK(layerManager.GetNumLayers() == LayerManager::s_maxLayers);
+	for(size_t layerIdx = 0; layerIdx < layers.size(); ++layerIdx)
+	{
+		CHECK(layerManager.GetLayer((RenderLayerId)layerIdx) == layers[layerIdx]);
+	}
+	CHECK(layerManager.FindLayerId("extra31") == (RenderLayerId)31);
+
+	// Resizing recreates each layer's render texture in place, so anything holding a layer id follows it to the new texture
+	const auto oldRenderTexture = layers[0]->GetRenderTexture();
+	layerManager.SetRenderSize({ 128, 96 });
+	CHECK(layerManager.GetLayer((RenderLayerId)0) == layers[0]);
+	CHECK(layers[0]->GetRenderTexture() != oldRenderTexture);
+	CHECK((layers[0]->GetRenderTexture()->GetSize() == Vec2u{ 128, 96 }));
+	CHECK(layerManager.FindLayerId("fgGameplay") == (RenderLayerId)6);
+}
+
+TEST_CASE("LayerManager: only drawn layers are cleared, and undrawn layers bind the empty texture")
+{
+	Test::HeadlessScope headless;
+	GameBase game({ 64, 64 }, { 64, 64 }, L"LayerManagerTests");
+	LayerManager layerManager;
+	layerManager.SetRenderSize({ 64, 64 });
+	for(const auto& layerName : s_gameLayerNames)
+	{
+		layerManager.AddLayer(layerName);
+	}
+	const uint32_t numLayers = (uint32_t)s_gameLayerNames.size();
+	const RenderLayerId drawnLayerId = layerManager.FindLayerId("fgGameplay");
+	const RenderTexture* layerTexture = layerManager.GetLayer(drawnLayerId)->GetRenderTexture().get();
+	auto shader = std::make_shared<Shader>("data/shaders/PostProcessLighting");
+
+	// One frame: clear every layer that needs it, draw into the one layer (or not), then bind the layers for post-processing
+	const auto RunFrame = [&](bool in_bDraw) {
+		layerManager.Clear();
+		if(in_bDraw)
+		{
+			const sf::Vertex triangle[3] = { sf::Vertex({ 0.0f, 0.0f }), sf::Vertex({ 8.0f, 0.0f }), sf::Vertex({ 0.0f, 8.0f }) };
+			layerManager.GetLayer(drawnLayerId)->GetRenderTexture()->DrawSFML(triangle, 3, sf::Triangles, sf::RenderStates::Default);
+		}
+		layerManager.FlushSprites();
+		layerManager.BindShaderUniforms(shader);
+	};
+	const auto CheckOthersBoundEmpty = [&]() {
+		const RenderTexture* emptyTexture = layerManager.GetBoundLayerTexture(0);
+		CHECK(emptyTexture != nullptr);
+		for(RenderLayerId layerId = 0; layerId < numLayers; ++layerId)
+		{
+			if(layerId != drawnLayerId)
+			{
+				CHECK(layerManager.GetBoundLayerTexture(layerId) == emptyTexture); //< All share the one empty texture
+				CHECK(layerManager.GetBoundLayerTexture(layerId) != layerManager.GetLayer(layerId)->GetRenderTexture().get());
+			}
+		}
+	};
+
+	// New layers all need their first clear
+	RunFrame(true);
+	CHECK(layerManager.GetNumLayersCleared() == numLayers);
+	CHECK(layerManager.GetNumLayersSkipped() == 0);
+	CHECK(layerManager.GetBoundLayerTexture(drawnLayerId) == layerTexture);
+	CheckOthersBoundEmpty();
+
+	// The drawn layer is cleared the next frame, and binds the empty texture while nothing draws to it...
+	RunFrame(false);
+	CHECK(layerManager.GetNumLayersCleared() == 1);
+	CHECK(layerManager.GetNumLayersSkipped() == numLayers - 1);
+	CHECK(layerManager.GetBoundLayerTexture(drawnLayerId) != layerTexture);
+	CHECK(layerManager.GetBoundLayerTexture(drawnLayerId) == layerManager.GetBoundLayerTexture(0));
+
+	// ...after which it's already clear
+	RunFrame(true);
+	CHECK(layerManager.GetNumLayersCleared() == 0);
+	CHECK(layerManager.GetNumLayersSkipped() == numLayers);
+	CHECK(layerManager.GetBoundLayerTexture(drawnLayerId) == layerTexture);
+	CheckOthersBoundEmpty();
+
+	RunFrame(true);
+	CHECK(layerManager.GetNumLayersCleared() == 1);
+	CHECK(layerManager.GetNumLayersSkipped() == numLayers - 1);
+	CHECK(layerManager.GetBoundLayerTexture(drawnLayerId) == layerTexture);
+
+	// Resizing gives every layer a new texture, which needs its first clear again
+	layerManager.SetRenderSize({ 128, 96 });
+	layerTexture = layerManager.GetLayer(drawnLayerId)->GetRenderTexture().get();
+	RunFrame(true);
+	CHECK(layerManager.GetNumLayersCleared() == numLayers);
+	CHECK(layerManager.GetBoundLayerTexture(drawnLayerId) == layerTexture);
+	CheckOthersBoundEmpty();
+}
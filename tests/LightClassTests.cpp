@@ -0,0 +1,97 @@
+#include "TestFramework.h"
+
+#include "LightClass.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+	const sf::Color s_shadowColor = sf::Color(83, 88, 141);
+	const sf::Color s_penumbraColor = sf::Color(139, 155, 180);
+
+	// PostProcessLighting's rule before light classes: compare the (masked) light colour against the penumbra and unlit colours
+	sf::Color ClassifyLightByColor(sf::Color in_lightColor)
+	{
+		if(in_lightColor.r == 0 && in_lightColor.g == 0 && in_lightColor.b == 0)
+		{
+			return sf::Color(s_shadowColor.r, s_shadowColor.g, s_shadowColor.b);
+		}
+		return sf::Color(in_lightColor.r, in_lightColor.g, in_lightColor.b); //< The penumbra compare only forced alpha, which the output never reads
+	}
+
+	// PostProcessLighting's ClassifyLight(), in floats: decode the class from the alpha, then mix towards the table colour uploaded by BindLightClassTable()
+	sf::Color ClassifyLightLikeShader(sf::Color in_lightColor, uint8_t in_lightAlpha, bool in_maskCovered)
+	{
+		const float lightAlpha = in_lightAlpha / 255.0f;
+		const int32_t lightClass = in_maskCovered ? (int32_t)std::min(lightAlpha * 255.0f + 0.5f, 3.0f) : 0;
+		const LightClassEntry& entry = GetLightClassEntry((eLightClass)lightClass);
+		const float mixAlpha = entry.m_bReplace ? 1.0f : 0.0f;
+		const auto Mix = [mixAlpha](uint8_t in_from, uint8_t in_to) {
+			return (uint8_t)std::lround(in_from + (in_to - in_from) * mixAlpha);
+		};
+		return sf::Color(Mix(in_lightColor.r, entry.m_color.r), Mix(in_lightColor.g, entry.m_color.g), Mix(in_lightColor.b, entry.m_color.b));
+	}
+}
+
+TEST_CASE("LightClass: alpha decodes to the class the shader decodes")
+{
+	CHECK(DecodeLightClass(0) == eLightClass::Unlit);
+	CHECK(DecodeLightClass((uint8_t)eLightClass::Penumbra) == eLightClass::Penumbra);
+	CHECK(DecodeLightClass((uint8_t)eLightClass::Core) == eLightClass::Core);
+
+	// Opaque (and anything else past the last class) is what ordinary alpha-blended sprites leave behind
+	CHECK(DecodeLightClass(255) == eLightClass::Unclassified);
+	for(int32_t alpha = 0; alpha < 256; ++alpha)
+	{
+		const float shaderAlpha = alpha / 255.0f;
+		const int32_t shaderClass = (int32_t)std::min(shaderAlpha * 255.0f + 0.5f, 3.0f);
+		CHECK((int32_t)DecodeLightClass((uint8_t)alpha) == shaderClass);
+	}
+
+	// Lookups past the table clamp to its last entry, like the decode does
+	CHECK(&GetLightClassEntry(eLightClass::Count) == &GetLightClassEntry(eLightClass::Unclassified));
+}
+
+TEST_CASE("LightClass: CPU reference matches the shader table and the old colour compares")
+{
+	// Only unlit pixels are replaced, with the shadow colour
+	CHECK(GetLightClassEntry(eLightClass::Unlit).m_bReplace);
+	CHECK(GetLightClassEntry(eLightClass::Unlit).m_color == s_shadowColor);
+	CHECK(!GetLightClassEntry(eLightClass::Penumbra).m_bReplace);
+	CHECK(!GetLightClassEntry(eLightClass::Core).m_bReplace);
+	CHECK(!GetLightClassEntry(eLightClass::Unclassified).m_bReplace);
+
+	const std::vector<sf::Color> lightColors = { sf::Color::White, s_penumbraColor, sf::Color(255, 214, 170), sf::Color(12, 40, 90), sf::Color::Black };
+	for(const sf::Color& lightColor : lightColors)
+	{
+		for(int32_t alpha = 0; alpha < 256; ++alpha)
+		{
+			for(bool bMaskCovered : { true, false })
+			{
+				const sf::Color classified = ClassifyLight(lightColor, (uint8_t)alpha, bMaskCovered);
+				CHECK(classified.a == 255);
+				CHECK(classified == ClassifyLightLikeShader(lightColor, (uint8_t)alpha, bMaskCovered));
+			}
+		}
+	}
+
+	// What each kind of pixel looked like under the old compares:
+	// light sprites (core and penumbra, with their class written into the alpha)
+	CHECK(ClassifyLight(sf::Color::White, (uint8_t)eLightClass::Core) == ClassifyLightByColor(sf::Color::White));
+	CHECK(ClassifyLight(sf::Color(255, 214, 170), (uint8_t)eLightClass::Core) == ClassifyLightByColor(sf::Color(255, 214, 170)));
+	CHECK(ClassifyLight(s_penumbraColor, (uint8_t)eLightClass::Penumbra) == ClassifyLightByColor(s_penumbraColor));
+
+	// the lights layer's clear (transparent black)
+	CHECK(ClassifyLight(sf::Color::Black, 0) == ClassifyLightByColor(sf::Color::Black));
+
+	// other sprites drawn into the lights layer with ordinary blending
+	CHECK(ClassifyLight(sf::Color(12, 40, 90), 255) == ClassifyLightByColor(sf::Color(12, 40, 90)));
+
+	// light terms where the light mask has nothing drawn (the mask's clear multiplies the light down to black)
+	for(const sf::Color& lightColor : lightColors)
+	{
+		CHECK(ClassifyLight(lightColor * sf::Color::Transparent, (uint8_t)eLightClass::Core, false) == ClassifyLightByColor(lightColor * sf::Color::Transparent));
+	}
+}
@@ -0,0 +1,226 @@
+#include "TestFramework.h"
+#include "HeadlessScope.h"
+
+#include "Engine/Object.h"
+#include "Engine/ObjectArena.h"
+#include "Engine/Actor.h"
+#include "Engine/Game.h"
+#include "Engine/LayerManager.h"
+#include "Engine/Components/SpriteComponent.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace
+{
+	// Opts in to arena allocation, and is only made by these tests, so its arena starts out empty
+	class ArenaTestObject : public Object
+	{
+	public:
+		static constexpr bool s_bUseObjectArena = true;
+		uint8_t m_payload[200] = {};
+	};
+
+	uintptr_t GetAddress(const std::shared_ptr<ArenaTestObject>& in_obj)
+	{
+		return reinterpret_cast<uintptr_t>(in_obj.get());
+	}
+
+	void DestroyObject(std::shared_ptr<ArenaTestObject>& inout_obj)
+	{
+		inout_obj->Destroy();
+		inout_obj.reset();
+	}
+
+	// A sprite made the way Actor::MakeSprite() makes it (minus attaching it and adding it to the actor's draw list)
+	std::shared_ptr<SpriteComponent> MakeArenaSprite(const std::shared_ptr<Actor>& in_actor)
+	{
+		return Object::MakeWithInit<SpriteComponent>(in_actor, [&in_actor](const std::shared_ptr<SpriteComponent>& in_comp) {
+			in_comp->SetActor(in_actor);
+		});
+	}
+	// The same, but allocated the way Object::Make() allocated everything before arenas
+	std::shared_ptr<SpriteComponent> MakeHeapSprite(const std::shared_ptr<Actor>& in_actor)
+	{
+		auto sprite = std::make_shared<SpriteComponent>();
+		sprite->SetOwner(in_actor);
+		sprite->SetActor(in_actor);
+		sprite->Initialize();
+		return sprite;
+	}
+}
+
+TEST_CASE("ObjectArena: objects made one after another are contiguous in their type's arena")
+{
+	auto owner = Object::MakeRoot();
+	const ObjectArenaStats& stats = Object::GetArenaStats<ArenaTestObject>();
+	CHECK(stats.m_numAllocations == 0);
+	CHECK(stats.m_blockSize == 0);
+
+	std::vector<std::shared_ptr<ArenaTestObject>> objects;
+	for(size_t i = 0; i < ObjectArena::s_blocksPerChunk + 10; ++i)
+	{
+		objects.push_back(Object::Make<ArenaTestObject>(owner));
+	}
+
+	// The object and its shared pointer control block share one block, which is rounded up to keep the next block aligned
+	CHECK(stats.m_blockSize >= sizeof(ArenaTestObject));
+	CHECK(stats.m_blockSize % alignof(std::max_align_t) == 0);
+	CHECK(stats.m_numAllocations == objects.size());
+	CHECK(stats.m_numFallbacks == 0);
+	CHECK(stats.m_numLive == objects.size());
+	CHECK(stats.m_numChunks == 2);
+	CHECK(stats.m_numBlocks == 2 * ObjectArena::s_blocksPerChunk);
+
+	// Each chunk's blocks are handed out in address order
+	for(size_t i = 1; i < ObjectArena::s_blocksPerChunk; ++i)
+	{
+		CHECK(GetAddress(objects[i]) - GetAddress(objects[i - 1]) == stats.m_blockSize);
+	}
+	for(size_t i = ObjectArena::s_blocksPerChunk + 1; i < objects.size(); ++i)
+	{
+		CHECK(GetAddress(objects[i]) - GetAddress(objects[i - 1]) == stats.m_blockSize);
+	}
+
+	owner->Destroy();
+	objects.clear();
+	CHECK(stats.m_numLive == 0);
+	CHECK(stats.m_numChunks == 2); //< Chunks are kept for the next objects
+}
+
+TEST_CASE("ObjectArena: freed blocks are reused most recent first, once the last weak pointer lets go")
+{
+	auto owner = Object::MakeRoot();
+	const ObjectArenaStats& stats = Object::GetArenaStats<ArenaTestObject>();
+	const size_t numLive = stats.m_numLive;
+
+	std::vector<std::shared_ptr<ArenaTestObject>> objects;
+	for(int32_t i = 0; i < 10; ++i)
+	{
+		objects.push_back(Object::Make<ArenaTestObject>(owner));
+	}
+	const size_t numChunks = stats.m_numChunks;
+	const uintptr_t addr3 = GetAddress(objects[3]);
+	const uintptr_t addr7 = GetAddress(objects[7]);
+
+	// The block stays allocated while a weak pointer still needs the control block in it
+	std::weak_ptr<ArenaTestObject> weakObj = objects[3];
+	DestroyObject(objects[3]);
+	CHECK(weakObj.expired());
+	CHECK(stats.m_numLive == numLive + 10);
+	weakObj.reset();
+	CHECK(stats.m_numLive == numLive + 9);
+
+	DestroyObject(objects[7]);
+	CHECK(stats.m_numLive == numLive + 8);
+	objects[7] = Object::Make<ArenaTestObject>(owner);
+	objects[3] = Object::Make<ArenaTestObject>(owner);
+	CHECK(GetAddress(objects[7]) == addr7);
+	CHECK(GetAddress(objects[3]) == addr3);
+	CHECK(stats.m_numLive == numLive + 10);
+	CHECK(stats.m_numChunks == numChunks); //< Reusing blocks never needs a new chunk
+
+	owner->Destroy();
+	objects.clear();
+	CHECK(stats.m_numLive == numLive);
+}
+
+TEST_CASE("ObjectArena: allocations that don't match the block size go to the regular heap")
+{
+	const size_t align = alignof(std::max_align_t);
+	const size_t blockSize = (100 + align - 1) / align * align;
+	ObjectArena arena;
+	void* block = arena.Allocate(100);
+	CHECK(arena.GetStats().m_blockSize == blockSize);
+	void* smallerBlock = arena.Allocate(blockSize - align + 1); //< Rounds up to the same block size
+	CHECK(reinterpret_cast<uintptr_t>(smallerBlock) - reinterpret_cast<uintptr_t>(block) == blockSize);
+	void* bigBlock = arena.Allocate(blockSize + 1);
+	CHECK(arena.GetStats().m_numAllocations == 3);
+	CHECK(arena.GetStats().m_numFallbacks == 1);
+	CHECK(arena.GetStats().m_numLive == 2);
+
+	arena.Free(bigBlock, blockSize + 1);
+	arena.Free(smallerBlock, blockSize - align + 1);
+	arena.Free(block, 100);
+	CHECK(arena.GetStats().m_numLive == 0);
+	CHECK(arena.Allocate(100) == block);
+}
+
+TEST_CASE("ObjectArena: sprite components are allocated from their arena")
+{
+	Test::HeadlessScope headless;
+	GameBase game({ 64, 64 }, { 64, 64 }, L"ObjectArenaTests");
+	GetWindow()->GetLayerManager()->AddLayer("fgGameplay"); //< Sprites start out on it
+	auto owner = Object::MakeRoot();
+	auto actor = std::make_shared<Actor>();
+	actor->SetOwner(owner);
+
+	const ObjectArenaStats& stats = Object::GetArenaStats<SpriteComponent>();
+	const uint64_t numAllocations = stats.m_numAllocations;
+	const uint64_t numFallbacks = stats.m_numFallbacks;
+	const size_t numLive = stats.m_numLive;
+	std::vector<std::shared_ptr<SpriteComponent>> sprites;
+	for(int32_t i = 0; i < 10; ++i)
+	{
+		sprites.push_back(MakeArenaSprite(actor));
+	}
+	CHECK(stats.m_blockSize >= sizeof(SpriteComponent));
+	CHECK(stats.m_numAllocations == numAllocations + 10);
+	CHECK(stats.m_numFallbacks == numFallbacks);
+	CHECK(stats.m_numLive == numLive + 10);
+
+	// Sprites made with make_shared don't touch the arena
+	auto heapSprite = MakeHeapSprite(actor);
+	CHECK(stats.m_numAllocations == numAllocations + 10);
+
+	for(auto& sprite : sprites)
+	{
+		sprite->Destroy();
+	}
+	sprites.clear();
+	heapSprite->Destroy();
+	heapSprite.reset();
+	CHECK(stats.m_numLive == numLive);
+}
+
+BENCHMARK_CASE("ObjectArena: create and destroy 100k sprite components")
+{
+	Test::HeadlessScope headless;
+	GameBase game({ 64, 64 }, { 64, 64 }, L"ObjectArenaTests");
+	GetWindow()->GetLayerManager()->AddLayer("fgGameplay");
+	auto owner = Object::MakeRoot();
+	auto actor = std::make_shared<Actor>();
+	actor->SetOwner(owner);
+
+	const auto Run = [&actor](const char* in_label, std::shared_ptr<SpriteComponent> (*in_makeSprite)(const std::shared_ptr<Actor>&)) {
+		std::vector<std::shared_ptr<SpriteComponent>> sprites;
+		for(const int32_t batchSize : { 1, 100, 1000 })
+		{
+			sprites.reserve(batchSize);
+			const std::string label = std::string(in_label) + ", batches of " + std::to_string(batchSize);
+			Test::Measure(label.c_str(), 5, [&]() {
+				for(int32_t numMade = 0; numMade < 100000; numMade += batchSize)
+				{
+					for(int32_t i = 0; i < batchSize; ++i)
+					{
+						sprites.push_back(in_makeSprite(actor));
+					}
+					for(auto& sprite : sprites)
+					{
+						sprite->Destroy();
+					}
+					sprites.clear();
+				}
+			});
+		}
+	};
+	const ObjectArenaStats& stats = Object::GetArenaStats<SpriteComponent>();
+	const size_t numLive = stats.m_numLive;
+	const uint64_t numFallbacks = stats.m_numFallbacks;
+	Run("make_shared", &MakeHeapSprite);
+	Run("arena", &MakeArenaSprite);
+	CHECK(stats.m_numLive == numLive);
+	CHECK(stats.m_numFallbacks == numFallbacks);
+	CHECK(stats.m_numChunks * ObjectArena::s_blocksPerChunk == stats.m_numBlocks);
+}
@@ -0,0 +1,196 @@
+#include "TestFramework.h"
+#include "HeadlessScope.h"
+
+#include "Engine/Object.h"
+#include "Engine/Actor.h"
+#include "Engine/Game.h"
+
+#include <memory>
+
+namespace
+{
+	// Counts how often it's copied and moved (reset before each call being measured)
+	struct CopyCounter
+	{
+		static int32_t s_numCopies;
+		static int32_t s_numMoves;
+		static void Reset()
+		{
+			s_numCopies = 0;
+			s_numMoves = 0;
+		}
+
+		CopyCounter() = default;
+		CopyCounter(const CopyCounter&) { ++s_numCopies; }
+		CopyCounter(CopyCounter&&) noexcept { ++s_numMoves; }
+		CopyCounter& operator=(const CopyCounter&)
+		{
+			++s_numCopies;
+			return *this;
+		}
+		CopyCounter& operator=(CopyCounter&&) noexcept
+		{
+			++s_numMoves;
+			return *this;
+		}
+	};
+	int32_t CopyCounter::s_numCopies = 0;
+	int32_t CopyCounter::s_numMoves = 0;
+
+	// Takes its argument by const reference, like most constructors taking defs
+	class RefArgObject : public Object
+	{
+	public:
+		RefArgObject(const CopyCounter&) {}
+		int32_t m_numInitCalls = 0;
+		bool m_bInitializedBeforeInit = false;
+	};
+	// Takes its argument by value and keeps it
+	class ValueArgObject : public Object
+	{
+	public:
+		ValueArgObject(CopyCounter in_counter)
+			: m_counter(std::move(in_counter))
+		{
+		}
+		CopyCounter m_counter;
+	};
+	// Only constructible from a move-only argument
+	class MoveOnlyArgObject : public Object
+	{
+	public:
+		MoveOnlyArgObject(std::unique_ptr<int32_t> in_value)
+			: m_value(std::move(in_value))
+		{
+		}
+		std::unique_ptr<int32_t> m_value;
+	};
+
+	// Init functor that carries a CopyCounter, so copies of the functor itself are counted too
+	struct CountingInitFunc
+	{
+		CopyCounter m_counter;
+		void operator()(const std::shared_ptr<RefArgObject>& in_obj) const
+		{
+			++in_obj->m_numInitCalls;
+			in_obj->m_bInitializedBeforeInit = in_obj->IsInitialized();
+		}
+	};
+
+	class ArgActor : public Actor
+	{
+	public:
+		ArgActor(const CopyCounter& in_counter, std::unique_ptr<int32_t> in_value)
+			: m_value(std::move(in_value))
+		{
+		}
+		std::unique_ptr<int32_t> m_value;
+		int32_t m_numInitCalls = 0;
+	};
+}
+
+TEST_CASE("ObjectFactory: constructor arguments reach the constructor without extra copies")
+{
+	auto owner = Object::MakeRoot();
+	CopyCounter counter;
+
+	// Const reference constructors never copy
+	CopyCounter::Reset();
+	auto refObj = Object::Make<RefArgObject>(owner, counter);
+	CHECK(CopyCounter::s_numCopies == 0);
+	CHECK(CopyCounter::s_numMoves == 0);
+	CopyCounter::Reset();
+	auto childObj = owner->MakeChild<RefArgObject>(counter);
+	CHECK(CopyCounter::s_numCopies == 0);
+	CHECK(CopyCounter::s_numMoves == 0);
+	CHECK(childObj->GetOwner() == owner);
+
+	// By-value constructors copy an lvalue once (into the parameter) and move it from there, and only move an rvalue
+	CopyCounter::Reset();
+	auto valueObj = Object::Make<ValueArgObject>(owner, counter);
+	CHECK(CopyCounter::s_numCopies == 1);
+	CHECK(CopyCounter::s_numMoves == 1);
+	CopyCounter::Reset();
+	valueObj = Object::Make<ValueArgObject>(owner, CopyCounter{});
+	CHECK(CopyCounter::s_numCopies == 0);
+	CHECK(CopyCounter::s_numMoves == 2);
+
+	// Move-only arguments go straight through
+	auto moveOnlyObj = Object::Make<MoveOnlyArgObject>(owner, std::make_unique<int32_t>(7));
+	REQUIRE(moveOnlyObj->m_value != nullptr);
+	CHECK(*moveOnlyObj->m_value == 7);
+	auto value = std::make_unique<int32_t>(8);
+	moveOnlyObj = owner->MakeChild<MoveOnlyArgObject>(std::move(value));
+	CHECK(value == nullptr);
+	CHECK(*moveOnlyObj->m_value == 8);
+
+	owner->Destroy();
+}
+
+TEST_CASE("ObjectFactory: init functors are called once, inline, before Initialize()")
+{
+	auto owner = Object::MakeRoot();
+	CopyCounter counter;
+
+	// Neither lvalue nor rvalue functors are copied (or moved), and neither are the arguments
+	CountingInitFunc initFunc;
+	CopyCounter::Reset();
+	auto obj = Object::MakeWithInit<RefArgObject>(owner, initFunc, counter);
+	CHECK(CopyCounter::s_numCopies == 0);
+	CHECK(CopyCounter::s_numMoves == 0);
+	CHECK(obj->m_numInitCalls == 1);
+	CHECK(!obj->m_bInitializedBeforeInit);
+	CHECK(obj->IsInitialized());
+
+	CopyCounter::Reset();
+	obj = owner->MakeChildWithInit<RefArgObject>(CountingInitFunc{}, counter);
+	CHECK(CopyCounter::s_numCopies == 0);
+	CHECK(CopyCounter::s_numMoves == 0);
+	CHECK(obj->m_numInitCalls == 1);
+	CHECK(obj->GetOwner() == owner);
+
+	// Capturing lambdas are fine, even move-only ones (which a std::function couldn't hold)
+	CopyCounter::Reset();
+	obj = Object::MakeWithInit<RefArgObject>(owner, [&counter, value = std::make_unique<int32_t>(3)](const std::shared_ptr<RefArgObject>& in_obj) {
+		in_obj->m_numInitCalls += *value;
+	}, counter);
+	CHECK(CopyCounter::s_numCopies == 0);
+	CHECK(obj->m_numInitCalls == 3);
+
+	// Both at once
+	auto moveOnlyObj = Object::MakeWithInit<MoveOnlyArgObject>(owner, [](const std::shared_ptr<MoveOnlyArgObject>& in_obj) {
+		*in_obj->m_value += 1;
+	}, std::make_unique<int32_t>(4));
+	CHECK(*moveOnlyObj->m_value == 5);
+
+	owner->Destroy();
+}
+
+TEST_CASE("ObjectFactory: actor spawns forward arguments and init functors the same way")
+{
+	Test::HeadlessScope headless;
+	GameBase game({ 64, 64 }, { 64, 64 }, L"ObjectFactoryTests"); //< Actors register with the game when they're initialized
+	auto owner = Object::MakeRoot();
+	CopyCounter counter;
+	const Transform transform = { Vec2f{ 10.0f, 20.0f } };
+
+	CopyCounter::Reset();
+	auto actor = Actor::Spawn<ArgActor>(owner, transform, counter, std::make_unique<int32_t>(1));
+	CHECK(CopyCounter::s_numCopies == 0);
+	CHECK(CopyCounter::s_numMoves == 0);
+	CHECK(*actor->m_value == 1);
+	CHECK(actor->GetWorldPos() == transform.pos);
+
+	CopyCounter::Reset();
+	auto childActor = actor->SpawnWithInit<ArgActor>(transform, [counter, &transform](const std::shared_ptr<ArgActor>& in_actor) {
+		++in_actor->m_numInitCalls;
+		CHECK(in_actor->GetWorldPos() == transform.pos); //< The transform is set before the init functor runs
+	}, counter, std::make_unique<int32_t>(2));
+	CHECK(CopyCounter::s_numCopies == 1); //< The lambda's capture, and nothing else
+	CHECK(CopyCounter::s_numMoves == 0);
+	CHECK(childActor->m_numInitCalls == 1);
+	CHECK(*childActor->m_value == 2);
+	CHECK(childActor->GetOwner() == actor);
+
+	owner->Destroy();
+}
@@ -0,0 +1,204 @@
+#include "TestFramework.h"
+#include "HeadlessScope.h"
+
+#include "ParticleManager.h"
+#include "ParticleSpawnerDefs.h"
+#include "Engine/GridBitset.h"
+#include "Engine/MathGeometry.h"
+
+#include <random>
+
+// These load the particles' anims by relative path, so run the tests from the repo root (the project's default working directory)
+
+namespace
+{
+	// The old actor-per-particle motion (Particle::ManageActor() and Particle::Move()): velocity was kept as a direction and a speed,
+	// rebuilt into a vector every tick, and gravity was applied per tick
+	struct ActorParticle
+	{
+		Vec2f m_pos;
+		float m_direction = 0.0f;
+		float m_speed = 0.0f;
+		std::optional<Vec2f> m_dirOverride;
+		bool m_bDead = false;
+	};
+	void UpdateActorParticle(ActorParticle& inout_particle, const ParticleSpawnerDef& in_def, float in_dt, const Transform& in_gridToWorldTM,
+		const GridBitset& in_solidCells)
+	{
+		Vec2f vel = Math::DegreesToVec(inout_particle.m_direction) * inout_particle.m_speed;
+		Vec2f dirOverride = inout_particle.m_dirOverride.value_or(Vec2f::Zero);
+		const Vec2f moveDelta = (vel + dirOverride) * in_dt;
+		std::optional<Math::BoxSweepResults> sweepResults;
+		if(in_def.collideWorld)
+		{
+			sweepResults = Math::SweepBoxAgainstGrid(Box2f::FromCenter(inout_particle.m_pos, in_def.collisionBoxDims), moveDelta, in_gridToWorldTM, in_solidCells);
+		}
+		if(sweepResults.has_value())
+		{
+			if(in_def.bounce)
+			{
+				const Vec2f normalUpVec = sweepResults.value().m_normal;
+				const Vec2f normalRightVec = normalUpVec.RotateDeg(-90.0f);
+				const Vec2f bounceVec = (normalRightVec * vel.Dot(normalRightVec) + (normalUpVec * vel.Dot(normalUpVec) * -1.0f));
+				inout_particle.m_direction = bounceVec.SignedAngleDeg();
+				inout_particle.m_speed = bounceVec.Len() * in_def.bounce;
+				inout_particle.m_pos += normalUpVec * sweepResults.value().m_dist;
+			}
+			else
+			{
+				inout_particle.m_bDead = true;
+			}
+		}
+		else
+		{
+			inout_particle.m_pos += moveDelta;
+		}
+
+		vel = Math::DegreesToVec(inout_particle.m_direction) * inout_particle.m_speed;
+		vel.y -= in_def.gravity;
+		inout_particle.m_speed = vel.Len();
+		inout_particle.m_direction = vel.SignedAngleDeg();
+		if(inout_particle.m_dirOverride.has_value())
+		{
+			inout_particle.m_dirOverride.value().y -= in_def.gravity;
+		}
+	}
+
+	// A floor (the grid row covering y -32 to -16) between two walls, on a 16x16 grid
+	GridBitset MakeFloorCells()
+	{
+		GridBitset solidCells;
+		solidCells.Reset({ -40, -10, 80, 20 });
+		for(int32_t col = -40; col < 40; ++col)
+		{
+			solidCells.Set({ col, -2 }, true);
+		}
+		for(int32_t row = -10; row < 10; ++row)
+		{
+			solidCells.Set({ -20, row }, true);
+			solidCells.Set({ 19, row }, true);
+		}
+		return solidCells;
+	}
+	Transform MakeGridToWorldTM()
+	{
+		Transform gridToWorldTM = Transform::Identity;
+		gridToWorldTM.scale = { 16.0f, 16.0f };
+		return gridToWorldTM;
+	}
+
+	// Spawns the same particles into the manager and as old-style actor particles, then steps both and compares where they end up
+	void CompareTrajectories(const ParticleSpawnerDef& in_def, int32_t in_numTicks, bool in_bDirOverride, float in_tolerance)
+	{
+		const GridBitset solidCells = MakeFloorCells();
+		const Transform gridToWorldTM = MakeGridToWorldTM();
+		auto particleManager = std::make_shared<ParticleManager>();
+		const uint16_t defIdx = particleManager->RegisterDef(in_def);
+		const uint32_t spawnerId = particleManager->MakeSpawnerId();
+
+		std::mt19937 rng(21);
+		std::uniform_real_distribution<float> directionDist(0.0f, 360.0f);
+		std::uniform_real_distribution<float> speedDist(120.0f, 620.0f); //< The player death debris' speeds
+		std::vector<ActorParticle> actorParticles;
+		for(int32_t i = 0; i < 100; ++i)
+		{
+			ParticleSpawnParams params;
+			params.lifetime = 100.0f;
+			params.direction = directionDist(rng);
+			params.speed = speedDist(rng);
+			if(in_bDirOverride)
+			{
+				params.dirOverride = Vec2f{ 30.0f, 40.0f };
+			}
+			particleManager->SpawnParticle(defIdx, spawnerId, { 0.0f, 8.0f }, params);
+			actorParticles.push_back({ { 0.0f, 8.0f }, params.direction, params.speed, params.dirOverride });
+		}
+
+		const float dt = 1.0f / 60.0f;
+		float maxDist = 0.0f;
+		for(int32_t tick = 0; tick < in_numTicks; ++tick)
+		{
+			particleManager->UpdateParticles(dt, gridToWorldTM, solidCells);
+
+			for(auto& actorParticle : actorParticles)
+			{
+				UpdateActorParticle(actorParticle, in_def, dt, gridToWorldTM, solidCells);
+			}
+
+			// The manager swap-removes dead particles, so match its order
+			for(size_t particleIdx = actorParticles.size(); particleIdx-- > 0;)
+			{
+				if(actorParticles[particleIdx].m_bDead)
+				{
+					actorParticles[particleIdx] = actorParticles.back();
+					actorParticles.pop_back();
+				}
+			}
+			REQUIRE(particleManager->GetParticleCount() == actorParticles.size());
+			for(size_t particleIdx = 0; particleIdx < actorParticles.size(); ++particleIdx)
+			{
+				maxDist = Math::Max(maxDist, (particleManager->GetParticlePos(particleIdx) - actorParticles[particleIdx].m_pos).Len());
+			}
+		}
+		CHECK(maxDist < in_tolerance);
+		CHECK(particleManager->GetParticleCount(spawnerId) == actorParticles.size());
+	}
+}
+
+TEST_CASE("ParticleManager: free-flying particles follow the old per-actor trajectories")
+{
+	Test::HeadlessScope headless;
+
+	// Storing the velocity as a vector instead of rebuilding it from an angle every tick only drifts by float rounding, even over 6s
+	CompareTrajectories(g_crawlerDeathExplosionDef0, 360, false, 0.05f);
+	CompareTrajectories(g_crawlerDeathExplosionDef0, 360, true, 0.05f);
+}
+
+TEST_CASE("ParticleManager: particles hitting the world bounce or die like the old per-actor particles")
+{
+	Test::HeadlessScope headless;
+
+	// Bouncing debris, over its first second (most bounce at least once). past that, debris settling on the floor bounces at tiny speeds,
+	// where the rounding differences decide each bounce, so the two drift apart without either being wrong
+	CompareTrajectories(g_playerDeathExplosionDef, 60, false, 0.05f);
+
+	// Non-bouncing particles die on the tick they hit the world
+	ParticleSpawnerDef dieOnHitDef = g_playerDeathExplosionDef;
+	dieOnHitDef.bounce = 0.0f;
+	CompareTrajectories(dieOnHitDef, 120, false, 0.05f);
+}
+
+BENCHMARK_CASE("ParticleManager: spawn and update 10k particles")
+{
+	Test::HeadlessScope headless;
+	const GridBitset solidCells = MakeFloorCells();
+	const Transform gridToWorldTM = MakeGridToWorldTM();
+	const auto Run = [&solidCells, &gridToWorldTM](const char* in_label, const ParticleSpawnerDef& in_def) {
+		std::mt19937 rng(10);
+		std::uniform_real_distribution<float> directionDist(0.0f, 360.0f);
+		std::uniform_real_distribution<float> speedDist(120.0f, 620.0f);
+		std::shared_ptr<ParticleManager> particleManager;
+		const auto Spawn = [&]() {
+			particleManager = std::make_shared<ParticleManager>();
+			const uint16_t defIdx = particleManager->RegisterDef(in_def);
+			const uint32_t spawnerId = particleManager->MakeSpawnerId();
+			for(int32_t i = 0; i < 10000; ++i)
+			{
+				ParticleSpawnParams params;
+				params.lifetime = 100.0f;
+				params.direction = directionDist(rng);
+				params.speed = speedDist(rng);
+				particleManager->SpawnParticle(defIdx, spawnerId, { 0.0f, 8.0f }, params);
+			}
+		};
+		Test::Measure((std::string(in_label) + ", spawn").c_str(), 20, Spawn);
+		Test::Measure((std::string(in_label) + ", update").c_str(), 200, [&]() {
+			particleManager->UpdateParticles(1.0f / 60.0f, gridToWorldTM, solidCells);
+		});
+		CHECK(particleManager->GetParticleCount() == 10000);
+	};
+	Run("free-flying", g_crawlerDeathExplosionDef0);
+	ParticleSpawnerDef bouncingDef = g_playerDeathExplosionDef;
+	bouncingDef.animBlink = false; //< Keeps the debris that settles on the floor from flickering out mid-benchmark
+	Run("bouncing off the world", bouncingDef);
+}
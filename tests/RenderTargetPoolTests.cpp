@@ -0,0 +1,113 @@
+#include "TestFramework.h"
+#include "HeadlessScope.h"
+
+#include "Engine/RenderTargetPool.h"
+#include "Engine/RenderTexture.h"
+
+#include <vector>
+
+TEST_CASE("RenderTargetPool: size classes round up by at most a quarter and pick the smallest fit")
+{
+	CHECK((RenderTargetPool::GetSizeClass({ 1, 1 }) == Vec2u{ 64, 64 }));
+	CHECK((RenderTargetPool::GetSizeClass({ 64, 65 }) == Vec2u{ 64, 128 }));
+	CHECK((RenderTargetPool::GetSizeClass({ 1344, 960 }) == Vec2u{ 1536, 960 })); //< GameLoop's render size at 4x
+	CHECK((RenderTargetPool::GetSizeClass({ 1536, 960 }) == Vec2u{ 1536, 960 }));
+	CHECK((RenderTargetPool::GetSizeClass({ 3840, 2160 }) == Vec2u{ 3840, 2432 })); //< A 4K window (powers of two made this 4096x4096)
+
+	// Classes are multiples of the minimum, and never waste more than a quarter (plus rounding up to the next multiple)
+	for(uint32_t dim = 1; dim <= 8192; ++dim)
+	{
+		const uint32_t sizeClass = RenderTargetPool::GetSizeClass({ dim, 1 }).x;
+		REQUIRE(sizeClass >= dim);
+		REQUIRE(sizeClass % RenderTargetPool::s_minSizeClass == 0);
+		REQUIRE(sizeClass <= dim + dim / 4 + RenderTargetPool::s_minSizeClass);
+	}
+
+	// Classes are clamped to the max texture size, but never below the size asked for
+	CHECK((RenderTargetPool::GetSizeClass({ 3000, 4000 }, 4096) == Vec2u{ 3072, 4096 }));
+	CHECK((RenderTargetPool::GetSizeClass({ 5000, 64 }, 4096) == Vec2u{ 5000, 64 }));
+
+	const std::vector<Vec2u> sizeClasses = { { 512, 512 }, { 256, 1024 }, { 256, 256 }, { 1024, 256 } };
+	CHECK(RenderTargetPool::FindBestFit({}, { 1, 1 }) == -1);
+	CHECK(RenderTargetPool::FindBestFit(sizeClasses, { 200, 200 }) == 2);
+	CHECK(RenderTargetPool::FindBestFit(sizeClasses, { 256, 256 }) == 2); //< Exact fits count
+	CHECK(RenderTargetPool::FindBestFit(sizeClasses, { 300, 200 }) == 0); //< Ties on area go to the first one
+	CHECK(RenderTargetPool::FindBestFit(sizeClasses, { 200, 600 }) == 1);
+	CHECK(RenderTargetPool::FindBestFit(sizeClasses, { 600, 600 }) == -1);
+}
+
+TEST_CASE("RenderTargetPool: targets are reused for smaller sizes and the least recently acquired is evicted")
+{
+	Test::HeadlessScope headless;
+	RenderTargetPool pool;
+
+	// Growing a window allocates a target per size class it passes through
+	const auto target = pool.Acquire({ 336, 240 });
+	REQUIRE(target != nullptr);
+	CHECK((target->GetSize() == Vec2u{ 448, 256 }));
+	CHECK((target->GetContentSize() == Vec2u{ 336, 240 }));
+	CHECK(pool.GetNumAllocations() == 1);
+
+	// Anything that fits reuses it, with only the content size changed
+	CHECK(pool.Acquire({ 400, 250 }) == target);
+	CHECK((target->GetContentSize() == Vec2u{ 400, 250 }));
+	CHECK(pool.Acquire({ 1, 1 }) == target);
+	CHECK(pool.GetNumAllocations() == 1);
+
+	const auto bigTarget = pool.Acquire({ 672, 480 });
+	CHECK(bigTarget != target);
+	CHECK((bigTarget->GetSize() == Vec2u{ 768, 576 }));
+	CHECK(pool.GetNumTargets() == 2);
+
+	// Shrinking back picks the smallest target that fits, not the most recent one
+	CHECK(pool.Acquire({ 336, 240 }) == target);
+	CHECK(pool.Acquire({ 672, 480 }) == bigTarget);
+	CHECK(pool.GetNumAllocations() == 2);
+	CHECK(pool.GetNumEvictions() == 0);
+
+	// Fill the pool with ever-wider targets (each too wide for the earlier ones to fit the later sizes)
+	CHECK((pool.Acquire({ 1500, 64 })->GetSize() == Vec2u{ 1536, 64 }));
+	CHECK((pool.Acquire({ 3000, 64 })->GetSize() == Vec2u{ 3072, 64 }));
+	CHECK(pool.GetNumTargets() == RenderTargetPool::s_maxTargets);
+
+	// Touch the first target, so the next allocation evicts the 768x576 one (least recently acquired) instead
+	CHECK(pool.Acquire({ 336, 240 }) == target);
+	const auto tallTarget = pool.Acquire({ 64, 2000 });
+	CHECK((tallTarget->GetSize() == Vec2u{ 64, 2432 }));
+	CHECK(pool.GetNumTargets() == RenderTargetPool::s_maxTargets);
+	CHECK(pool.GetNumEvictions() == 1);
+	CHECK(pool.Acquire({ 336, 240 }) == target);
+	CHECK(pool.GetNumAllocations() == 5);
+
+	// An evicted target stays alive for whoever still holds it, but isn't handed out again
+	CHECK((bigTarget->GetSize() == Vec2u{ 768, 576 }));
+	const auto newBigTarget = pool.Acquire({ 672, 480 });
+	CHECK(newBigTarget != bigTarget);
+	CHECK(pool.GetNumAllocations() == 6);
+	CHECK(pool.GetNumEvictions() == 2);
+
+	pool.Clear();
+	CHECK(pool.GetNumTargets() == 0);
+	CHECK(pool.Acquire({ 336, 240 }) != target);
+}
+
+TEST_CASE("RenderTargetPool: growing a target's content makes its next clear count")
+{
+	// Clears only cover the content, so the texels the content grows into still need clearing
+	Test::HeadlessScope headless;
+	RenderTargetPool pool;
+	const auto target = pool.Acquire({ 336, 240 });
+	CHECK(target->Clear(sf::Color::Black));
+	CHECK(!target->Clear(sf::Color::Black));
+
+	// Shrinking leaves nothing uncleared...
+	CHECK(pool.Acquire({ 200, 200 }) == target);
+	CHECK(!target->Clear(sf::Color::Black));
+
+	// ...but growing back does, even to a size it was cleared at before
+	CHECK(pool.Acquire({ 336, 200 }) == target);
+	CHECK(target->Clear(sf::Color::Black));
+	CHECK(!target->Clear(sf::Color::Black));
+	CHECK(pool.Acquire({ 336, 240 }) == target);
+	CHECK(target->Clear(sf::Color::Black));
+}
@@ -0,0 +1,322 @@
+#include "TestFramework.h"
+
+#include "GameEnums.h"
+#include "SensorManager.h"
+#include "Engine/Components/SensorComponent.h"
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+
+namespace
+{
+	using tSensorPtr = std::shared_ptr<SensorComponent>;
+	using tSensorPairSet = std::set<std::pair<const SensorComponent*, const SensorComponent*>>;
+
+	std::pair<const SensorComponent*, const SensorComponent*> MakePairKey(const tSensorPtr& in_a, const tSensorPtr& in_b)
+	{
+		return std::minmax(in_a.get(), in_b.get());
+	}
+
+	tSensorPtr MakeSensor(const Vec2f& in_pos, const SensorShape& in_shape, uint32_t in_category, uint32_t in_mask)
+	{
+		auto sensor = std::make_shared<SensorComponent>();
+		sensor->SetShape(in_shape);
+		sensor->SetFiltering(in_category, in_mask);
+		sensor->SetWorldPos(in_pos);
+		return sensor;
+	}
+
+	// Tracks the currently-touching pairs reported through the sensors' touch callbacks
+	void TrackTouches(const tSensorPtr& in_sensor, tSensorPairSet& in_touches)
+	{
+		std::weak_ptr<SensorComponent> weakSensor = in_sensor;
+		in_sensor->SetTouchCallback([weakSensor, &in_touches](bool in_bOnTouch, tSensorPtr in_other) {
+			const auto key = MakePairKey(weakSensor.lock(), in_other);
+			if(in_bOnTouch)
+			{
+				in_touches.insert(key);
+			}
+			else
+			{
+				in_touches.erase(key);
+			}
+		});
+	}
+
+	// Logs touch callbacks as "<name>+<other>" (touch) or "<name>-<other>" (untouch)
+	void LogTouches(const tSensorPtr& in_sensor, const std::string& in_name, const std::map<const SensorComponent*, std::string>& in_names,
+		std::vector<std::string>& in_log)
+	{
+		in_sensor->SetTouchCallback([in_name, &in_names, &in_log](bool in_bOnTouch, tSensorPtr in_other) {
+			in_log.push_back(in_name + (in_bOnTouch ? "+" : "-") + in_names.at(in_other.get()));
+		});
+	}
+
+	// Every touching pair, found by narrowphase-testing all of them (except pairs of sensors flagged static, which never touch each other)
+	tSensorPairSet BruteForceTouches(const std::vector<tSensorPtr>& in_sensors)
+	{
+		tSensorPairSet touches;
+		for(size_t a = 0; a < in_sensors.size(); ++a)
+		{
+			for(size_t b = a + 1; b < in_sensors.size(); ++b)
+			{
+				if(in_sensors[a]->IsStatic() && in_sensors[b]->IsStatic())
+				{
+					continue;
+				}
+				if(in_sensors[a]->IsTouching(in_sensors[b]))
+				{
+					touches.insert(MakePairKey(in_sensors[a], in_sensors[b]));
+				}
+			}
+		}
+		return touches;
+	}
+}
+
+TEST_CASE("SensorManager: spatial hash reports the same touches as brute force")
+{
+	std::mt19937 rng(1234);
+	std::uniform_real_distribution<float> posDist(-400.0f, 400.0f);
+	std::uniform_real_distribution<float> sizeDist(2.0f, 150.0f); //< Some sensors span several broadphase cells
+	std::uniform_int_distribution<uint32_t> filterDist(1, 7);
+	std::uniform_int_distribution<int32_t> percentDist(0, 99);
+
+	auto sensorManager = std::make_shared<SensorManager>();
+	std::vector<tSensorPtr> sensors;
+	tSensorPairSet reportedTouches;
+	for(int32_t i = 0; i < 300; ++i)
+	{
+		SensorShape shape;
+		if(percentDist(rng) < 50)
+		{
+			shape.SetCircle({ sizeDist(rng) * 0.5f });
+		}
+		else
+		{
+			shape.SetBox({ sizeDist(rng), sizeDist(rng) });
+		}
+		auto sensor = MakeSensor({ posDist(rng), posDist(rng) }, shape, filterDist(rng), filterDist(rng));
+		sensor->SetStatic(percentDist(rng) < 20);
+		TrackTouches(sensor, reportedTouches);
+		sensorManager->RegisterSensor(sensor);
+		sensors.push_back(sensor);
+	}
+
+	// Move most (non-static) sensors every frame, and leave the rest alone long enough to be demoted to the static partition
+	sensorManager->SetAutoStaticFrameCount(5);
+	for(int32_t frame = 0; frame < 40; ++frame)
+	{
+		for(size_t sensorIdx = 0; sensorIdx < sensors.size(); ++sensorIdx)
+		{
+			const auto& sensor = sensors[sensorIdx];
+			if(!sensor->IsStatic() && (sensorIdx % 3) != 0)
+			{
+				sensor->SetWorldPos(sensor->GetWorldPos() + Vec2f{ posDist(rng), posDist(rng) } * 0.05f);
+			}
+		}
+		sensorManager->Update();
+		REQUIRE(reportedTouches == BruteForceTouches(sensors));
+	}
+	CHECK(!reportedTouches.empty());
+}
+
+TEST_CASE("SensorManager: touch and untouch callbacks fire once each, in sensor order")
+{
+	SensorShape circle;
+	circle.SetCircle({ 8.0f });
+	auto sensorManager = std::make_shared<SensorManager>();
+	auto a = MakeSensor({ 0.0f, 0.0f }, circle, 1, 1);
+	auto b = MakeSensor({ 100.0f, 0.0f }, circle, 1, 1);
+	auto c = MakeSensor({ 200.0f, 0.0f }, circle, 1, 1);
+	std::map<const SensorComponent*, std::string> names = { { a.get(), "a" }, { b.get(), "b" }, { c.get(), "c" } };
+	std::vector<std::string> log;
+	for(const auto& sensor : { a, b, c })
+	{
+		LogTouches(sensor, names[sensor.get()], names, log);
+		sensorManager->RegisterSensor(sensor);
+	}
+	const auto UpdateAndTakeLog = [&sensorManager, &log]() {
+		sensorManager->Update();
+		auto frameLog = std::move(log);
+		log.clear();
+		return frameLog;
+	};
+	using tLog = std::vector<std::string>;
+
+	CHECK(UpdateAndTakeLog() == tLog{});
+
+	// Touches are dispatched in pair order (a-b before a-c before b-c), to both sensors of each pair
+	b->SetWorldPos({ 10.0f, 0.0f });
+	c->SetWorldPos({ 5.0f, 0.0f });
+	CHECK(UpdateAndTakeLog() == (tLog{ "a+b", "b+a", "a+c", "c+a", "b+c", "c+b" }));
+
+	// Staying in contact doesn't re-fire anything, even once the sensors have been idle long enough to be treated as static
+	for(int32_t frame = 0; frame < sensorManager->GetAutoStaticFrameCount() + 5; ++frame)
+	{
+		CHECK(UpdateAndTakeLog() == tLog{});
+	}
+
+	// Separating untouches only the pairs that stopped overlapping
+	c->SetWorldPos({ 200.0f, 0.0f });
+	CHECK(UpdateAndTakeLog() == (tLog{ "a-c", "c-a", "b-c", "c-b" }));
+	CHECK(UpdateAndTakeLog() == tLog{});
+
+	// A touch callback that separates its pair gets the untouch on the following update
+	a->SetTouchCallback([&log, &c](bool in_bOnTouch, tSensorPtr) {
+		log.push_back(in_bOnTouch ? "a+c" : "a-c");
+		if(in_bOnTouch)
+		{
+			c->SetWorldPos({ 200.0f, 0.0f });
+		}
+	});
+	c->SetWorldPos({ -10.0f, 0.0f });
+	CHECK(UpdateAndTakeLog() == (tLog{ "a+c", "c+a" }));
+	CHECK(UpdateAndTakeLog() == (tLog{ "a-c", "c-a" }));
+	CHECK(UpdateAndTakeLog() == tLog{});
+}
+
+TEST_CASE("SensorManager: enabling filtering on idle sensors starts their touch")
+{
+	SensorShape box;
+	box.SetBox({ 16.0f, 16.0f });
+	auto sensorManager = std::make_shared<SensorManager>();
+	auto a = MakeSensor({ 0.0f, 0.0f }, box, 0, 0);
+	auto b = MakeSensor({ 4.0f, 0.0f }, box, 1, 1);
+	auto c = MakeSensor({ 200.0f, 0.0f }, box, 0, 0);
+	tSensorPairSet reportedTouches;
+	for(const auto& sensor : { a, b, c })
+	{
+		TrackTouches(sensor, reportedTouches);
+		sensorManager->RegisterSensor(sensor);
+	}
+
+	// Let everything settle into the static partition, then switch a's filtering on (like a creature arming its hit sensor)
+	for(int32_t frame = 0; frame <= sensorManager->GetAutoStaticFrameCount(); ++frame)
+	{
+		sensorManager->Update();
+	}
+	CHECK(reportedTouches.empty());
+	a->SetFiltering(1, 1);
+	sensorManager->Update();
+	CHECK(reportedTouches == tSensorPairSet{ MakePairKey(a, b) });
+
+	// Same for a shape change that makes idle sensors overlap
+	for(int32_t frame = 0; frame <= sensorManager->GetAutoStaticFrameCount(); ++frame)
+	{
+		sensorManager->Update();
+	}
+	c->SetFiltering(1, 1);
+	sensorManager->Update();
+	CHECK(reportedTouches == tSensorPairSet{ MakePairKey(a, b) });
+	for(int32_t frame = 0; frame <= sensorManager->GetAutoStaticFrameCount(); ++frame)
+	{
+		sensorManager->Update();
+	}
+	SensorShape bigBox;
+	bigBox.SetBox({ 400.0f, 16.0f });
+	c->SetShape(bigBox);
+	sensorManager->Update();
+	CHECK(reportedTouches == (tSensorPairSet{ MakePairKey(a, b), MakePairKey(a, c), MakePairKey(b, c) }));
+}
+
+BENCHMARK_CASE("SensorManager: update with 500 static and 50 dynamic sensors")
+{
+	std::mt19937 rng(9);
+	std::uniform_real_distribution<float> posDist(0.0f, 2000.0f);
+	std::uniform_real_distribution<float> stepDist(-2.0f, 2.0f);
+	const auto MakeSensors = [&rng, &posDist](SensorManager& in_sensorManager, bool in_bFlagStatic) {
+		std::vector<tSensorPtr> dynamicSensors;
+		SensorShape circle;
+		circle.SetCircle({ 8.0f });
+		for(int32_t i = 0; i < 550; ++i)
+		{
+			auto sensor = MakeSensor({ posDist(rng), posDist(rng) }, circle, CL_Player | CL_Pickup, CL_Player | CL_Pickup);
+			if(i < 500)
+			{
+				sensor->SetStatic(in_bFlagStatic);
+			}
+			else
+			{
+				dynamicSensors.push_back(sensor);
+			}
+			in_sensorManager.RegisterSensor(sensor);
+		}
+		return dynamicSensors;
+	};
+	const auto Run = [&](const char* in_label, int32_t in_autoStaticFrameCount, bool in_bFlagStatic) {
+		auto sensorManager = std::make_shared<SensorManager>();
+		sensorManager->SetAutoStaticFrameCount(in_autoStaticFrameCount);
+		auto dynamicSensors = MakeSensors(*sensorManager, in_bFlagStatic);
+		for(int32_t frame = 0; frame < 60; ++frame) //< Warm up (and let idle sensors go static)
+		{
+			sensorManager->Update();
+		}
+		Test::Measure(in_label, 1000, [&]() {
+			for(const auto& sensor : dynamicSensors)
+			{
+				sensor->SetWorldPos(sensor->GetWorldPos() + Vec2f{ stepDist(rng), stepDist(rng) });
+			}
+			sensorManager->Update();
+		});
+	};
+	Run("all dynamic (auto-static off)", 0, false);
+	Run("500 auto-static", 30, false);
+	Run("500 flagged static", 0, true);
+}
+
+TEST_CASE("SensorManager: forgetting a sensor's touches reports its next overlap as a new touch")
+{
+	SensorShape circle;
+	circle.SetCircle({ 8.0f });
+	auto sensorManager = std::make_shared<SensorManager>();
+	auto shot = MakeSensor({ 0.0f, 0.0f }, circle, 1, 1);
+	auto target = MakeSensor({ 4.0f, 0.0f }, circle, 1, 1);
+	std::map<const SensorComponent*, std::string> names = { { shot.get(), "shot" }, { target.get(), "target" } };
+	std::vector<std::string> log;
+	for(const auto& sensor : { shot, target })
+	{
+		LogTouches(sensor, names[sensor.get()], names, log);
+		sensorManager->RegisterSensor(sensor);
+	}
+	using tLog = std::vector<std::string>;
+	sensorManager->Update();
+	CHECK(log == (tLog{ "shot+target", "target+shot" }));
+	log.clear();
+
+	// Park the shot and reuse it on the same target before the next update (like a pooled projectile released and refired in one frame):
+	// the forgotten pair untouches right away, and the reused shot's hit is reported again
+	shot->SetFiltering(0, 0);
+	sensorManager->ForgetTouches(shot);
+	CHECK(log == (tLog{ "shot-target", "target-shot" }));
+	log.clear();
+	shot->SetFiltering(1, 1);
+	sensorManager->Update();
+	CHECK(log == (tLog{ "shot+target", "target+shot" }));
+	log.clear();
+	sensorManager->Update();
+	CHECK(log == tLog{});
+
+	// Forgetting from inside a touch callback takes effect once the update has tracked that frame's new touches, so the pairs 
+	// untouch at the end of that update and touch again on the next one
+	auto other = MakeSensor({ 200.0f, 0.0f }, circle, 1, 1);
+	names[other.get()] = "other";
+	LogTouches(other, "other", names, log);
+	sensorManager->RegisterSensor(other);
+	other->SetTouchCallback([&log, &sensorManager, &other](bool in_bOnTouch, tSensorPtr) {
+		log.push_back(in_bOnTouch ? "other+" : "other-");
+		if(in_bOnTouch)
+		{
+			sensorManager->ForgetTouches(other);
+		}
+	});
+	other->SetWorldPos({ -4.0f, 0.0f });
+	sensorManager->Update();
+	CHECK(log == (tLog{ "shot+other", "other+", "target+other", "other+", "shot-other", "other-", "target-other", "other-" }));
+	log.clear();
+	sensorManager->Update();
+	CHECK(log == (tLog{ "shot+other", "other+", "target+other", "other+", "shot-other", "other-", "target-other", "other-" }));
+}
@@ -0,0 +1,114 @@
+#include "TestFramework.h"
+
+#include "Engine/SlotPool.h"
+
+TEST_CASE("SlotPool: released slots are reused most recent first, with a new generation")
+{
+	SlotPool pool;
+	pool.Reset(4);
+	CHECK(pool.GetCapacity() == 4);
+	CHECK(pool.GetNumFree() == 4);
+
+	// Fresh slots are handed out in order
+	for(int32_t slot = 0; slot < 4; ++slot)
+	{
+		CHECK(pool.Acquire() == slot);
+		CHECK(pool.IsInUse(slot));
+		CHECK(pool.GetGeneration(slot) == 0);
+	}
+	CHECK(pool.GetNumFree() == 0);
+
+	pool.Release(1);
+	pool.Release(3);
+	CHECK(!pool.IsInUse(1));
+	CHECK(pool.GetNumFree() == 2);
+	CHECK(pool.GetGeneration(1) == 1);
+	CHECK(pool.GetGeneration(3) == 1);
+	CHECK(pool.GetGeneration(0) == 0); //< Untouched slots keep their generation
+
+	CHECK(pool.Acquire() == 3);
+	CHECK(pool.Acquire() == 1);
+	CHECK(pool.GetGeneration(1) == 1); //< Acquiring doesn't bump it, so the generation read on acquire identifies this use
+	pool.Release(1);
+	CHECK(pool.Acquire() == 1);
+	CHECK(pool.GetGeneration(1) == 2);
+}
+
+TEST_CASE("SlotPool: handles to an ended use stay stale after the slot is reused")
+{
+	SlotPool pool;
+	pool.Reset(2);
+	const int32_t slot = pool.Acquire();
+	const uint32_t firstGen = pool.GetGeneration(slot);
+	CHECK(pool.IsCurrent(slot, firstGen));
+
+	// Stale while the slot sits free...
+	pool.Release(slot);
+	CHECK(!pool.IsCurrent(slot, firstGen));
+	CHECK(!pool.IsCurrent(slot, pool.GetGeneration(slot))); //< Free slots aren't current for any generation
+
+	// ...and once it's handed out again, only the new use's generation is current
+	CHECK(pool.Acquire() == slot);
+	const uint32_t secondGen = pool.GetGeneration(slot);
+	CHECK(secondGen != firstGen);
+	CHECK(!pool.IsCurrent(slot, firstGen));
+	CHECK(pool.IsCurrent(slot, secondGen));
+
+	// Many reuses later, the first handle is still stale
+	for(int32_t i = 0; i < 100; ++i)
+	{
+		pool.Release(slot);
+		CHECK(pool.Acquire() == slot);
+		CHECK(!pool.IsCurrent(slot, firstGen));
+		CHECK(!pool.IsCurrent(slot, secondGen));
+	}
+	CHECK(pool.GetGeneration(slot) == secondGen + 100);
+}
+
+TEST_CASE("SlotPool: acquiring from a full pool fails until a slot is released")
+{
+	SlotPool pool;
+	pool.Reset(3);
+	for(int32_t i = 0; i < 3; ++i)
+	{
+		CHECK(pool.Acquire() >= 0);
+	}
+	CHECK(pool.Acquire() == -1);
+	CHECK(pool.Acquire() == -1); //< Failing doesn't change anything
+	CHECK(pool.GetNumFree() == 0);
+	for(int32_t slot = 0; slot < 3; ++slot)
+	{
+		CHECK(pool.IsInUse(slot));
+	}
+
+	pool.Release(2);
+	CHECK(pool.Acquire() == 2);
+	CHECK(pool.Acquire() == -1);
+
+	// An empty pool never has anything to hand out
+	SlotPool emptyPool;
+	emptyPool.Reset(0);
+	CHECK(emptyPool.Acquire() == -1);
+	CHECK(emptyPool.GetNumFree() == 0);
+}
+
+TEST_CASE("SlotPool: resetting frees every slot and starts the generations over")
+{
+	SlotPool pool;
+	pool.Reset(2);
+	pool.Acquire();
+	pool.Acquire();
+	pool.Release(0);
+	pool.Acquire();
+	CHECK(pool.GetGeneration(0) == 1);
+
+	pool.Reset(3);
+	CHECK(pool.GetCapacity() == 3);
+	CHECK(pool.GetNumFree() == 3);
+	for(int32_t slot = 0; slot < 3; ++slot)
+	{
+		CHECK(!pool.IsInUse(slot));
+		CHECK(pool.GetGeneration(slot) == 0);
+	}
+	CHECK(pool.Acquire() == 0);
+}
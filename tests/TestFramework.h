@@ -0,0 +1,93 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Minimal test framework for the LostAndFoundTests console project:
+//   TEST_CASE("name") { CHECK(a == b); REQUIRE(ptr); }
+//   BENCHMARK_CASE("name") { ... } (only run when the runner is given --bench)
+// CHECK records a failure and keeps going, REQUIRE records a failure and ends the test case
+namespace Test
+{
+	using tTestFunc = void(*)();
+
+	struct TestCase
+	{
+		const char* m_name;
+		const char* m_file;
+		int m_line;
+		bool m_bBenchmark;
+		tTestFunc m_func;
+	};
+
+	inline std::vector<TestCase>& GetTestCases()
+	{
+		static std::vector<TestCase> s_testCases;
+		return s_testCases;
+	}
+
+	struct Registrar
+	{
+		Registrar(const char* in_name, const char* in_file, int in_line, bool in_bBenchmark, tTestFunc in_func)
+		{
+			GetTestCases().push_back({ in_name, in_file, in_line, in_bBenchmark, in_func });
+		}
+	};
+
+	// Failures recorded by the test case that's currently running
+	inline int32_t& GetNumFailures()
+	{
+		static int32_t s_numFailures = 0;
+		return s_numFailures;
+	}
+
+	struct RequireFailed
+	{
+	};
+
+	inline bool Check(bool in_bPassed, const char* in_expr, const char* in_file, int in_line)
+	{
+		if(!in_bPassed)
+		{
+			++GetNumFailures();
+			std::cout << "  " << in_file << "(" << in_line << "): check failed: " << in_expr << "\n";
+		}
+		return in_bPassed;
+	}
+
+	// Runs in_func in_iterations times and prints the average time per iteration
+	inline void Measure(const char* in_label, int32_t in_iterations, const std::function<void()>& in_func)
+	{
+		const auto startTime = std::chrono::steady_clock::now();
+		for(int32_t i = 0; i < in_iterations; ++i)
+		{
+			in_func();
+		}
+		const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - startTime;
+		std::cout << "  " << in_label << ": " << elapsed.count() / in_iterations << " ms\n";
+	}
+}
+
+#define TEST_INTERNAL_CONCAT2(a, b) a##b
+#define TEST_INTERNAL_CONCAT(a, b) TEST_INTERNAL_CONCAT2(a, b)
+#define TEST_INTERNAL_CASE(in_name, in_bBenchmark, in_func) \
+	static void in_func(); \
+	static Test::Registrar TEST_INTERNAL_CONCAT(in_func, _registrar)(in_name, __FILE__, __LINE__, in_bBenchmark, &in_func); \
+	static void in_func()
+
+#define TEST_CASE(in_name) TEST_INTERNAL_CASE(in_name, false, TEST_INTERNAL_CONCAT(TestCase_, __LINE__))
+#define BENCHMARK_CASE(in_name) TEST_INTERNAL_CASE(in_name, true, TEST_INTERNAL_CONCAT(BenchmarkCase_, __LINE__))
+
+#define CHECK(in_expr) Test::Check(static_cast<bool>(in_expr), #in_expr, __FILE__, __LINE__)
+#define REQUIRE(in_expr) \
+	do \
+	{ \
+		if(!Test::Check(static_cast<bool>(in_expr), #in_expr, __FILE__, __LINE__)) \
+		{ \
+			throw Test::RequireFailed{}; \
+		} \
+	} while(false)
@@ -0,0 +1,57 @@
+#include "TestFramework.h"
+
+#include <cstring>
+#include <exception>
+
+// Test runner
+// usage: LostAndFoundTests [--bench] [name filter]
+// runs every test case whose name contains the filter (benchmarks too, with --bench), and returns nonzero if any of them failed
+int main(int argc, char** argv)
+{
+	bool bRunBenchmarks = false;
+	const char* filter = "";
+	for(int i = 1; i < argc; ++i)
+	{
+		if(std::strcmp(argv[i], "--bench") == 0)
+		{
+			bRunBenchmarks = true;
+		}
+		else
+		{
+			filter = argv[i];
+		}
+	}
+
+	int32_t numRun = 0;
+	int32_t numFailed = 0;
+	for(const Test::TestCase& testCase : Test::GetTestCases())
+	{
+		if((testCase.m_bBenchmark && !bRunBenchmarks) || !std::strstr(testCase.m_name, filter))
+		{
+			continue;
+		}
+
+		std::cout << "[ RUN  ] " << testCase.m_name << "\n";
+		Test::GetNumFailures() = 0;
+		try
+		{
+			testCase.m_func();
+		}
+		catch(const Test::RequireFailed&)
+		{
+		}
+		catch(const std::exception& in_exception)
+		{
+			++Test::GetNumFailures();
+			std::cout << "  " << testCase.m_file << "(" << testCase.m_line << "): unhandled exception: " << in_exception.what() << "\n";
+		}
+
+		++numRun;
+		const bool bPassed = (Test::GetNumFailures() == 0);
+		numFailed += bPassed ? 0 : 1;
+		std::cout << (bPassed ? "[  OK  ] " : "[ FAIL ] ") << testCase.m_name << "\n";
+	}
+
+	std::cout << numRun - numFailed << "/" << numRun << " test cases passed\n";
+	return (numFailed == 0) ? 0 : 1;
+}
@@ -0,0 +1,207 @@
+#include "TestFramework.h"
+
+#include "Engine/TileMap.h"
+#include "Engine/Components/TilesComponent.h"
+
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+// Only bakes chunks (never draws them), so nothing here needs a window or a loaded texture
+
+namespace
+{
+	// Exposes the draw chunks, and bakes them without drawing
+	class ChunkedTiles : public TilesComponent
+	{
+	public:
+		using TilesComponent::TileChunk;
+		using TilesComponent::BakeChunk;
+
+		const std::vector<TileChunk>& GetChunks() const { return m_chunks; }
+		Vec2i GetChunkDims() const { return m_chunkDims; }
+		void SetChunkTransform(const Transform& in_transform) { m_chunkTransform = in_transform; } //< What Draw() does when the component has moved
+		void BakeAllChunks()
+		{
+			for(int32_t chunkIdx = 0; chunkIdx < (int32_t)m_chunks.size(); ++chunkIdx)
+			{
+				BakeChunk(chunkIdx);
+			}
+		}
+	};
+
+	// A sheet of in_numTiles tiles, in_columns wide, with a 1px margin and spacing (like the game's tile sets)
+	std::shared_ptr<TileSet> MakeTileSet(const std::string& in_name, int32_t in_numTiles, int32_t in_columns, Vec2i in_tileDims)
+	{
+		std::vector<Box2i> tiles;
+		for(int32_t i = 0; i < in_numTiles; ++i)
+		{
+			tiles.push_back({ 1 + (i % in_columns) * (in_tileDims.x + 1), 1 + (i / in_columns) * (in_tileDims.y + 1), in_tileDims.x, in_tileDims.y });
+		}
+		return std::make_shared<TileSet>(in_name, nullptr, in_tileDims, tiles);
+	}
+
+	// Two tile sets (ids 1-32 and 33-48), with roughly a third of the cells empty
+	std::shared_ptr<TileLayer> MakeRandomTileLayer(Vec2i in_gridDims, std::mt19937& in_rng)
+	{
+		const Vec2i tileDims = { 16, 16 };
+		const std::vector<std::shared_ptr<TileSet>> tileSets = { MakeTileSet("A", 32, 8, tileDims), MakeTileSet("B", 16, 4, tileDims) };
+		const std::vector<MinMaxi> tileIdRanges = { { 1, 33 }, { 33, 49 } };
+		std::uniform_int_distribution<int32_t> tileDist(-24, 48);
+		std::vector<int32_t> tiles((size_t)in_gridDims.x * (size_t)in_gridDims.y);
+		for(auto& tile : tiles)
+		{
+			tile = std::max(tileDist(in_rng), 0);
+		}
+		auto tileLayer = std::make_shared<TileLayer>("Tiles", eTileLayerType::Tile, in_gridDims);
+		tileLayer->SetTiles(tileSets, tiles, tileIdRanges);
+		return tileLayer;
+	}
+
+	// The sprite the old per-tile draw loop set up for the tile at in_gridPos
+	sf::Sprite MakeOldTileSprite(const TileLayer& in_tileLayer, const Transform& in_worldTransform, Vec2i in_gridPos, Box2i in_rect)
+	{
+		const auto& tileDims = in_tileLayer.GetTileDims();
+		sf::Sprite sprite;
+		sprite.setRotation(in_worldTransform.rot);
+		sprite.setScale(in_worldTransform.scale.x, -in_worldTransform.scale.y);
+		sprite.setOrigin(0.0f, (float)tileDims.y);
+		sprite.setTextureRect({ in_rect.x, in_rect.y, in_rect.w, in_rect.h });
+		const Vec2f tilePos = in_worldTransform.TransformPoint(Vec2f{ (float)(in_gridPos.x * tileDims.x), (float)(in_gridPos.y * tileDims.y) });
+		sprite.setPosition(tilePos.x, tilePos.y);
+		return sprite;
+	}
+
+	// Every tile in the chunk has one quad, with the same corners and texcoords the old sprite had
+	// (quads come in row order rather than the old loop's order, which doesn't matter since tiles of a set never overlap)
+	void CheckChunkMatchesOldSprites(const ChunkedTiles& in_tilesComp, int32_t in_chunkIdx, const Transform& in_worldTransform)
+	{
+		const auto& tileLayer = *in_tilesComp.GetTileLayer();
+		const auto& chunk = in_tilesComp.GetChunks()[in_chunkIdx];
+		REQUIRE(!chunk.m_bDirty);
+		REQUIRE(chunk.m_tileSetVerts.size() == tileLayer.GetTileSets().size());
+
+		const Vec2i chunkPos = { in_chunkIdx % in_tilesComp.GetChunkDims().x, in_chunkIdx / in_tilesComp.GetChunkDims().x };
+		const Vec2i gridDims = tileLayer.GetGridDims();
+		const int32_t chunkSize = TilesComponent::s_chunkSize;
+		for(size_t tilesetIdx = 0; tilesetIdx < tileLayer.GetTileSets().size(); ++tilesetIdx)
+		{
+			const auto& verts = chunk.m_tileSetVerts[tilesetIdx];
+			const MinMaxi tileIdRange = tileLayer.GetTileIdRanges()[tilesetIdx];
+			size_t vertIdx = 0;
+			for(int32_t row = chunkPos.y * chunkSize; row < std::min((chunkPos.y + 1) * chunkSize, gridDims.y); ++row)
+			{
+				for(int32_t col = chunkPos.x * chunkSize; col < std::min((chunkPos.x + 1) * chunkSize, gridDims.x); ++col)
+				{
+					const Vec2i gridPos = { col, -row - 1 };
+					const int32_t tile = tileLayer.GetTile(gridPos);
+					if(!tileIdRange.Contains_InclExcl(tile))
+					{
+						continue;
+					}
+					const Box2i rect = tileLayer.GetTileSets()[tilesetIdx]->GetTiles()[(size_t)(tile - tileIdRange.m_min)];
+					const sf::Sprite sprite = MakeOldTileSprite(tileLayer, in_worldTransform, gridPos, rect);
+					REQUIRE(vertIdx + 4 <= verts.getVertexCount());
+
+					// Each vertex sits where the sprite put the corner of its texture rect with the same texcoord
+					int32_t cornersSeen = 0;
+					for(size_t cornerIdx = 0; cornerIdx < 4; ++cornerIdx)
+					{
+						const sf::Vertex& vert = verts[vertIdx + cornerIdx];
+						const sf::Vector2f local = { vert.texCoords.x - (float)rect.x, vert.texCoords.y - (float)rect.y };
+						const bool bRight = local.x == (float)rect.w;
+						const bool bBottom = local.y == (float)rect.h;
+						CHECK((local.x == 0.0f || bRight));
+						CHECK((local.y == 0.0f || bBottom));
+						cornersSeen |= 1 << ((bRight ? 1 : 0) + (bBottom ? 2 : 0));
+
+						const sf::Vector2f expectedPos = sprite.getTransform().transformPoint(local);
+						CHECK(std::abs(vert.position.x - expectedPos.x) < 0.001f);
+						CHECK(std::abs(vert.position.y - expectedPos.y) < 0.001f);
+					}
+					CHECK(cornersSeen == 0xF);
+					vertIdx += 4;
+				}
+			}
+			CHECK(vertIdx == verts.getVertexCount()); //< No quads for cells the tile set doesn't own
+		}
+	}
+
+	std::vector<int32_t> GetDirtyChunks(const ChunkedTiles& in_tilesComp)
+	{
+		std::vector<int32_t> dirtyChunks;
+		for(int32_t chunkIdx = 0; chunkIdx < (int32_t)in_tilesComp.GetChunks().size(); ++chunkIdx)
+		{
+			if(in_tilesComp.GetChunks()[chunkIdx].m_bDirty)
+			{
+				dirtyChunks.push_back(chunkIdx);
+			}
+		}
+		return dirtyChunks;
+	}
+}
+
+TEST_CASE("TileChunks: baked chunk quads match the sprites the old draw loop used")
+{
+	std::mt19937 rng(11);
+	auto tilesComp = std::make_shared<ChunkedTiles>();
+	tilesComp->SetTileLayer(MakeRandomTileLayer({ 70, 40 }, rng)); //< Partial chunks along the right and bottom edges
+	REQUIRE(tilesComp->GetChunkDims() == (Vec2i{ 3, 2 }));
+	REQUIRE(tilesComp->GetChunks().size() == 6);
+
+	Transform moved = Transform::Identity;
+	moved.pos = { 100.0f, -37.0f };
+	moved.scale = { 2.0f, 2.0f };
+	Transform rotated = moved;
+	rotated.rot = 90.0f;
+	for(const Transform& worldTransform : { Transform::Identity, moved, rotated })
+	{
+		tilesComp->SetChunkTransform(worldTransform);
+		tilesComp->BakeAllChunks();
+		for(int32_t chunkIdx = 0; chunkIdx < 6; ++chunkIdx)
+		{
+			CheckChunkMatchesOldSprites(*tilesComp, chunkIdx, worldTransform);
+		}
+	}
+}
+
+TEST_CASE("TileChunks: SetTile only dirties the chunk holding the cell")
+{
+	std::mt19937 rng(12);
+	auto tilesComp = std::make_shared<ChunkedTiles>();
+	tilesComp->SetTileLayer(MakeRandomTileLayer({ 70, 40 }, rng));
+	CHECK(GetDirtyChunks(*tilesComp).size() == 6); //< Everything starts out dirty
+	tilesComp->BakeAllChunks();
+	CHECK(GetDirtyChunks(*tilesComp).empty());
+
+	// Chunks are numbered row by row from the top of the layer
+	const std::pair<Vec2i, int32_t> edits[] = {
+		{ { 0, -1 }, 0 },
+		{ { 31, -32 }, 0 },
+		{ { 32, -32 }, 1 },
+		{ { 40, -35 }, 4 },
+		{ { 69, -40 }, 5 }, //< Bottom right cell, in a partial chunk
+	};
+	for(const auto& [gridPos, chunkIdx] : edits)
+	{
+		tilesComp->SetTile(gridPos, tilesComp->GetTileLayer()->GetTile(gridPos) == 40 ? 3 : 40); //< Always a change, and sometimes a change of tile set
+		CHECK(GetDirtyChunks(*tilesComp) == std::vector<int32_t>{ chunkIdx });
+
+		// Re-baking it picks up the new tile
+		tilesComp->BakeChunk(chunkIdx);
+		CHECK(GetDirtyChunks(*tilesComp).empty());
+		CheckChunkMatchesOldSprites(*tilesComp, chunkIdx, Transform::Identity);
+	}
+
+	// Cells outside the layer don't belong to any chunk
+	for(const Vec2i gridPos : { Vec2i{ -1, -1 }, Vec2i{ 0, 0 }, Vec2i{ 70, -1 }, Vec2i{ 0, -41 } })
+	{
+		tilesComp->SetTile(gridPos, 1);
+		CHECK(GetDirtyChunks(*tilesComp).empty());
+	}
+}
@@ -0,0 +1,286 @@
+#include "TestFramework.h"
+
+#include "Engine/GridBitset.h"
+#include "Engine/MathGeometry.h"
+#include "Engine/TileMap.h"
+#include "Engine/Components/TilesComponent.h"
+
+#include <cmath>
+#include <functional>
+#include <random>
+#include <vector>
+
+namespace
+{
+	// A tile layer with roughly in_solidPercent% of its cells holding a tile
+	std::shared_ptr<TileLayer> MakeRandomTileLayer(Vec2i in_gridDims, int32_t in_solidPercent, std::mt19937& in_rng)
+	{
+		std::uniform_int_distribution<int32_t> percentDist(0, 99);
+		std::vector<int32_t> tiles((size_t)in_gridDims.x * (size_t)in_gridDims.y);
+		for(auto& tile : tiles)
+		{
+			tile = (percentDist(in_rng) < in_solidPercent) ? 1 + percentDist(in_rng) : 0;
+		}
+		auto tileLayer = std::make_shared<TileLayer>("Collision", eTileLayerType::Tile, in_gridDims);
+		tileLayer->SetTiles({}, tiles, {});
+		return tileLayer;
+	}
+
+	void CheckMatchesTileLayer(const GridBitset& in_solidCells, const TileLayer& in_tileLayer)
+	{
+		const auto gridBox = in_tileLayer.GetGridBoundingBox();
+		REQUIRE(in_solidCells.GetGridBox().GetMin() == gridBox.GetMin());
+		REQUIRE(in_solidCells.GetGridBox().GetMax() == gridBox.GetMax());
+		for(int32_t y = gridBox.GetBottom() - 1; y <= gridBox.GetTop(); ++y)
+		{
+			for(int32_t x = gridBox.GetLeft() - 1; x <= gridBox.GetRight(); ++x)
+			{
+				REQUIRE(in_solidCells.Test({ x, y }) == in_tileLayer.HasTile({ x, y }));
+			}
+		}
+	}
+}
+
+TEST_CASE("GridBitset: TilesComponent solid cells match the tile layer")
+{
+	std::mt19937 rng(4);
+	auto tileLayer = MakeRandomTileLayer({ 150, 40 }, 30, rng); //< Rows span several 64-bit words
+	auto tilesComp = std::make_shared<TilesComponent>();
+	tilesComp->SetTileLayer(tileLayer);
+	CheckMatchesTileLayer(tilesComp->GetSolidCells(), *tileLayer);
+
+	// Edits made through the component keep the cache in sync
+	std::uniform_int_distribution<int32_t> colDist(0, 149);
+	std::uniform_int_distribution<int32_t> rowDist(-40, -1);
+	std::uniform_int_distribution<int32_t> tileDist(-1, 3);
+	for(int32_t i = 0; i < 2000; ++i)
+	{
+		tilesComp->SetTile({ colDist(rng), rowDist(rng) }, tileDist(rng));
+	}
+	CheckMatchesTileLayer(tilesComp->GetSolidCells(), *tileLayer);
+}
+
+TEST_CASE("GridBitset: row and column span queries match per-cell tests")
+{
+	std::mt19937 rng(5);
+	auto tileLayer = MakeRandomTileLayer({ 200, 70 }, 2, rng); //< Sparse, so plenty of spans come back empty
+	auto tilesComp = std::make_shared<TilesComponent>();
+	tilesComp->SetTileLayer(tileLayer);
+	const GridBitset& solidCells = tilesComp->GetSolidCells();
+
+	std::uniform_int_distribution<int32_t> colDist(-10, 210);
+	std::uniform_int_distribution<int32_t> rowDist(-80, 10);
+	for(int32_t i = 0; i < 5000; ++i)
+	{
+		const int32_t row = rowDist(rng);
+		const int32_t col = colDist(rng);
+		const int32_t colA = colDist(rng);
+		const int32_t colB = colDist(rng);
+		const int32_t rowA = rowDist(rng);
+		const int32_t rowB = rowDist(rng);
+		const std::pair<int32_t, int32_t> colSpan = std::minmax(colA, colB);
+		const std::pair<int32_t, int32_t> rowSpan = std::minmax(rowA, rowB);
+
+		bool bAnyInRow = false;
+		for(int32_t x = colSpan.first; x <= colSpan.second; ++x)
+		{
+			bAnyInRow |= tileLayer->HasTile({ x, row });
+		}
+		bool bAnyInColumn = false;
+		for(int32_t y = rowSpan.first; y <= rowSpan.second; ++y)
+		{
+			bAnyInColumn |= tileLayer->HasTile({ col, y });
+		}
+		REQUIRE(solidCells.AnyInRow(row, colSpan.first, colSpan.second) == bAnyInRow);
+		REQUIRE(solidCells.AnyInColumn(col, rowSpan.first, rowSpan.second) == bAnyInColumn);
+	}
+}
+
+TEST_CASE("GridBitset: bitset box sweep matches the per-cell box sweep")
+{
+	std::mt19937 rng(6);
+	auto tileLayer = MakeRandomTileLayer({ 100, 60 }, 8, rng);
+	auto tilesComp = std::make_shared<TilesComponent>();
+	tilesComp->SetTileLayer(tileLayer);
+
+	Transform gridToWorld = Transform::Identity;
+	gridToWorld.scale = { 16.0f, 16.0f };
+	const auto gridBox = tileLayer->GetGridBoundingBox();
+	const auto cellIsSolid = [&tileLayer](Vec2i in_gridPos) {
+		return tileLayer->HasTile(in_gridPos);
+	};
+
+	std::uniform_real_distribution<float> xDist(-32.0f, 1632.0f);
+	std::uniform_real_distribution<float> yDist(-992.0f, 32.0f);
+	std::uniform_real_distribution<float> sizeDist(4.0f, 60.0f);
+	std::uniform_real_distribution<float> sweepDist(-200.0f, 200.0f);
+	int32_t numHits = 0;
+	for(int32_t i = 0; i < 5000; ++i)
+	{
+		const Box2f box = Box2f::FromCenter({ xDist(rng), yDist(rng) }, { sizeDist(rng), sizeDist(rng) });
+		Vec2f sweepVec = { sweepDist(rng), sweepDist(rng) };
+		if(i % 4 == 0)
+		{
+			sweepVec.y = 0.0f; //< Axis-aligned sweeps only test one leading edge
+		}
+		const auto bitsetResult = Math::SweepBoxAgainstGrid(box, sweepVec, gridToWorld, tilesComp->GetSolidCells());
+		const auto cellResult = Math::SweepBoxAgainstGrid(box, sweepVec, gridToWorld, gridBox, cellIsSolid);
+		REQUIRE(bitsetResult.has_value() == cellResult.has_value());
+		if(bitsetResult)
+		{
+			++numHits;
+			CHECK(bitsetResult->m_dist == cellResult->m_dist);
+			CHECK(bitsetResult->m_normal == cellResult->m_normal);
+		}
+	}
+	CHECK(numHits > 0);
+}
+
+TEST_CASE("GridBitset: batched box sweeps match single sweeps, in query order")
+{
+	std::mt19937 rng(10);
+	auto tileLayer = MakeRandomTileLayer({ 100, 60 }, 8, rng);
+	auto tilesComp = std::make_shared<TilesComponent>();
+	tilesComp->SetTileLayer(tileLayer);
+	const GridBitset& solidCells = tilesComp->GetSolidCells();
+
+	Transform gridToWorld = Transform::Identity;
+	gridToWorld.scale = { 16.0f, 16.0f };
+	std::uniform_real_distribution<float> xDist(-32.0f, 1632.0f);
+	std::uniform_real_distribution<float> yDist(-992.0f, 32.0f);
+	std::uniform_real_distribution<float> sizeDist(2.0f, 12.0f);
+	std::uniform_real_distribution<float> sweepDist(-300.0f, 300.0f);
+	std::vector<Math::GridSweepQuery> queries;
+	for(int32_t i = 0; i < 2000; ++i)
+	{
+		const Vec2f delta = (i % 10 == 0) ? Vec2f::Zero : Vec2f{ sweepDist(rng), sweepDist(rng) }; //< Some projectiles don't move this frame
+		queries.push_back({ { xDist(rng), yDist(rng) }, delta, { sizeDist(rng), sizeDist(rng) } });
+	}
+
+	// Sweep twice into the same output, like ProjectileManager does frame to frame, to check stale results don't leak through
+	std::vector<std::optional<Math::GridSweepHit>> hits;
+	std::vector<Math::GridSweepQuery> reversedQueries(queries.rbegin(), queries.rend());
+	Math::SweepBoxesAgainstGrid(reversedQueries, gridToWorld, solidCells, hits);
+	Math::SweepBoxesAgainstGrid(queries, gridToWorld, solidCells, hits);
+	REQUIRE(hits.size() == queries.size());
+
+	int32_t numHits = 0;
+	for(size_t queryIdx = 0; queryIdx < queries.size(); ++queryIdx)
+	{
+		const auto& query = queries[queryIdx];
+		const auto& hit = hits[queryIdx];
+		if(query.m_delta == Vec2f::Zero)
+		{
+			CHECK(!hit.has_value());
+			continue;
+		}
+		const auto singleResult = Math::SweepBoxAgainstGrid(Box2f::FromCenter(query.m_origin, query.m_halfExtents * 2.0f), query.m_delta, gridToWorld, solidCells);
+		REQUIRE(hit.has_value() == singleResult.has_value());
+		if(hit)
+		{
+			++numHits;
+			CHECK(std::abs(hit->m_time - Math::Min(singleResult->m_dist / query.m_delta.Len(), 1.0f)) < 0.0001f); //< Batched hit times are clamped to the end of the move
+			CHECK(hit->m_normal == singleResult->m_normal);
+		}
+	}
+	CHECK(numHits > 0);
+}
+
+TEST_CASE("GridBitset: fast small boxes don't tunnel through thin walls")
+{
+	// A one-cell-thick vertical wall at column 10, and a one-cell-thick floor at row -10
+	std::vector<int32_t> tiles(20 * 20, 0);
+	for(int32_t i = 0; i < 20; ++i)
+	{
+		tiles[(size_t)i * 20 + 10] = 1;
+		tiles[(size_t)9 * 20 + i] = 1;
+	}
+	auto tileLayer = std::make_shared<TileLayer>("Collision", eTileLayerType::Tile, Vec2i{ 20, 20 });
+	tileLayer->SetTiles({}, tiles, {});
+	auto tilesComp = std::make_shared<TilesComponent>();
+	tilesComp->SetTileLayer(tileLayer);
+	const GridBitset& solidCells = tilesComp->GetSolidCells();
+	REQUIRE(solidCells.Test({ 10, -5 }));
+	REQUIRE(solidCells.Test({ 5, -10 }));
+
+	Transform gridToWorld = Transform::Identity;
+	gridToWorld.scale = { 16.0f, 16.0f };
+	const Vec2f halfExtents = { 1.0f, 1.0f }; //< Much smaller than a cell, and moving many cells per frame
+	const std::vector<Math::GridSweepQuery> queries = {
+		{ { 40.0f, -72.0f }, { 1000.0f, 0.0f }, halfExtents },
+		{ { 280.0f, -72.0f }, { -1000.0f, 0.0f }, halfExtents },
+		{ { 40.0f, -40.0f }, { 0.0f, -1000.0f }, halfExtents },
+		{ { 40.0f, -40.0f }, { 1000.0f, -90.0f }, halfExtents },
+		{ { 40.0f, -72.0f }, { 100.0f, 0.0f }, halfExtents }, //< Stops short of the wall
+	};
+	std::vector<std::optional<Math::GridSweepHit>> hits;
+	Math::SweepBoxesAgainstGrid(queries, gridToWorld, solidCells, hits);
+	REQUIRE(hits.size() == queries.size());
+
+	REQUIRE(hits[0].has_value());
+	CHECK((hits[0]->m_normal == Vec2f{ -1.0f, 0.0f }));
+	CHECK(std::abs(queries[0].m_origin.x + queries[0].m_delta.x * hits[0]->m_time - (160.0f - 1.0f)) < 0.01f);
+	REQUIRE(hits[1].has_value());
+	CHECK((hits[1]->m_normal == Vec2f{ 1.0f, 0.0f }));
+	CHECK(std::abs(queries[1].m_origin.x + queries[1].m_delta.x * hits[1]->m_time - (176.0f + 1.0f)) < 0.01f);
+	REQUIRE(hits[2].has_value());
+	CHECK((hits[2]->m_normal == Vec2f{ 0.0f, 1.0f }));
+	REQUIRE(hits[3].has_value());
+	CHECK((hits[3]->m_normal == Vec2f{ -1.0f, 0.0f }));
+	CHECK(!hits[4].has_value());
+}
+
+BENCHMARK_CASE("GridBitset: 100k box sweeps on a 256x256 grid, std::function vs inlined cell queries")
+{
+	std::mt19937 rng(11);
+	auto tileLayer = MakeRandomTileLayer({ 256, 256 }, 5, rng);
+	auto tilesComp = std::make_shared<TilesComponent>();
+	tilesComp->SetTileLayer(tileLayer);
+
+	Transform gridToWorld = Transform::Identity;
+	gridToWorld.scale = { 16.0f, 16.0f };
+	const auto gridBox = tileLayer->GetGridBoundingBox();
+	const auto cellIsSolid = [&tileLayer](Vec2i in_gridPos) {
+		return tileLayer->HasTile(in_gridPos);
+	};
+
+	// Character-sized boxes moving up to a few cells
+	std::uniform_real_distribution<float> xDist(0.0f, 4096.0f);
+	std::uniform_real_distribution<float> yDist(-4096.0f, 0.0f);
+	std::uniform_real_distribution<float> sweepDist(-48.0f, 48.0f);
+	std::vector<std::pair<Box2f, Vec2f>> sweeps;
+	for(int32_t i = 0; i < 100000; ++i)
+	{
+		sweeps.push_back({ Box2f::FromCenter({ xDist(rng), yDist(rng) }, { 16.0f, 24.0f }), { sweepDist(rng), sweepDist(rng) } });
+	}
+
+	// The non-template overload, which wraps the cell query in a std::function on every call (as all callers used to)
+	std::optional<Math::BoxSweepResults> (*sweepWithStdFunction)(Box2f, Vec2f, Transform, Box2i, std::function<bool(Vec2i)>) = &Math::SweepBoxAgainstGrid;
+	int32_t numStdFunctionHits = 0;
+	Test::Measure("std::function cell query", 5, [&]() {
+		numStdFunctionHits = 0;
+		for(const auto& sweep : sweeps)
+		{
+			numStdFunctionHits += sweepWithStdFunction(sweep.first, sweep.second, gridToWorld, gridBox, cellIsSolid).has_value() ? 1 : 0;
+		}
+	});
+	int32_t numTemplateHits = 0;
+	Test::Measure("templated cell query", 5, [&]() {
+		numTemplateHits = 0;
+		for(const auto& sweep : sweeps)
+		{
+			numTemplateHits += Math::SweepBoxAgainstGrid(sweep.first, sweep.second, gridToWorld, gridBox, cellIsSolid).has_value() ? 1 : 0;
+		}
+	});
+	int32_t numBitsetHits = 0;
+	Test::Measure("bitset", 5, [&]() {
+		numBitsetHits = 0;
+		for(const auto& sweep : sweeps)
+		{
+			numBitsetHits += Math::SweepBoxAgainstGrid(sweep.first, sweep.second, gridToWorld, tilesComp->GetSolidCells()).has_value() ? 1 : 0;
+		}
+	});
+	CHECK(numStdFunctionHits > 0);
+	CHECK(numTemplateHits == numStdFunctionHits);
+	CHECK(numBitsetHits == numStdFunctionHits);
+}